@@ -0,0 +1,85 @@
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+
+#include "HazardPointerManager.hpp"
+#include "PerfCounters.hpp"
+#include "atomic_shared_ptr.hpp"
+
+using namespace HazardSystem;
+
+// Reading a shared object published for many readers, 1..8 threads. Each
+// iteration gets a safe reference, reads one field and drops it.
+//   Borrow:       atomic_shared_ptr::protect, raw hazard, no refcount.
+//   ProtectOwned: HazardPointerManager::protect(std::atomic<std::shared_ptr>),
+//                 two loads plus the owner copy kept in the ProtectedPointer.
+//   StdLoad:      a plain std::atomic<std::shared_ptr>::load copy.
+// Every 4096 iterations thread 0 replaces the object, so retire is in the mix.
+// Items are reads.
+
+struct Payload {
+    uint64_t value;
+};
+
+static atomic_shared_ptr<Payload> s_borrowed(std::make_shared<Payload>(Payload{1}));
+static std::atomic<std::shared_ptr<Payload>> s_std(std::make_shared<Payload>(Payload{1}));
+
+template <typename Read, typename Replace>
+static void run(benchmark::State& state, Read&& read, Replace&& replace) {
+    uint64_t sum = 0;
+    uint64_t i   = 0;
+    Perf::Scope perf(state, 1.0);
+    for (auto _ : state) {
+        sum += read();
+        if (state.thread_index() == 0 and (++i & 4095u) == 0) {
+            replace(i);
+        }
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_AtomicSharedPtr_Borrow(benchmark::State& state) {
+    run(state,
+        [] {
+            auto view = s_borrowed.protect();
+            return view ? view->value : 0;
+        },
+        [](uint64_t i) { s_borrowed.store(std::make_shared<Payload>(Payload{i})); });
+}
+
+static void BM_HazardManager_ProtectOwned(benchmark::State& state) {
+    static auto& manager = HazardPointerManager<Payload>::instance();
+    run(state,
+        [] {
+            auto view = manager.protect(s_std);
+            return view ? view->value : 0;
+        },
+        [](uint64_t i) { manager.retire(s_std.exchange(std::make_shared<Payload>(Payload{i}))); });
+}
+
+static void BM_StdAtomicSharedPtr_Load(benchmark::State& state) {
+    run(state,
+        [] {
+            auto owned = s_std.load(std::memory_order_acquire);
+            return owned ? owned->value : 0;
+        },
+        [](uint64_t i) { s_std.store(std::make_shared<Payload>(Payload{i})); });
+}
+
+BENCHMARK(BM_AtomicSharedPtr_Borrow)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_HazardManager_ProtectOwned)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_StdAtomicSharedPtr_Load)->ThreadRange(1, 8)->UseRealTime();
+
+int main(int argc, char** argv) {
+    std::cout << "AtomicSharedPtr: borrowed hazard view vs owning shared_ptr protect vs std::atomic<shared_ptr> load\n";
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
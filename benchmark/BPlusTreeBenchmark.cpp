@@ -0,0 +1,156 @@
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+
+#include "BPlusTree.hpp"
+#include "PerfCounters.hpp"
+
+using namespace HazardSystem;
+
+// Ordered index of 10M uint64 keys (even, hashed order) read and written by
+// 1..8 threads. Lookup finds a random present key, Insert adds fresh odd
+// keys (the structure keeps them), Scan visits 1000 consecutive entries from
+// a random key. The baseline is a std::map under a std::shared_mutex.
+// Items are operations, or entries visited for Scan. Both tables are built
+// once on first use, which takes a while.
+
+static constexpr uint64_t C_KEYS  = 10'000'000;
+static constexpr size_t C_RANGE   = 1000;
+
+static uint64_t mix(uint64_t x) {
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+static uint64_t base_key(const uint64_t& i) {
+    return mix(i) & ~1ULL;
+}
+
+static std::atomic<uint64_t> s_fresh{0};
+
+static BPlusTree<uint64_t, uint64_t>& tree(void) {
+    static BPlusTree<uint64_t, uint64_t> s_tree;
+    static const bool s_filled = [] {
+        for (uint64_t i = 0; i < C_KEYS; ++i) {
+            s_tree.insert_or_assign(base_key(i), i);
+        }
+        return true;
+    }();
+    benchmark::DoNotOptimize(s_filled);
+    return s_tree;
+}
+
+struct LockedMap {
+    LockedMap(void) {
+        for (uint64_t i = 0; i < C_KEYS; ++i) {
+            map.emplace(base_key(i), i);
+        }
+    }
+
+    std::optional<uint64_t> find(const uint64_t& key) const {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        auto it = map.find(key);
+        return it == map.end() ? std::nullopt : std::optional<uint64_t>(it->second);
+    }
+
+    void insert(const uint64_t& key, const uint64_t& value) {
+        std::unique_lock<std::shared_mutex> lock(mutex);
+        map.insert_or_assign(key, value);
+    }
+
+    uint64_t scan(const uint64_t& from) const {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        uint64_t sum = 0;
+        size_t seen  = 0;
+        for (auto it = map.lower_bound(from); it != map.end() && seen < C_RANGE; ++it, ++seen) {
+            sum += it->second;
+        }
+        return sum;
+    }
+
+    mutable std::shared_mutex mutex;
+    std::map<uint64_t, uint64_t> map;
+};
+
+static LockedMap& locked(void) {
+    static LockedMap s_map;
+    return s_map;
+}
+
+template <typename Op>
+static void run(benchmark::State& state, const double& items, Op&& op) {
+    uint64_t i   = static_cast<uint64_t>(state.thread_index()) * 7919u;
+    uint64_t sum = 0;
+    Perf::Scope perf(state, items);
+    for (auto _ : state) {
+        i = (i + 104729u) % C_KEYS;
+        sum += op(i);
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(static_cast<int64_t>(static_cast<double>(state.iterations()) * items));
+}
+
+static void BM_BPlusTree_Lookup(benchmark::State& state) {
+    auto& index = tree();
+    run(state, 1.0, [&](uint64_t i) { return index.find(base_key(i)).value_or(0); });
+}
+
+static void BM_LockedMap_Lookup(benchmark::State& state) {
+    auto& index = locked();
+    run(state, 1.0, [&](uint64_t i) { return index.find(base_key(i)).value_or(0); });
+}
+
+static void BM_BPlusTree_Insert(benchmark::State& state) {
+    auto& index = tree();
+    run(state, 1.0, [&](uint64_t i) {
+        index.insert_or_assign(mix(s_fresh.fetch_add(1, std::memory_order_relaxed) + C_KEYS) | 1ULL, i);
+        return i;
+    });
+}
+
+static void BM_LockedMap_Insert(benchmark::State& state) {
+    auto& index = locked();
+    run(state, 1.0, [&](uint64_t i) {
+        index.insert(mix(s_fresh.fetch_add(1, std::memory_order_relaxed) + C_KEYS) | 1ULL, i);
+        return i;
+    });
+}
+
+static void BM_BPlusTree_Scan(benchmark::State& state) {
+    auto& index = tree();
+    run(state, static_cast<double>(C_RANGE), [&](uint64_t i) {
+        uint64_t sum = 0;
+        index.scan(base_key(i), C_RANGE, [&](const uint64_t&, const uint64_t& value) { sum += value; });
+        return sum;
+    });
+}
+
+static void BM_LockedMap_Scan(benchmark::State& state) {
+    auto& index = locked();
+    run(state, static_cast<double>(C_RANGE), [&](uint64_t i) { return index.scan(base_key(i)); });
+}
+
+BENCHMARK(BM_BPlusTree_Lookup)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_LockedMap_Lookup)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_BPlusTree_Scan)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_LockedMap_Scan)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_BPlusTree_Insert)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_LockedMap_Insert)->ThreadRange(1, 8)->UseRealTime();
+
+int main(int argc, char** argv) {
+    std::cout << "BPlusTree: OLC B+-tree vs shared_mutex std::map, 10M keys\n";
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
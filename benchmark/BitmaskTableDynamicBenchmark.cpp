@@ -7,6 +7,7 @@
 #include <algorithm>
 
 #include "BitmaskTable.hpp"
+#include "PerfCounters.hpp"
 
 using namespace HazardSystem;
 
@@ -51,6 +52,8 @@ public:
 BENCHMARK_DEFINE_F(BitmaskDynamicFixture, AcquireRelease)(benchmark::State& state) {
     auto payload = std::make_unique<BenchmarkTestData>(11);
 
+    Perf::Scope perf(state);
+
     for (auto _ : state) {
         auto idx = table->acquire();
         benchmark::DoNotOptimize(idx);
@@ -70,8 +73,11 @@ BENCHMARK_DEFINE_F(BitmaskDynamicFixture, IterateActive)(benchmark::State& state
     std::vector<std::unique_ptr<BenchmarkTestData>> owned;
     owned.reserve(fill_target);
 
+    Perf::Scope perf(state);
+
     for (auto _ : state) {
         state.PauseTiming();
+        perf.pause();
         table->clear();
         owned.clear();
         for (size_t i = 0; i < fill_target; ++i) {
@@ -80,6 +86,7 @@ BENCHMARK_DEFINE_F(BitmaskDynamicFixture, IterateActive)(benchmark::State& state
             owned.emplace_back(std::make_unique<BenchmarkTestData>(static_cast<int>(i)));
             table->set(idx.value(), owned.back().get());
         }
+        perf.resume();
         state.ResumeTiming();
 
         size_t visited = 0;
@@ -99,8 +106,11 @@ BENCHMARK_DEFINE_F(BitmaskDynamicFixture, IterateActive)(benchmark::State& state
 BENCHMARK_DEFINE_F(BitmaskDynamicFixture, Clear)(benchmark::State& state) {
     auto payload = std::make_unique<BenchmarkTestData>(5);
 
+    Perf::Scope perf(state);
+
     for (auto _ : state) {
         state.PauseTiming();
+        perf.pause();
         table->clear();
         for (size_t i = 0; i < capacity; ++i) {
             auto idx = table->acquire();
@@ -109,6 +119,7 @@ BENCHMARK_DEFINE_F(BitmaskDynamicFixture, Clear)(benchmark::State& state) {
             }
             table->set(idx.value(), payload.get());
         }
+        perf.resume();
         state.ResumeTiming();
 
         table->clear();
@@ -123,6 +134,8 @@ BENCHMARK_DEFINE_F(BitmaskDynamicFixture, Clear)(benchmark::State& state) {
 BENCHMARK_DEFINE_F(BitmaskDynamicFixture, AcquireIteratorSet)(benchmark::State& state) {
     auto payload = std::make_unique<BenchmarkTestData>(13);
 
+    Perf::Scope perf(state);
+
     for (auto _ : state) {
         auto it = table->acquire_iterator();
         benchmark::DoNotOptimize(it);
@@ -144,8 +157,11 @@ BENCHMARK_DEFINE_F(BitmaskDynamicFixture, ActiveChecks)(benchmark::State& state)
     std::vector<std::unique_ptr<BenchmarkTestData>> owned;
     owned.reserve(fill_count);
 
+    Perf::Scope perf(state);
+
     for (auto _ : state) {
         state.PauseTiming();
+        perf.pause();
         table->clear();
         owned.clear();
         for (size_t i = 0; i < fill_count; ++i) {
@@ -154,6 +170,7 @@ BENCHMARK_DEFINE_F(BitmaskDynamicFixture, ActiveChecks)(benchmark::State& state)
             owned.emplace_back(std::make_unique<BenchmarkTestData>(static_cast<int>(i)));
             table->set(idx.value(), owned.back().get());
         }
+        perf.resume();
         state.ResumeTiming();
 
         size_t hits = 0;
@@ -178,8 +195,11 @@ BENCHMARK_DEFINE_F(BitmaskDynamicFixture, FindPredicate)(benchmark::State& state
     std::vector<std::unique_ptr<BenchmarkTestData>> owned;
     owned.reserve(capacity);
 
+    Perf::Scope perf(state);
+
     for (auto _ : state) {
         state.PauseTiming();
+        perf.pause();
         table->clear();
         const size_t fill_count = std::min<size_t>(capacity, 512);
         owned.clear();
@@ -190,6 +210,7 @@ BENCHMARK_DEFINE_F(BitmaskDynamicFixture, FindPredicate)(benchmark::State& state
             owned.emplace_back(std::make_unique<BenchmarkTestData>(seed));
             table->set(idx.value(), owned.back().get());
         }
+        perf.resume();
         state.ResumeTiming();
 
         const bool found = table->find([&](const BenchmarkTestData* ptr) {
@@ -205,6 +226,7 @@ BENCHMARK_DEFINE_F(BitmaskDynamicFixture, FindPredicate)(benchmark::State& state
 // Emplace-return pair path with release
 BENCHMARK_DEFINE_F(BitmaskDynamicFixture, EmplaceReturn)(benchmark::State& state) {
     BenchmarkTestData payload(17);
+    Perf::Scope perf(state);
     for (auto _ : state) {
         auto idx = table->acquire();
         benchmark::DoNotOptimize(idx);
@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "BitmaskTable.hpp"
+#include "PerfCounters.hpp"
 
 using namespace HazardSystem;
 
@@ -52,6 +53,8 @@ BENCHMARK_DEFINE_F(BitmaskFixedFixture, AcquireRelease)(benchmark::State& state)
     std::vector<FixedTable::IndexType> held;
     held.reserve(table.capacity());
 
+    Perf::Scope perf(state);
+
     for (auto _ : state) {
         auto idx = table.acquire();
         benchmark::DoNotOptimize(idx);
@@ -82,8 +85,11 @@ BENCHMARK_DEFINE_F(BitmaskFixedFixture, IterateActive)(benchmark::State& state)
     std::vector<std::unique_ptr<BenchmarkTestData>> owned;
     owned.reserve(table.capacity());
 
+    Perf::Scope perf(state);
+
     for (auto _ : state) {
         state.PauseTiming();
+        perf.pause();
         table.clear();
         owned.clear();
         for (size_t i = 0; i < to_fill; ++i) {
@@ -92,6 +98,7 @@ BENCHMARK_DEFINE_F(BitmaskFixedFixture, IterateActive)(benchmark::State& state)
             owned.emplace_back(std::make_unique<BenchmarkTestData>(static_cast<int>(i)));
             table.set(idx.value(), owned.back().get());
         }
+        perf.resume();
         state.ResumeTiming();
 
         size_t visited = 0;
@@ -111,8 +118,11 @@ BENCHMARK_DEFINE_F(BitmaskFixedFixture, IterateActive)(benchmark::State& state)
 BENCHMARK_DEFINE_F(BitmaskFixedFixture, Clear)(benchmark::State& state) {
     auto payload = std::make_unique<BenchmarkTestData>(7);
 
+    Perf::Scope perf(state);
+
     for (auto _ : state) {
         state.PauseTiming();
+        perf.pause();
         table.clear();
         for (size_t i = 0; i < table.capacity(); ++i) {
             auto idx = table.acquire();
@@ -121,6 +131,7 @@ BENCHMARK_DEFINE_F(BitmaskFixedFixture, Clear)(benchmark::State& state) {
             }
             table.set(idx.value(), payload.get());
         }
+        perf.resume();
         state.ResumeTiming();
 
         table.clear();
@@ -135,6 +146,8 @@ BENCHMARK_DEFINE_F(BitmaskFixedFixture, Clear)(benchmark::State& state) {
 BENCHMARK_DEFINE_F(BitmaskFixedFixture, AcquireIteratorSet)(benchmark::State& state) {
     auto payload = std::make_unique<BenchmarkTestData>(3);
 
+    Perf::Scope perf(state);
+
     for (auto _ : state) {
         auto it = table.acquire_iterator();
         benchmark::DoNotOptimize(it);
@@ -155,8 +168,10 @@ BENCHMARK_DEFINE_F(BitmaskFixedFixture, ActiveChecks)(benchmark::State& state) {
     const size_t fill_count = static_cast<size_t>(std::min<int64_t>(state.range(0), table.capacity()));
     std::vector<std::unique_ptr<BenchmarkTestData>> owned;
     owned.reserve(table.capacity());
+    Perf::Scope perf(state);
     for (auto _ : state) {
         state.PauseTiming();
+        perf.pause();
         table.clear();
         owned.clear();
         for (size_t i = 0; i < fill_count; ++i) {
@@ -165,6 +180,7 @@ BENCHMARK_DEFINE_F(BitmaskFixedFixture, ActiveChecks)(benchmark::State& state) {
             owned.emplace_back(std::make_unique<BenchmarkTestData>(static_cast<int>(i)));
             table.set(idx.value(), owned.back().get());
         }
+        perf.resume();
         state.ResumeTiming();
 
         size_t hits = 0;
@@ -189,8 +205,11 @@ BENCHMARK_DEFINE_F(BitmaskFixedFixture, FindPredicate)(benchmark::State& state)
     std::vector<std::unique_ptr<BenchmarkTestData>> owned;
     owned.reserve(table.capacity());
 
+    Perf::Scope perf(state);
+
     for (auto _ : state) {
         state.PauseTiming();
+        perf.pause();
         table.clear();
         owned.clear();
         // Fill all slots; place a unique seed in the last slot to force scanning
@@ -201,6 +220,7 @@ BENCHMARK_DEFINE_F(BitmaskFixedFixture, FindPredicate)(benchmark::State& state)
             owned.emplace_back(std::make_unique<BenchmarkTestData>(seed));
             table.set(idx.value(), owned.back().get());
         }
+        perf.resume();
         state.ResumeTiming();
 
         const bool found = table.find([&](const BenchmarkTestData* ptr) {
@@ -216,6 +236,7 @@ BENCHMARK_DEFINE_F(BitmaskFixedFixture, FindPredicate)(benchmark::State& state)
 // Emplace with return pair then release to keep table available
 BENCHMARK_DEFINE_F(BitmaskFixedFixture, EmplaceReturn)(benchmark::State& state) {
     BenchmarkTestData payload(9);
+    Perf::Scope perf(state);
     for (auto _ : state) {
         auto idx = table.acquire();
         benchmark::DoNotOptimize(idx);
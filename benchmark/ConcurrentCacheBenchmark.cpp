@@ -0,0 +1,138 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "ConcurrentCache.hpp"
+#include "PerfCounters.hpp"
+
+using namespace HazardSystem;
+
+// Read-through cache traffic over a Zipf(0.99) key stream: get, and put on a
+// miss. Compares the CLOCK ConcurrentCache with the HashTable + mutex-guarded
+// LRU list it replaces. hit_ratio is averaged over threads.
+
+static constexpr uint64_t C_KEYS    = 100000;
+static constexpr size_t   C_STREAM  = 1UL << 20;
+
+static const std::vector<uint64_t>& zipf_stream(void) {
+    static const std::vector<uint64_t> stream = [] {
+        std::vector<double> cdf(C_KEYS);
+        double sum = 0.0;
+        for (uint64_t k = 0; k < C_KEYS; ++k) {
+            sum   += 1.0 / std::pow(static_cast<double>(k + 1), 0.99);
+            cdf[k] = sum;
+        }
+        std::mt19937_64 rng(7);
+        std::uniform_real_distribution<double> uniform(0.0, sum);
+        std::vector<uint64_t> keys(C_STREAM);
+        for (auto& key : keys) {
+            key = static_cast<uint64_t>(std::lower_bound(cdf.begin(), cdf.end(), uniform(rng)) - cdf.begin());
+        }
+        return keys;
+    }();
+    return stream;
+}
+
+// Baseline: lookup table plus an LRU list, all behind one mutex.
+class LockedLru {
+    public:
+        explicit LockedLru(size_t capacity, size_t = 0) : m_capacity(capacity) {}
+        std::optional<uint64_t> get(uint64_t key) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto it = m_map.find(key);
+            if (it == m_map.end()) {
+                return std::nullopt;
+            }
+            m_lru.splice(m_lru.begin(), m_lru, it->second);
+            return it->second->second;
+        }
+        void put(uint64_t key, uint64_t value) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto it = m_map.find(key);
+            if (it != m_map.end()) {
+                it->second->second = value;
+                m_lru.splice(m_lru.begin(), m_lru, it->second);
+                return;
+            }
+            if (m_map.size() == m_capacity) {
+                m_map.erase(m_lru.back().first);
+                m_lru.pop_back();
+            }
+            m_lru.emplace_front(key, value);
+            m_map.emplace(key, m_lru.begin());
+        }
+    private:
+        using List = std::list<std::pair<uint64_t, uint64_t>>;
+        const size_t m_capacity;
+        std::mutex m_mutex;
+        List m_lru;
+        std::unordered_map<uint64_t, List::iterator> m_map;
+};
+
+using Clock = ConcurrentCache<uint64_t, uint64_t, 1UL << 16>;
+
+template <typename Cache>
+static std::unique_ptr<Cache>& shared_cache(void) {
+    static std::unique_ptr<Cache> cache;
+    return cache;
+}
+
+template <typename Cache>
+static void BM_Cache_ReadThrough(benchmark::State& state) {
+    const size_t capacity = static_cast<size_t>(state.range(0));
+    auto& cache           = shared_cache<Cache>();
+    if (state.thread_index() == 0) {
+        cache = std::make_unique<Cache>(capacity, static_cast<size_t>(state.threads()));
+    }
+
+    const auto& stream = zipf_stream();
+    size_t cursor      = (C_STREAM / static_cast<size_t>(state.threads())) * static_cast<size_t>(state.thread_index());
+    int64_t hits = 0, misses = 0;
+
+    Perf::Scope perf(state, 1.0);
+    for (auto _ : state) {
+        const uint64_t key = stream[cursor];
+        cursor             = (cursor + 1) & (C_STREAM - 1);
+        if (auto value = cache->get(key)) {
+            benchmark::DoNotOptimize(*value);
+            ++hits;
+        } else {
+            cache->put(key, key);
+            ++misses;
+        }
+    }
+
+    state.SetItemsProcessed(hits + misses);
+    state.counters["hit_ratio"] = benchmark::Counter(static_cast<double>(hits) / static_cast<double>(std::max<int64_t>(1, hits + misses)),
+                                                     benchmark::Counter::kAvgThreads);
+}
+
+static void CacheSizes(benchmark::internal::Benchmark* b) {
+    for (int64_t capacity : {1000, 10000}) {
+        b->Arg(capacity);
+    }
+    b->ArgName("capacity");
+}
+
+BENCHMARK_TEMPLATE(BM_Cache_ReadThrough, Clock)->Apply(CacheSizes)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Cache_ReadThrough, LockedLru)->Apply(CacheSizes)->ThreadRange(1, 16)->UseRealTime();
+
+int main(int argc, char** argv) {
+    std::cout << "Read-through cache, Zipf(0.99) over " << C_KEYS << " keys: CLOCK ConcurrentCache vs mutex LRU\n";
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,178 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include "ConcurrentPriorityQueue.hpp"
+#include "PerfCounters.hpp"
+
+using namespace HazardSystem;
+
+// 50/50 push/pop mix at 1-64 threads on a queue prefilled with 4096 entries,
+// against std::priority_queue behind a mutex. The Batch variants pop 16
+// entries per call; items count every entry pushed or popped.
+
+using Entry = std::pair<uint64_t, uint64_t>;
+
+class LockedPriorityQueue {
+    public:
+        void push(const uint64_t& key, const uint64_t& value) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_queue.emplace(key, value);
+        }
+
+        std::optional<Entry> pop(void) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_queue.empty()) {
+                return std::nullopt;
+            }
+            Entry top = m_queue.top();
+            m_queue.pop();
+            return top;
+        }
+
+        size_t pop_batch(std::vector<Entry>& out, const size_t& count) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            size_t taken = 0;
+            for (; taken < count && !m_queue.empty(); ++taken) {
+                out.push_back(m_queue.top());
+                m_queue.pop();
+            }
+            return taken;
+        }
+
+    private:
+        std::mutex m_mutex;
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> m_queue;
+};
+
+static constexpr uint64_t C_PREFILL = 4096;
+static constexpr size_t C_BATCH     = 16;
+
+static ConcurrentPriorityQueue<uint64_t, uint64_t>* g_lock_free = nullptr;
+static LockedPriorityQueue* g_locked                            = nullptr;
+
+static uint64_t next_key(uint64_t& state) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state % (C_PREFILL * 16);
+}
+
+template <typename Queue>
+static void prefill(Queue& queue) {
+    uint64_t state = 88172645463325252ULL;
+    for (uint64_t i = 0; i < C_PREFILL; ++i) {
+        queue.push(next_key(state), i);
+    }
+}
+
+static void BM_ConcurrentPriorityQueue_Mixed(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        g_lock_free = new ConcurrentPriorityQueue<uint64_t, uint64_t>();
+        prefill(*g_lock_free);
+    }
+    uint64_t rng = 0x9E3779B97F4A7C15ULL + static_cast<uint64_t>(state.thread_index());
+
+    Perf::Scope perf(state, 2.0);
+    for (auto _ : state) {
+        g_lock_free->push(next_key(rng), 0);
+        benchmark::DoNotOptimize(g_lock_free->pop());
+    }
+
+    state.SetItemsProcessed(state.iterations() * 2);
+    if (state.thread_index() == 0) {
+        delete g_lock_free;
+        g_lock_free = nullptr;
+    }
+}
+
+static void BM_LockedPriorityQueue_Mixed(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        g_locked = new LockedPriorityQueue();
+        prefill(*g_locked);
+    }
+    uint64_t rng = 0x9E3779B97F4A7C15ULL + static_cast<uint64_t>(state.thread_index());
+
+    Perf::Scope perf(state, 2.0);
+    for (auto _ : state) {
+        g_locked->push(next_key(rng), 0);
+        benchmark::DoNotOptimize(g_locked->pop());
+    }
+
+    state.SetItemsProcessed(state.iterations() * 2);
+    if (state.thread_index() == 0) {
+        delete g_locked;
+        g_locked = nullptr;
+    }
+}
+
+static void BM_ConcurrentPriorityQueue_Batch(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        g_lock_free = new ConcurrentPriorityQueue<uint64_t, uint64_t>();
+        prefill(*g_lock_free);
+    }
+    uint64_t rng = 0x9E3779B97F4A7C15ULL + static_cast<uint64_t>(state.thread_index());
+    std::vector<Entry> out;
+    out.reserve(C_BATCH);
+
+    Perf::Scope perf(state, 2.0 * C_BATCH);
+    for (auto _ : state) {
+        for (size_t i = 0; i < C_BATCH; ++i) {
+            g_lock_free->push(next_key(rng), 0);
+        }
+        out.clear();
+        benchmark::DoNotOptimize(g_lock_free->pop_batch(out, C_BATCH));
+    }
+
+    state.SetItemsProcessed(state.iterations() * 2 * C_BATCH);
+    if (state.thread_index() == 0) {
+        delete g_lock_free;
+        g_lock_free = nullptr;
+    }
+}
+
+static void BM_LockedPriorityQueue_Batch(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        g_locked = new LockedPriorityQueue();
+        prefill(*g_locked);
+    }
+    uint64_t rng = 0x9E3779B97F4A7C15ULL + static_cast<uint64_t>(state.thread_index());
+    std::vector<Entry> out;
+    out.reserve(C_BATCH);
+
+    Perf::Scope perf(state, 2.0 * C_BATCH);
+    for (auto _ : state) {
+        for (size_t i = 0; i < C_BATCH; ++i) {
+            g_locked->push(next_key(rng), 0);
+        }
+        out.clear();
+        benchmark::DoNotOptimize(g_locked->pop_batch(out, C_BATCH));
+    }
+
+    state.SetItemsProcessed(state.iterations() * 2 * C_BATCH);
+    if (state.thread_index() == 0) {
+        delete g_locked;
+        g_locked = nullptr;
+    }
+}
+
+BENCHMARK(BM_ConcurrentPriorityQueue_Mixed)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(BM_LockedPriorityQueue_Mixed)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(BM_ConcurrentPriorityQueue_Batch)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(BM_LockedPriorityQueue_Batch)->ThreadRange(1, 64)->UseRealTime();
+
+int main(int argc, char** argv) {
+    std::cout << "ConcurrentPriorityQueue: Linden-Jonsson skiplist vs mutex std::priority_queue, single and batched pops\n";
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
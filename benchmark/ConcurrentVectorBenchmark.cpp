@@ -0,0 +1,126 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "ConcurrentVector.hpp"
+#include "PerfCounters.hpp"
+
+using namespace HazardSystem;
+
+using Segmented  = ConcurrentVector<uint64_t, VectorLayout::Segmented>;
+using Contiguous = ConcurrentVector<uint64_t, VectorLayout::Contiguous>;
+
+// Baseline: std::vector behind a mutex, the usual answer before a concurrent one.
+class LockedVector {
+    public:
+        explicit LockedVector(size_t capacity) {
+            m_data.reserve(capacity);
+        }
+        size_t push_back(uint64_t value) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_data.push_back(value);
+            return m_data.size() - 1;
+        }
+        std::optional<uint64_t> get(size_t index) const {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return index < m_data.size() ? std::optional<uint64_t>(m_data[index]) : std::nullopt;
+        }
+    private:
+        mutable std::mutex m_mutex;
+        std::vector<uint64_t> m_data;
+};
+
+// Single writer filling a fresh vector from a small first block, so every
+// doubling is on the clock: Contiguous pays the copy, Segmented does not.
+template <typename Vector>
+static void BM_ConcurrentVector_Fill(benchmark::State& state) {
+    const int64_t items = state.range(0);
+
+    Perf::Scope perf(state, static_cast<double>(items));
+    for (auto _ : state) {
+        Vector vector(16);
+        for (int64_t i = 0; i < items; ++i) {
+            vector.push_back(static_cast<uint64_t>(i));
+        }
+        benchmark::DoNotOptimize(vector.size());
+    }
+
+    state.SetItemsProcessed(state.iterations() * items);
+}
+
+// Indexed reads of a filled vector.
+template <typename Vector>
+static void BM_ConcurrentVector_Read(benchmark::State& state) {
+    const int64_t items = state.range(0);
+    Vector vector(16);
+    for (int64_t i = 0; i < items; ++i) {
+        vector.push_back(static_cast<uint64_t>(i));
+    }
+
+    Perf::Scope perf(state, static_cast<double>(items));
+    for (auto _ : state) {
+        uint64_t sum = 0;
+        for (int64_t i = 0; i < items; ++i) {
+            sum += vector.get(static_cast<size_t>(i)).value_or(0);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * items);
+}
+
+// Half the threads append, half read random indices (misses past the end
+// return empty).
+template <typename Vector>
+static std::unique_ptr<Vector>& shared_vector(void) {
+    static std::unique_ptr<Vector> vector;
+    return vector;
+}
+
+template <typename Vector>
+static void BM_ConcurrentVector_Mixed(benchmark::State& state) {
+    auto& vector = shared_vector<Vector>();
+    if (state.thread_index() == 0) {
+        vector = std::make_unique<Vector>(1024);
+        vector->push_back(0);
+    }
+
+    const bool writer = (state.thread_index() % 2) == 0;
+    uint64_t x        = 0x9E3779B97F4A7C15ULL * static_cast<uint64_t>(state.thread_index() + 1);
+    int64_t ops       = 0;
+    for (auto _ : state) {
+        if (writer) {
+            vector->push_back(static_cast<uint64_t>(ops));
+        } else {
+            x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+            benchmark::DoNotOptimize(vector->get(static_cast<size_t>(x % (static_cast<uint64_t>(ops) + 1))));
+        }
+        ++ops;
+    }
+
+    state.SetItemsProcessed(ops);
+}
+
+BENCHMARK_TEMPLATE(BM_ConcurrentVector_Fill, Segmented)->RangeMultiplier(16)->Range(256, 1 << 20);
+BENCHMARK_TEMPLATE(BM_ConcurrentVector_Fill, Contiguous)->RangeMultiplier(16)->Range(256, 1 << 20);
+BENCHMARK_TEMPLATE(BM_ConcurrentVector_Read, Segmented)->RangeMultiplier(16)->Range(256, 1 << 20);
+BENCHMARK_TEMPLATE(BM_ConcurrentVector_Read, Contiguous)->RangeMultiplier(16)->Range(256, 1 << 20);
+BENCHMARK_TEMPLATE(BM_ConcurrentVector_Read, LockedVector)->RangeMultiplier(16)->Range(256, 1 << 20);
+BENCHMARK_TEMPLATE(BM_ConcurrentVector_Mixed, Segmented)->ThreadRange(2, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ConcurrentVector_Mixed, Contiguous)->ThreadRange(2, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ConcurrentVector_Mixed, LockedVector)->ThreadRange(2, 16)->UseRealTime();
+
+int main(int argc, char** argv) {
+    std::cout << "ConcurrentVector: segmented vs contiguous growth vs mutex-guarded std::vector\n";
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
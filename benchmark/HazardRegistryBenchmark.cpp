@@ -1,6 +1,7 @@
 #include <benchmark/benchmark.h>
 #include <vector>
 #include "HazardRegistry.hpp"
+#include "PerfCounters.hpp"
 
 using namespace HazardSystem;
 
@@ -14,6 +15,7 @@ static void BM_HazardRegistry_AddRemove(benchmark::State& state) {
         ptrs[i]  = &items[i];
     }
 
+    Perf::Scope perf(state, static_cast<double>(hazards * 2));
     for (auto _ : state) {
         for (auto* p : ptrs) {
             benchmark::DoNotOptimize(registry.add(p));
@@ -38,6 +40,7 @@ static void BM_HazardRegistry_Contains(benchmark::State& state) {
         registry.add(ptrs[i]);
     }
 
+    Perf::Scope perf(state, static_cast<double>(hazards));
     for (auto _ : state) {
         for (auto* p : ptrs) {
             benchmark::DoNotOptimize(registry.contains(p));
@@ -59,6 +62,7 @@ static void BM_HazardRegistry_Contains_Contended(benchmark::State& state) {
         registry.add(ptrs[i]);
     }
 
+    Perf::Scope perf(state, static_cast<double>(hazards));
     for (auto _ : state) {
         size_t idx = 0;
         for (auto* p : ptrs) {
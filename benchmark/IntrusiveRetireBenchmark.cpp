@@ -0,0 +1,71 @@
+#include <benchmark/benchmark.h>
+#include <iostream>
+
+#include "HazardPointerManager.hpp"
+#include "HazardObject.hpp"
+
+using namespace HazardSystem;
+
+struct MapNode {
+    explicit MapNode(int v = 0) : value(v) {}
+    int value;
+};
+
+struct IntrusiveNode : hazard_obj_base<IntrusiveNode> {
+    explicit IntrusiveNode(int v = 0) : value(v) {}
+    int value;
+};
+
+// Both variants allocate the node itself; the difference is the per-retire
+// bookkeeping: an unordered_map entry plus Deleter for MapNode, a pointer
+// link for IntrusiveNode.
+template <typename Node>
+static void BM_RetireNew(benchmark::State& state) {
+    auto& manager = HazardPointerManager<Node, 0>::instance(64, static_cast<size_t>(state.range(0)));
+    int value = 0;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(manager.retire(new Node(++value)));
+    }
+
+    manager.reclaim_all();
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Retire a node that stays protected, so every scan keeps it and the list
+// has to carry survivors.
+template <typename Node>
+static void BM_RetireWithProtectedSurvivor(benchmark::State& state) {
+    auto& manager = HazardPointerManager<Node, 0>::instance(64, static_cast<size_t>(state.range(0)));
+    auto* pinned  = new Node(-1);
+    auto guard    = manager.protect(pinned);
+    manager.retire(pinned);
+    int value = 0;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(manager.retire(new Node(++value)));
+    }
+
+    guard.reset();
+    manager.reclaim_all();
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_RetireNew, MapNode)->Arg(8)->Arg(64);
+BENCHMARK_TEMPLATE(BM_RetireNew, IntrusiveNode)->Arg(8)->Arg(64);
+BENCHMARK_TEMPLATE(BM_RetireWithProtectedSurvivor, MapNode)->Arg(8)->Arg(64);
+BENCHMARK_TEMPLATE(BM_RetireWithProtectedSurvivor, IntrusiveNode)->Arg(8)->Arg(64);
+
+int main(int argc, char** argv) {
+    ::benchmark::Initialize(&argc, argv);
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+
+    std::cout << "=== Intrusive vs RetireMap Retire Benchmark ===\n";
+    std::cout << "Arg is the retire threshold factor passed to instance().\n\n";
+
+    ::benchmark::RunSpecifiedBenchmarks();
+    ::benchmark::Shutdown();
+    return 0;
+}
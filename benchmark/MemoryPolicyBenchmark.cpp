@@ -0,0 +1,110 @@
+#include <benchmark/benchmark.h>
+#include <array>
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "BitmaskTable.hpp"
+#include "HazardRegistry.hpp"
+#include "MemoryPolicy.hpp"
+#include "PerfCounters.hpp"
+
+using namespace HazardSystem;
+
+// Scan cost of the slot arrays under each placement policy. Large tables span
+// many 4K pages, so the linear BitmaskTable scan and the random HazardRegistry
+// probes are where huge pages (fewer TLB misses) should show up.
+
+static const std::array<std::pair<const char*, MemoryPolicy>, 4> C_POLICIES{{
+    {"default",          MemoryPolicy{}},
+    {"huge",             MemoryPolicy::huge_pages()},
+    {"interleave",       MemoryPolicy::interleave()},
+    {"huge+interleave",  MemoryPolicy::interleave(PagePolicy::HugePages)},
+}};
+
+static const MemoryPolicy& policy_of(benchmark::State& state) {
+    const auto& entry = C_POLICIES.at(static_cast<size_t>(state.range(0)));
+    state.SetLabel(entry.first);
+    return entry.second;
+}
+
+static void BM_BitmaskTable_Scan(benchmark::State& state) {
+    const MemoryPolicy& policy = policy_of(state);
+    const size_t slots         = static_cast<size_t>(state.range(1));
+
+    BitmaskTable<int, 0> table(slots, policy);
+    std::vector<int> items(table.capacity());
+    for (auto& item : items) {
+        if (!table.set(&item)) {
+            state.SkipWithError("table filled early");
+            return;
+        }
+    }
+
+    Perf::Scope perf(state, static_cast<double>(table.capacity()));
+    for (auto _ : state) {
+        size_t seen = 0;
+        table.for_each([&seen](size_t, int* ptr) {
+            seen += (ptr != nullptr);
+        });
+        benchmark::DoNotOptimize(seen);
+    }
+
+    state.SetItemsProcessed(state.iterations() * table.capacity());
+}
+
+static void BM_HazardRegistry_Probe(benchmark::State& state) {
+    const MemoryPolicy& policy = policy_of(state);
+    const size_t hazards       = static_cast<size_t>(state.range(1));
+
+    HazardRegistry<int> registry(hazards, policy);
+    std::vector<int> items(hazards);
+    for (auto& item : items) {
+        registry.add(&item);
+    }
+
+    // Random order so consecutive probes land on unrelated pages.
+    std::vector<int*> probes(hazards);
+    for (size_t i = 0; i < hazards; ++i) {
+        probes[i] = &items[i];
+    }
+    std::shuffle(probes.begin(), probes.end(), std::mt19937_64(42));
+
+    Perf::Scope perf(state, static_cast<double>(hazards));
+    for (auto _ : state) {
+        size_t hits = 0;
+        for (auto* p : probes) {
+            hits += registry.contains(p);
+        }
+        benchmark::DoNotOptimize(hits);
+    }
+
+    state.SetItemsProcessed(state.iterations() * hazards);
+}
+
+static void PolicyArgs(benchmark::internal::Benchmark* b) {
+    for (int64_t policy = 0; policy < static_cast<int64_t>(C_POLICIES.size()); ++policy) {
+        for (int64_t size = 4096; size <= (1 << 20); size *= 16) {
+            b->Args({policy, size});
+        }
+    }
+    b->ArgNames({"policy", "slots"});
+}
+
+BENCHMARK(BM_BitmaskTable_Scan)->Apply(PolicyArgs);
+BENCHMARK(BM_HazardRegistry_Probe)->Apply(PolicyArgs);
+
+int main(int argc, char** argv) {
+    std::cout << "Slot array placement: default vs huge pages vs NUMA interleave\n";
+    std::cout << "Huge pages fall back to THP (madvise) when no hugetlb pages are reserved.\n";
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+//--------------------------------------------------------------
+// Michael-Scott queue used as the general MPMC baseline by the queue and
+// ring benchmarks. It allocates one node per push and protects head/next
+// with HazardPointerManager on pop, retiring the old dummy head.
+//--------------------------------------------------------------
+// Standard cpp library
+//--------------------------------------------------------------
+#include <atomic>
+#include <cstdint>
+//--------------------------------------------------------------
+// User Defined Headers
+//--------------------------------------------------------------
+#include "HazardPointerManager.hpp"
+//--------------------------------------------------------------
+
+class MichaelScottQueue {
+    public:
+        struct Node {
+            uint64_t value;
+            std::atomic<Node*> next{nullptr};
+        };
+        using Manager = HazardSystem::HazardPointerManager<Node, 0>;
+
+        MichaelScottQueue(void) : m_manager(Manager::instance(64)) {
+            Node* dummy = new Node{0};
+            m_head.store(dummy);
+            m_tail.store(dummy);
+        }
+
+        ~MichaelScottQueue(void) {
+            Node* node = m_head.load();
+            while (node) {
+                Node* next = node->next.load();
+                delete node;
+                node = next;
+            }
+            m_manager.reclaim_all();
+        }
+
+        void push(const uint64_t& value) {
+            Node* node = new Node{value};
+            while (true) {
+                Node* tail = m_tail.load(std::memory_order_acquire);
+                auto guard = m_manager.protect(tail);
+                if (!guard || m_tail.load(std::memory_order_acquire) != tail) {
+                    continue;
+                }
+                Node* next = tail->next.load(std::memory_order_acquire);
+                if (next) {
+                    m_tail.compare_exchange_weak(tail, next, std::memory_order_release, std::memory_order_relaxed);
+                    continue;
+                }
+                if (tail->next.compare_exchange_weak(next, node, std::memory_order_release, std::memory_order_relaxed)) {
+                    m_tail.compare_exchange_strong(tail, node, std::memory_order_release, std::memory_order_relaxed);
+                    return;
+                }
+            }
+        }
+
+        bool pop(uint64_t& out) {
+            while (true) {
+                Node* head  = m_head.load(std::memory_order_acquire);
+                auto h_hold = m_manager.protect(head);
+                if (!h_hold || m_head.load(std::memory_order_acquire) != head) {
+                    continue;
+                }
+                Node* next = head->next.load(std::memory_order_acquire);
+                if (!next) {
+                    return false;
+                }
+                auto n_hold = m_manager.protect(next);
+                if (!n_hold || m_head.load(std::memory_order_acquire) != head) {
+                    continue;
+                }
+                Node* tail = m_tail.load(std::memory_order_acquire);
+                if (head == tail) {
+                    m_tail.compare_exchange_weak(tail, next, std::memory_order_release, std::memory_order_relaxed);
+                    continue;
+                }
+                out = next->value;
+                if (m_head.compare_exchange_strong(head, next, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                    h_hold.reset();
+                    m_manager.retire(head);
+                    return true;
+                }
+            }
+        }
+
+    private:
+        Manager& m_manager;
+        alignas(64) std::atomic<Node*> m_head;
+        alignas(64) std::atomic<Node*> m_tail;
+};
@@ -0,0 +1,181 @@
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "HazardPointerManager.hpp"
+#include "MpmcRing.hpp"
+#include "MichaelScottQueue.hpp"
+#include "PerfCounters.hpp"
+
+using namespace HazardSystem;
+
+// P producers push 16384 values each while P consumers drain them. MpmcRing
+// runs at a fixed 4096 cells, one item or 32 at a time, and from 64 cells
+// with producers doubling it whenever a push finds it full (each doubling
+// retires a segment). The baseline is the Michael-Scott queue: one node
+// allocated per push, head/next protected with HazardPointerManager on pop.
+// Items are values delivered.
+
+static constexpr int64_t C_PER_PRODUCER = 16384;
+static constexpr size_t C_BATCH         = 32;
+
+// setup() runs before each iteration's threads start; push(p, i) must
+// deliver the value before returning; drain() returns how many it took,
+// possibly 0.
+template <typename Setup, typename Push, typename Drain>
+static void run_transfer(benchmark::State& state, Setup&& setup, Push&& push, Drain&& drain) {
+    const int64_t pairs = state.range(0);
+    const int64_t total = pairs * C_PER_PRODUCER;
+
+    Perf::Scope perf(state, static_cast<double>(total));
+    for (auto _ : state) {
+        setup();
+        std::atomic<int64_t> received{0};
+        std::vector<std::thread> threads;
+        for (int64_t p = 0; p < pairs; ++p) {
+            threads.emplace_back([&, p] {
+                for (int64_t i = 0; i < C_PER_PRODUCER; ++i) {
+                    push(p, i);
+                }
+            });
+            threads.emplace_back([&] {
+                while (received.load(std::memory_order_relaxed) < total) {
+                    const int64_t got = drain();
+                    if (got == 0) {
+                        std::this_thread::yield();
+                    } else {
+                        received.fetch_add(got, std::memory_order_relaxed);
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * total);
+}
+
+static void BM_MpmcRing_Transfer(benchmark::State& state) {
+    MpmcRing<uint64_t> ring(4096);
+    std::atomic<uint64_t> sum{0};
+
+    run_transfer(state,
+                 [] {},
+                 [&](int64_t, int64_t i) {
+                     while (!ring.try_push(static_cast<uint64_t>(i))) {
+                         std::this_thread::yield();
+                     }
+                 },
+                 [&]() {
+                     auto value = ring.try_pop();
+                     if (!value) {
+                         return int64_t{0};
+                     }
+                     sum.fetch_add(*value, std::memory_order_relaxed);
+                     return int64_t{1};
+                 });
+    benchmark::DoNotOptimize(sum.load());
+}
+
+static void BM_MpmcRing_TransferBatch(benchmark::State& state) {
+    MpmcRing<uint64_t> ring(4096);
+    std::atomic<uint64_t> sum{0};
+
+    run_transfer(state,
+                 [] {},
+                 [&](int64_t, int64_t i) {
+                     // One call per C_BATCH values; the rest are no-ops.
+                     if (i % static_cast<int64_t>(C_BATCH) != 0) {
+                         return;
+                     }
+                     uint64_t batch[C_BATCH];
+                     for (size_t j = 0; j < C_BATCH; ++j) {
+                         batch[j] = static_cast<uint64_t>(i) + j;
+                     }
+                     size_t pushed = 0;
+                     while (pushed < C_BATCH) {
+                         pushed += ring.push_batch(batch + pushed, batch + C_BATCH);
+                         if (pushed < C_BATCH) {
+                             std::this_thread::yield();
+                         }
+                     }
+                 },
+                 [&]() {
+                     thread_local std::vector<uint64_t> out;
+                     out.clear();
+                     const size_t got = ring.pop_batch(out, C_BATCH);
+                     uint64_t local   = 0;
+                     for (uint64_t value : out) {
+                         local += value;
+                     }
+                     sum.fetch_add(local, std::memory_order_relaxed);
+                     return static_cast<int64_t>(got);
+                 });
+    benchmark::DoNotOptimize(sum.load());
+}
+
+static void BM_MpmcRing_TransferGrowing(benchmark::State& state) {
+    std::atomic<uint64_t> sum{0};
+    std::unique_ptr<MpmcRing<uint64_t>> ring;
+
+    // A fresh 64-cell ring per iteration so every run pays for its grows.
+    run_transfer(state,
+                 [&] { ring = std::make_unique<MpmcRing<uint64_t>>(64); },
+                 [&](int64_t, int64_t i) {
+                     while (!ring->try_push(static_cast<uint64_t>(i))) {
+                         const size_t capacity = ring->capacity();
+                         if (capacity >= 65536 || !ring->grow(capacity * 2)) {
+                             std::this_thread::yield();
+                         }
+                     }
+                 },
+                 [&]() {
+                     auto value = ring->try_pop();
+                     if (!value) {
+                         return int64_t{0};
+                     }
+                     sum.fetch_add(*value, std::memory_order_relaxed);
+                     return int64_t{1};
+                 });
+    benchmark::DoNotOptimize(sum.load());
+}
+
+static void BM_MichaelScottQueue_Transfer(benchmark::State& state) {
+    MichaelScottQueue queue;
+    std::atomic<uint64_t> sum{0};
+
+    run_transfer(state,
+                 [] {},
+                 [&](int64_t, int64_t i) { queue.push(static_cast<uint64_t>(i)); },
+                 [&]() {
+                     uint64_t value;
+                     if (!queue.pop(value)) {
+                         return int64_t{0};
+                     }
+                     sum.fetch_add(value, std::memory_order_relaxed);
+                     return int64_t{1};
+                 });
+    benchmark::DoNotOptimize(sum.load());
+}
+
+BENCHMARK(BM_MpmcRing_Transfer)->RangeMultiplier(2)->Range(1, 4)->UseRealTime();
+BENCHMARK(BM_MpmcRing_TransferBatch)->RangeMultiplier(2)->Range(1, 4)->UseRealTime();
+BENCHMARK(BM_MpmcRing_TransferGrowing)->RangeMultiplier(2)->Range(1, 4)->UseRealTime();
+BENCHMARK(BM_MichaelScottQueue_Transfer)->RangeMultiplier(2)->Range(1, 4)->UseRealTime();
+
+int main(int argc, char** argv) {
+    std::cout << "MpmcRing: segmented Vyukov ring vs hazard-protected Michael-Scott queue\n";
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,170 @@
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "HazardPointerManager.hpp"
+#include "MpscQueue.hpp"
+#include "MichaelScottQueue.hpp"
+#include "PerfCounters.hpp"
+
+using namespace HazardSystem;
+
+// Mailbox pattern: P producers push 4096 messages each, one consumer drains
+// them. MpscQueue links preallocated messages (no allocation, no hazards);
+// the general MPMC baseline is a Michael-Scott queue that allocates a node per
+// push and protects head/next with HazardPointerManager on pop, and the last
+// baseline is a mutex std::deque. Items are messages delivered.
+
+static constexpr int64_t C_PER_PRODUCER = 4096;
+
+struct Message : mpsc_hook {
+    uint64_t value = 0;
+};
+
+class LockedQueue {
+    public:
+        void push(const uint64_t& value) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_queue.push_back(value);
+        }
+
+        bool pop(uint64_t& out) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_queue.empty()) {
+                return false;
+            }
+            out = m_queue.front();
+            m_queue.pop_front();
+            return true;
+        }
+
+    private:
+        std::mutex m_mutex;
+        std::deque<uint64_t> m_queue;
+};
+
+template <typename Push, typename Drain>
+static void run_mailbox(benchmark::State& state, Push&& push, Drain&& drain) {
+    const int64_t producers = state.range(0);
+    const int64_t total     = producers * C_PER_PRODUCER;
+
+    Perf::Scope perf(state, static_cast<double>(total));
+    for (auto _ : state) {
+        std::vector<std::thread> threads;
+        for (int64_t p = 0; p < producers; ++p) {
+            threads.emplace_back([&, p] {
+                for (int64_t i = 0; i < C_PER_PRODUCER; ++i) {
+                    push(p, i);
+                }
+            });
+        }
+        int64_t received = 0;
+        while (received < total) {
+            const int64_t got = drain();
+            if (got == 0) {
+                std::this_thread::yield();
+            }
+            received += got;
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * total);
+}
+
+static void BM_MpscQueue_Mailbox(benchmark::State& state) {
+    MpscQueue<Message> queue;
+    std::vector<std::vector<Message>> messages(static_cast<size_t>(state.range(0)), std::vector<Message>(C_PER_PRODUCER));
+    uint64_t sum = 0;
+
+    run_mailbox(state,
+                [&](int64_t p, int64_t i) { queue.push(&messages[p][i]); },
+                [&]() {
+                    int64_t got = 0;
+                    while (Message* message = queue.pop()) {
+                        sum += message->value;
+                        ++got;
+                    }
+                    return got;
+                });
+    benchmark::DoNotOptimize(sum);
+}
+
+static void BM_MpscQueue_MailboxBatch(benchmark::State& state) {
+    MpscQueue<Message> queue;
+    std::vector<std::vector<Message>> messages(static_cast<size_t>(state.range(0)), std::vector<Message>(C_PER_PRODUCER));
+    std::vector<Message*> batch;
+    batch.reserve(64);
+    uint64_t sum = 0;
+
+    run_mailbox(state,
+                [&](int64_t p, int64_t i) { queue.push(&messages[p][i]); },
+                [&]() {
+                    batch.clear();
+                    const size_t got = queue.pop_batch(batch, 64);
+                    for (Message* message : batch) {
+                        sum += message->value;
+                    }
+                    return static_cast<int64_t>(got);
+                });
+    benchmark::DoNotOptimize(sum);
+}
+
+static void BM_MichaelScottQueue_Mailbox(benchmark::State& state) {
+    MichaelScottQueue queue;
+    uint64_t sum = 0;
+
+    run_mailbox(state,
+                [&](int64_t, int64_t i) { queue.push(static_cast<uint64_t>(i)); },
+                [&]() {
+                    int64_t got = 0;
+                    uint64_t value;
+                    while (queue.pop(value)) {
+                        sum += value;
+                        ++got;
+                    }
+                    return got;
+                });
+    benchmark::DoNotOptimize(sum);
+}
+
+static void BM_LockedQueue_Mailbox(benchmark::State& state) {
+    LockedQueue queue;
+    uint64_t sum = 0;
+
+    run_mailbox(state,
+                [&](int64_t, int64_t i) { queue.push(static_cast<uint64_t>(i)); },
+                [&]() {
+                    int64_t got = 0;
+                    uint64_t value;
+                    while (queue.pop(value)) {
+                        sum += value;
+                        ++got;
+                    }
+                    return got;
+                });
+    benchmark::DoNotOptimize(sum);
+}
+
+BENCHMARK(BM_MpscQueue_Mailbox)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+BENCHMARK(BM_MpscQueue_MailboxBatch)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+BENCHMARK(BM_MichaelScottQueue_Mailbox)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+BENCHMARK(BM_LockedQueue_Mailbox)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+
+int main(int argc, char** argv) {
+    std::cout << "MpscQueue: intrusive Vyukov mailbox vs hazard-protected Michael-Scott queue vs mutex deque\n";
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,151 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "HazardPointerManager.hpp"
+#include "ObjectPool.hpp"
+#include "PerfCounters.hpp"
+
+using namespace HazardSystem;
+
+// Allocation cost for a 64-byte node: ObjectPool against glibc malloc/free
+// and new/delete. Pair allocates and frees one node; Burst holds 256 nodes
+// before freeing them all, which is what drains and refills the magazines;
+// Retire frees every node through HazardPointerManager::retire, into the pool
+// or with the default delete. Items are nodes allocated.
+
+struct Node {
+    uint64_t key;
+    uint64_t value[7];
+};
+
+static constexpr int64_t C_BURST = 256;
+
+static ObjectPool<Node>& pool(void) {
+    static ObjectPool<Node> s_pool;
+    return s_pool;
+}
+
+static void BM_ObjectPool_Pair(benchmark::State& state) {
+    auto& nodes = pool();
+    Perf::Scope perf(state, 1.0);
+    for (auto _ : state) {
+        Node* node = nodes.allocate();
+        benchmark::DoNotOptimize(node);
+        nodes.deallocate(node);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_Malloc_Pair(benchmark::State& state) {
+    Perf::Scope perf(state, 1.0);
+    for (auto _ : state) {
+        void* node = std::malloc(sizeof(Node));
+        benchmark::DoNotOptimize(node);
+        std::free(node);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_NewDelete_Pair(benchmark::State& state) {
+    Perf::Scope perf(state, 1.0);
+    for (auto _ : state) {
+        Node* node = new Node();
+        benchmark::DoNotOptimize(node);
+        delete node;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_ObjectPool_Burst(benchmark::State& state) {
+    auto& nodes = pool();
+    std::vector<Node*> held(C_BURST);
+    Perf::Scope perf(state, static_cast<double>(C_BURST));
+    for (auto _ : state) {
+        for (auto& node : held) {
+            node = nodes.allocate();
+        }
+        benchmark::DoNotOptimize(held.data());
+        for (Node* node : held) {
+            nodes.deallocate(node);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * C_BURST);
+}
+
+static void BM_Malloc_Burst(benchmark::State& state) {
+    std::vector<void*> held(C_BURST);
+    Perf::Scope perf(state, static_cast<double>(C_BURST));
+    for (auto _ : state) {
+        for (auto& node : held) {
+            node = std::malloc(sizeof(Node));
+        }
+        benchmark::DoNotOptimize(held.data());
+        for (void* node : held) {
+            std::free(node);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * C_BURST);
+}
+
+static void BM_NewDelete_Burst(benchmark::State& state) {
+    std::vector<Node*> held(C_BURST);
+    Perf::Scope perf(state, static_cast<double>(C_BURST));
+    for (auto _ : state) {
+        for (auto& node : held) {
+            node = new Node();
+        }
+        benchmark::DoNotOptimize(held.data());
+        for (Node* node : held) {
+            delete node;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * C_BURST);
+}
+
+static void BM_ObjectPool_Retire(benchmark::State& state) {
+    auto& nodes   = pool();
+    auto& manager = HazardPointerManager<Node, 0>::instance(64);
+    Perf::Scope perf(state, 1.0);
+    for (auto _ : state) {
+        Node* node = nodes.create();
+        benchmark::DoNotOptimize(node);
+        manager.retire(node, &nodes);
+    }
+    manager.reclaim();
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_NewDelete_Retire(benchmark::State& state) {
+    auto& manager = HazardPointerManager<Node, 0>::instance(64);
+    Perf::Scope perf(state, 1.0);
+    for (auto _ : state) {
+        Node* node = new Node();
+        benchmark::DoNotOptimize(node);
+        manager.retire(node);
+    }
+    manager.reclaim();
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_ObjectPool_Pair)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_Malloc_Pair)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_NewDelete_Pair)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_ObjectPool_Burst)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_Malloc_Burst)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_NewDelete_Burst)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_ObjectPool_Retire)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_NewDelete_Retire)->ThreadRange(1, 8)->UseRealTime();
+
+int main(int argc, char** argv) {
+    std::cout << "ObjectPool: magazine pool vs malloc/free vs new/delete, direct and through retire\n";
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,111 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "HashSet.hpp"
+#include "HazardPointerManager.hpp"
+#include "HazardRegistry.hpp"
+#include "ThreadRegistry.hpp"
+
+using namespace HazardSystem;
+
+// Compare throughput at 1x cores against 4x cores. With the backoff in the
+// protect/registry/set paths the 4x rows should stay close to the 1x rows
+// instead of collapsing when a preempted thread holds a slot.
+static const int C_CORES         = static_cast<int>(std::max(1U, std::thread::hardware_concurrency()));
+static constexpr int C_OVERSUB   = 4;
+
+struct OversubNode {
+    explicit OversubNode(uint64_t v = 0) : value(v) {}
+    uint64_t value;
+};
+
+using OversubManager = HazardPointerManager<OversubNode, 0>;
+
+static OversubManager& oversub_manager(void) {
+    return OversubManager::instance(static_cast<size_t>(C_CORES * C_OVERSUB * 2));
+}
+
+static std::atomic<OversubNode*> g_source{nullptr};
+
+// Readers protect the shared node; one in eight operations swaps and retires it.
+static void BM_Oversub_ProtectRetire(benchmark::State& state) {
+    auto& manager = oversub_manager();
+    if (state.thread_index() == 0) {
+        g_source.store(new OversubNode(0), std::memory_order_release);
+    }
+    uint64_t counter = 0;
+
+    for (auto _ : state) {
+        if ((++counter & 7U) == 0U) {
+            OversubNode* old = g_source.exchange(new OversubNode(counter), std::memory_order_acq_rel);
+            manager.retire(old);
+        } else {
+            auto guard = manager.try_protect(g_source);
+            benchmark::DoNotOptimize(guard.get());
+        }
+    }
+
+    if (state.thread_index() == 0) {
+        manager.retire(g_source.exchange(nullptr, std::memory_order_acq_rel));
+    }
+    manager.reclaim();
+    state.SetItemsProcessed(state.iterations());
+}
+
+static HashSet<uint64_t> g_set(static_cast<size_t>(C_CORES * C_OVERSUB * 256));
+
+// Each thread churns a private key range so inserts contend on probing and
+// Busy slots but never on key identity.
+static void BM_Oversub_HashSetInsertRemove(benchmark::State& state) {
+    const uint64_t base = static_cast<uint64_t>(state.thread_index()) * 64ULL;
+    uint64_t counter    = 0;
+
+    for (auto _ : state) {
+        const uint64_t key = base + (counter++ & 63ULL);
+        benchmark::DoNotOptimize(g_set.insert(key));
+        benchmark::DoNotOptimize(g_set.contains(key));
+        benchmark::DoNotOptimize(g_set.remove(key));
+    }
+
+    state.SetItemsProcessed(state.iterations() * 3);
+}
+
+static HazardRegistry<OversubNode> g_registry(static_cast<size_t>(C_CORES * C_OVERSUB));
+static std::vector<OversubNode> g_shared_nodes(8);
+
+// All threads add/remove the same few pointers, exercising the refcount path.
+static void BM_Oversub_RegistryAddRemove(benchmark::State& state) {
+    uint64_t counter = static_cast<uint64_t>(state.thread_index());
+
+    for (auto _ : state) {
+        OversubNode* node = &g_shared_nodes[counter++ % g_shared_nodes.size()];
+        benchmark::DoNotOptimize(g_registry.add(node));
+        benchmark::DoNotOptimize(g_registry.remove(node));
+    }
+
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+
+BENCHMARK(BM_Oversub_ProtectRetire)->Threads(C_CORES)->Threads(C_CORES * C_OVERSUB)->UseRealTime();
+BENCHMARK(BM_Oversub_HashSetInsertRemove)->Threads(C_CORES)->Threads(C_CORES * C_OVERSUB)->UseRealTime();
+BENCHMARK(BM_Oversub_RegistryAddRemove)->Threads(C_CORES)->Threads(C_CORES * C_OVERSUB)->UseRealTime();
+
+int main(int argc, char** argv) {
+    ::benchmark::Initialize(&argc, argv);
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+
+    std::cout << "=== Oversubscription Benchmark ===\n";
+    std::cout << "Cores: " << C_CORES << ", oversubscribed runs use " << C_CORES * C_OVERSUB << " threads.\n\n";
+
+    ::benchmark::RunSpecifiedBenchmarks();
+    ::benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,295 @@
+#pragma once
+
+//--------------------------------------------------------------
+// Hardware performance counters for the benchmark harness.
+//
+// Wraps perf_event_open (Linux) so a measured region can report cycles,
+// instructions, L1D read misses, LLC misses and branch misses per operation
+// next to Google Benchmark's own counters. Counting is opt-in: set
+// HAZARD_PERF_COUNTERS=1 in the environment. When perf events are not
+// permitted (perf_event_paranoid, containers, non-Linux) every call is a
+// no-op and the benchmarks report wall time only.
+//--------------------------------------------------------------
+// Standard cpp library
+//--------------------------------------------------------------
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <utility>
+//--------------------------------------------------------------
+// Platform headers
+//--------------------------------------------------------------
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+//--------------------------------------------------------------
+// Google Benchmark
+//--------------------------------------------------------------
+#include <benchmark/benchmark.h>
+//--------------------------------------------------------------
+namespace HazardSystem::Perf {
+    //--------------------------------------------------------------
+    enum class Event : uint8_t {
+        Cycles = 0,
+        Instructions,
+        L1DMisses,
+        LLCMisses,
+        BranchMisses,
+        Count
+    };// end enum class Event
+    //--------------------------------------------------------------
+    inline constexpr size_t C_EVENTS = static_cast<size_t>(Event::Count);
+    //--------------------------
+    inline constexpr std::array<std::string_view, C_EVENTS> C_EVENT_NAMES{
+        "cycles/op", "instructions/op", "L1D-misses/op", "LLC-misses/op", "branch-misses/op"};
+    //--------------------------------------------------------------
+    // One reading of the group. Values are already scaled for multiplexing;
+    // events that could not be opened stay invalid.
+    struct Sample {
+        std::array<double, C_EVENTS> values{};
+        std::array<bool, C_EVENTS> valid{};
+        //--------------------------
+        Sample& operator+=(const Sample& other) {
+            for (size_t i = 0; i < C_EVENTS; ++i) {
+                values[i] += other.values[i];
+                valid[i]   = valid[i] or other.valid[i];
+            }
+            return *this;
+        }// end Sample& operator+=(const Sample& other)
+        //--------------------------
+        bool any(void) const {
+            for (bool v : valid) {
+                if (v) {
+                    return true;
+                }
+            }
+            return false;
+        }// end bool any(void) const
+    };// end struct Sample
+    //--------------------------------------------------------------
+    // Runtime switch, read once per process.
+    inline bool enabled(void) {
+        static const bool _enabled = [] {
+            const char* _env = std::getenv("HAZARD_PERF_COUNTERS");
+            return _env and *_env and std::strcmp(_env, "0") != 0;
+        }();
+        return _enabled;
+    }// end inline bool enabled(void)
+    //--------------------------------------------------------------
+    // A per-thread counter group. Counts only the calling thread, so each
+    // benchmark thread (or sweep worker) owns its own instance.
+    class CounterGroup {
+        //--------------------------------------------------------------
+        public:
+            //--------------------------------------------------------------
+            CounterGroup(void) {
+                m_fds.fill(-1);
+                if (enabled()) {
+                    open_group();
+                }
+            }// end CounterGroup(void)
+            //--------------------------
+            CounterGroup(const CounterGroup&)            = delete;
+            CounterGroup& operator=(const CounterGroup&) = delete;
+            CounterGroup(CounterGroup&&)                 = delete;
+            CounterGroup& operator=(CounterGroup&&)      = delete;
+            //--------------------------
+            ~CounterGroup(void) {
+                close_group();
+            }// end ~CounterGroup(void)
+            //--------------------------
+            bool active(void) const {
+                return m_leader >= 0;
+            }// end bool active(void) const
+            //--------------------------
+            void start(void) {
+                control(C_RESET);
+                control(C_ENABLE);
+            }// end void start(void)
+            //--------------------------
+            void pause(void) {
+                control(C_DISABLE);
+            }// end void pause(void)
+            //--------------------------
+            void resume(void) {
+                control(C_ENABLE);
+            }// end void resume(void)
+            //--------------------------
+            Sample stop(void) {
+                control(C_DISABLE);
+                return read_group();
+            }// end Sample stop(void)
+            //--------------------------------------------------------------
+        private:
+            //--------------------------------------------------------------
+#if defined(__linux__)
+            static constexpr unsigned long C_RESET   = PERF_EVENT_IOC_RESET;
+            static constexpr unsigned long C_ENABLE  = PERF_EVENT_IOC_ENABLE;
+            static constexpr unsigned long C_DISABLE = PERF_EVENT_IOC_DISABLE;
+#else
+            static constexpr unsigned long C_RESET   = 0UL;
+            static constexpr unsigned long C_ENABLE  = 1UL;
+            static constexpr unsigned long C_DISABLE = 2UL;
+#endif
+            //--------------------------------------------------------------
+            void open_group(void) {
+#if defined(__linux__)
+                constexpr uint64_t _l1d_read_miss = PERF_COUNT_HW_CACHE_L1D |
+                                                    (PERF_COUNT_HW_CACHE_OP_READ << 8U) |
+                                                    (PERF_COUNT_HW_CACHE_RESULT_MISS << 16U);
+                const std::array<std::pair<uint32_t, uint64_t>, C_EVENTS> _events{{
+                    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+                    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+                    {PERF_TYPE_HW_CACHE, _l1d_read_miss},
+                    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+                    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+                }};
+                //--------------------------
+                for (size_t i = 0; i < C_EVENTS; ++i) {
+                    perf_event_attr _attr;
+                    std::memset(&_attr, 0, sizeof(_attr));
+                    _attr.size           = sizeof(_attr);
+                    _attr.type           = _events[i].first;
+                    _attr.config         = _events[i].second;
+                    _attr.disabled       = (m_leader < 0) ? 1U : 0U;
+                    _attr.exclude_kernel = 1U;
+                    _attr.exclude_hv     = 1U;
+                    _attr.read_format    = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+                    //--------------------------
+                    const int _fd = static_cast<int>(::syscall(SYS_perf_event_open, &_attr, 0, -1, m_leader, 0UL));
+                    if (_fd < 0) {
+                        // Without cycles there is no group to hang the others on.
+                        if (m_leader < 0) {
+                            return;
+                        }
+                        continue;
+                    }
+                    if (m_leader < 0) {
+                        m_leader = _fd;
+                    }
+                    m_fds.at(i) = _fd;
+                }
+#endif
+            }// end void open_group(void)
+            //--------------------------
+            void close_group(void) {
+#if defined(__linux__)
+                for (int& fd : m_fds) {
+                    if (fd >= 0) {
+                        ::close(fd);
+                        fd = -1;
+                    }
+                }
+#endif
+                m_leader = -1;
+            }// end void close_group(void)
+            //--------------------------
+            void control(unsigned long request) {
+#if defined(__linux__)
+                if (m_leader >= 0) {
+                    ::ioctl(m_leader, request, PERF_IOC_FLAG_GROUP);
+                }
+#else
+                static_cast<void>(request);
+#endif
+            }// end void control(unsigned long request)
+            //--------------------------
+            Sample read_group(void) const {
+                Sample _sample;
+#if defined(__linux__)
+                if (m_leader < 0) {
+                    return _sample;
+                }
+                // PERF_FORMAT_GROUP layout: nr, time_enabled, time_running, value[nr]
+                std::array<uint64_t, 3 + C_EVENTS> _buffer{};
+                const ssize_t _bytes = ::read(m_leader, _buffer.data(), sizeof(_buffer));
+                if (_bytes < static_cast<ssize_t>(3 * sizeof(uint64_t))) {
+                    return _sample;
+                }
+                const uint64_t _nr      = _buffer[0];
+                const uint64_t _enabled = _buffer[1];
+                const uint64_t _running = _buffer[2];
+                if (_running == 0) {
+                    return _sample;
+                }
+                const double _scale = static_cast<double>(_enabled) / static_cast<double>(_running);
+                // Values are returned in open order; skip events that failed to open.
+                size_t _slot = 0;
+                for (size_t i = 0; i < C_EVENTS and _slot < _nr; ++i) {
+                    if (m_fds.at(i) < 0) {
+                        continue;
+                    }
+                    _sample.values.at(i) = static_cast<double>(_buffer.at(3 + _slot)) * _scale;
+                    _sample.valid.at(i)  = true;
+                    ++_slot;
+                }
+#endif
+                return _sample;
+            }// end Sample read_group(void) const
+            //--------------------------------------------------------------
+            std::array<int, C_EVENTS> m_fds{};
+            int m_leader{-1};
+        //--------------------------------------------------------------
+    };// end class CounterGroup
+    //--------------------------------------------------------------
+    // Publish a sample as per-op Google Benchmark counters. Counters are summed
+    // across benchmark threads and divided by the total iteration count, so
+    // ops_per_iteration converts per-iteration figures into per-op figures.
+    inline void report(benchmark::State& state, const Sample& sample, double ops_per_iteration = 1.0) {
+        if (ops_per_iteration <= 0.0) {
+            ops_per_iteration = 1.0;
+        }
+        for (size_t i = 0; i < C_EVENTS; ++i) {
+            if (sample.valid.at(i)) {
+                state.counters[std::string(C_EVENT_NAMES.at(i))] =
+                    benchmark::Counter(sample.values.at(i) / ops_per_iteration, benchmark::Counter::kAvgIterations);
+            }
+        }
+    }// end inline void report(benchmark::State& state, const Sample& sample, double ops_per_iteration)
+    //--------------------------------------------------------------
+    // RAII helper for a benchmark body: counting starts on construction and the
+    // per-op counters are published when the scope ends. Pair pause()/resume()
+    // with State::PauseTiming()/ResumeTiming() to keep setup out of the counts.
+    class Scope {
+        //--------------------------------------------------------------
+        public:
+            //--------------------------------------------------------------
+            explicit Scope(benchmark::State& state, double ops_per_iteration = 1.0) : m_state(state),
+                                                                                      m_ops_per_iteration(ops_per_iteration) {
+                m_group.start();
+            }// end explicit Scope(benchmark::State& state, double ops_per_iteration)
+            //--------------------------
+            Scope(const Scope&)            = delete;
+            Scope& operator=(const Scope&) = delete;
+            //--------------------------
+            ~Scope(void) {
+                if (m_group.active()) {
+                    report(m_state, m_group.stop(), m_ops_per_iteration);
+                }
+            }// end ~Scope(void)
+            //--------------------------
+            void pause(void) {
+                m_group.pause();
+            }// end void pause(void)
+            //--------------------------
+            void resume(void) {
+                m_group.resume();
+            }// end void resume(void)
+            //--------------------------------------------------------------
+        private:
+            //--------------------------------------------------------------
+            benchmark::State& m_state;
+            double m_ops_per_iteration;
+            CounterGroup m_group;
+        //--------------------------------------------------------------
+    };// end class Scope
+    //--------------------------------------------------------------
+}// end namespace HazardSystem::Perf
+//--------------------------------------------------------------
@@ -0,0 +1,166 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "RadixTree.hpp"
+#include "PerfCounters.hpp"
+
+using namespace HazardSystem;
+
+// Route table of 16K URL-like keys ("/svc17/v2/items/4242"), read by 1..8
+// threads. Lookup is an exact match, Route a longest-prefix match of a
+// request path under its route, Scan visits the first 32 keys under a
+// "/svcN/" prefix. The baselines sit under a std::shared_mutex: an
+// unordered_map for exact lookups and a std::map (longest prefix by
+// walking the candidate prefixes, scan by lower_bound) for the rest.
+// Items are lookups, or keys visited for Scan.
+
+static constexpr size_t C_KEYS = 16384;
+static constexpr size_t C_SCAN = 32;
+
+static const std::vector<std::string>& keys(void) {
+    static const std::vector<std::string> s_keys = [] {
+        std::vector<std::string> out;
+        out.reserve(C_KEYS);
+        for (size_t i = 0; i < C_KEYS; ++i) {
+            out.push_back("/svc" + std::to_string(i % 64) + "/v" + std::to_string(i % 3) + "/items/" + std::to_string(i * 2654435761u % 100003u));
+        }
+        return out;
+    }();
+    return s_keys;
+}
+
+static RadixTree<uint64_t>& tree(void) {
+    static RadixTree<uint64_t> s_tree;
+    static const bool s_filled = [] {
+        for (size_t i = 0; i < C_KEYS; ++i) {
+            s_tree.insert_or_assign(keys()[i], i);
+        }
+        return true;
+    }();
+    benchmark::DoNotOptimize(s_filled);
+    return s_tree;
+}
+
+struct LockedMaps {
+    LockedMaps(void) {
+        for (size_t i = 0; i < C_KEYS; ++i) {
+            ordered.emplace(keys()[i], i);
+            hashed.emplace(keys()[i], i);
+        }
+    }
+
+    std::optional<uint64_t> find(const std::string& key) const {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        auto it = hashed.find(key);
+        return it == hashed.end() ? std::nullopt : std::optional<uint64_t>(it->second);
+    }
+
+    std::optional<uint64_t> longest_prefix(const std::string& key) const {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        for (size_t length = key.size() + 1; length-- > 0;) {
+            auto it = ordered.find(key.substr(0, length));
+            if (it != ordered.end()) {
+                return it->second;
+            }
+        }
+        return std::nullopt;
+    }
+
+    size_t scan_prefix(const std::string& prefix, uint64_t& sum) const {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        size_t seen = 0;
+        for (auto it = ordered.lower_bound(prefix); it != ordered.end() && seen < C_SCAN && it->first.starts_with(prefix); ++it, ++seen) {
+            sum += it->second;
+        }
+        return seen;
+    }
+
+    mutable std::shared_mutex mutex;
+    std::map<std::string, uint64_t> ordered;
+    std::unordered_map<std::string, uint64_t> hashed;
+};
+
+static LockedMaps& maps(void) {
+    static LockedMaps s_maps;
+    return s_maps;
+}
+
+template <typename Op>
+static void run_reads(benchmark::State& state, const double& items, Op&& op) {
+    uint64_t i   = static_cast<uint64_t>(state.thread_index()) * 7919u;
+    uint64_t sum = 0;
+    Perf::Scope perf(state, items);
+    for (auto _ : state) {
+        i = (i + 40503u) % C_KEYS;
+        sum += op(i);
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(static_cast<int64_t>(static_cast<double>(state.iterations()) * items));
+}
+
+static void BM_RadixTree_Lookup(benchmark::State& state) {
+    auto& routes = tree();
+    run_reads(state, 1.0, [&](uint64_t i) { return routes.find(keys()[i]).value_or(0); });
+}
+
+static void BM_LockedHash_Lookup(benchmark::State& state) {
+    auto& locked = maps();
+    run_reads(state, 1.0, [&](uint64_t i) { return locked.find(keys()[i]).value_or(0); });
+}
+
+static void BM_RadixTree_Route(benchmark::State& state) {
+    auto& routes = tree();
+    run_reads(state, 1.0, [&](uint64_t i) {
+        auto match = routes.longest_prefix(keys()[i] + "/details?id=7");
+        return match ? match->second : 0;
+    });
+}
+
+static void BM_LockedMap_Route(benchmark::State& state) {
+    auto& locked = maps();
+    run_reads(state, 1.0, [&](uint64_t i) { return locked.longest_prefix(keys()[i] + "/details?id=7").value_or(0); });
+}
+
+static void BM_RadixTree_Scan(benchmark::State& state) {
+    auto& routes = tree();
+    run_reads(state, static_cast<double>(C_SCAN), [&](uint64_t i) {
+        uint64_t sum = 0;
+        routes.scan_prefix("/svc" + std::to_string(i % 64) + "/", [&](const std::string&, const uint64_t& value) { sum += value; }, C_SCAN);
+        return sum;
+    });
+}
+
+static void BM_LockedMap_Scan(benchmark::State& state) {
+    auto& locked = maps();
+    run_reads(state, static_cast<double>(C_SCAN), [&](uint64_t i) {
+        uint64_t sum = 0;
+        locked.scan_prefix("/svc" + std::to_string(i % 64) + "/", sum);
+        return sum;
+    });
+}
+
+BENCHMARK(BM_RadixTree_Lookup)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_LockedHash_Lookup)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_RadixTree_Route)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_LockedMap_Route)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_RadixTree_Scan)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_LockedMap_Scan)->ThreadRange(1, 8)->UseRealTime();
+
+int main(int argc, char** argv) {
+    std::cout << "RadixTree: lock-free ART reads vs shared_mutex unordered_map/std::map\n";
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
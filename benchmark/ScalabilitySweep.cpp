@@ -0,0 +1,698 @@
+//--------------------------------------------------------------
+// Scalability sweep runner.
+//
+// Runs every component across a range of thread counts (1 .. 2x cores by
+// default) and read/write ratios, pins workers to CPUs, and reports ops/sec
+// plus scaling efficiency (per-thread throughput relative to one thread).
+// With HAZARD_PERF_COUNTERS=1 each worker also records hardware counters
+// (see PerfCounters.hpp) and cycles/instructions/misses per op are reported.
+// Results can be written as JSON and/or CSV; a CSV written by a previous run
+// can be passed back as a baseline to flag regressions beyond a threshold.
+//
+//   ScalabilitySweep [--threads=1,2,4] [--ratios=50,90,99] [--duration-ms=100]
+//                    [--components=HashSet,HazardRegistry] [--no-pin]
+//                    [--oversubscribe=4]
+//                    [--json=out.json] [--csv=out.csv]
+//                    [--baseline=old.csv] [--threshold=0.10] [--list]
+//
+// Exit status is 1 when a baseline comparison finds a regression.
+//--------------------------------------------------------------
+// Standard C++ library
+//--------------------------------------------------------------
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+//--------------------------------------------------------------
+// Platform headers
+//--------------------------------------------------------------
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+//--------------------------------------------------------------
+// Project headers
+//--------------------------------------------------------------
+#include "BitmaskTable.hpp"
+#include "HashSet.hpp"
+#include "HashTable.hpp"
+#include "HazardPointerManager.hpp"
+#include "HazardRegistry.hpp"
+#include "PerfCounters.hpp"
+#include "ThreadRegistry.hpp"
+#include "atomic_unique_ptr.hpp"
+
+using namespace HazardSystem;
+
+namespace {
+
+//--------------------------------------------------------------
+// Options
+//--------------------------------------------------------------
+struct SweepOptions {
+    std::vector<size_t> threads;
+    std::vector<uint32_t> read_ratios{50U, 90U, 99U};
+    std::vector<std::string> components;
+    std::chrono::milliseconds duration{100};
+    size_t oversubscribe{0};
+    bool pin{true};
+    bool list{false};
+    std::string json_path;
+    std::string csv_path;
+    std::string baseline_path;
+    double threshold{0.10};
+};
+
+std::vector<std::string> split(const std::string& text, char delimiter) {
+    std::vector<std::string> parts;
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, delimiter)) {
+        if (!item.empty()) {
+            parts.push_back(item);
+        }
+    }
+    return parts;
+}
+
+size_t hardware_threads(void) {
+    return std::max<size_t>(1UL, std::thread::hardware_concurrency());
+}
+
+// 1, 2, 4, ... up to 2x cores; cores and 2x cores are always included.
+std::vector<size_t> default_thread_counts(void) {
+    const size_t cores = hardware_threads();
+    std::vector<size_t> counts;
+    for (size_t t = 1; t <= cores * 2; t <<= 1U) {
+        counts.push_back(t);
+    }
+    counts.push_back(cores);
+    counts.push_back(cores * 2);
+    std::sort(counts.begin(), counts.end());
+    counts.erase(std::unique(counts.begin(), counts.end()), counts.end());
+    return counts;
+}
+
+std::optional<SweepOptions> parse_options(int argc, char** argv) {
+    SweepOptions options;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg(argv[i]);
+        const auto eq = arg.find('=');
+        const std::string key   = arg.substr(0, eq);
+        const std::string value = (eq == std::string::npos) ? std::string() : arg.substr(eq + 1);
+
+        if (key == "--threads") {
+            for (const auto& t : split(value, ',')) {
+                options.threads.push_back(std::max<size_t>(1UL, std::stoul(t)));
+            }
+        } else if (key == "--ratios") {
+            options.read_ratios.clear();
+            for (const auto& r : split(value, ',')) {
+                options.read_ratios.push_back(std::min<uint32_t>(100U, static_cast<uint32_t>(std::stoul(r))));
+            }
+        } else if (key == "--components") {
+            options.components = split(value, ',');
+        } else if (key == "--duration-ms") {
+            options.duration = std::chrono::milliseconds(std::stoul(value));
+        } else if (key == "--oversubscribe") {
+            options.oversubscribe = std::stoul(value);
+        } else if (key == "--no-pin") {
+            options.pin = false;
+        } else if (key == "--list") {
+            options.list = true;
+        } else if (key == "--json") {
+            options.json_path = value;
+        } else if (key == "--csv") {
+            options.csv_path = value;
+        } else if (key == "--baseline") {
+            options.baseline_path = value;
+        } else if (key == "--threshold") {
+            options.threshold = std::stod(value);
+        } else {
+            std::cerr << "unknown option: " << arg << std::endl;
+            return std::nullopt;
+        }
+    }
+    if (options.threads.empty()) {
+        options.threads = default_thread_counts();
+    }
+    // Oversubscribed points run more threads than cores; workers wrap around
+    // the CPU set when pinned, so several share each core.
+    if (options.oversubscribe > 1) {
+        options.threads.push_back(hardware_threads() * options.oversubscribe);
+        std::sort(options.threads.begin(), options.threads.end());
+        options.threads.erase(std::unique(options.threads.begin(), options.threads.end()), options.threads.end());
+    }
+    return options;
+}
+
+//--------------------------------------------------------------
+// Thread placement
+//--------------------------------------------------------------
+// Pin the calling thread to the n-th CPU of the process affinity mask.
+bool pin_current_thread(size_t n) {
+#if defined(__linux__)
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) {
+        return false;
+    }
+    const int available = CPU_COUNT(&allowed);
+    if (available <= 0) {
+        return false;
+    }
+    int target = static_cast<int>(n % static_cast<size_t>(available));
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+        if (!CPU_ISSET(cpu, &allowed)) {
+            continue;
+        }
+        if (target-- == 0) {
+            cpu_set_t single;
+            CPU_ZERO(&single);
+            CPU_SET(cpu, &single);
+            return pthread_setaffinity_np(pthread_self(), sizeof(single), &single) == 0;
+        }
+    }
+    return false;
+#else
+    static_cast<void>(n);
+    return false;
+#endif
+}
+
+//--------------------------------------------------------------
+// Workloads
+//--------------------------------------------------------------
+// Cheap per-thread generator used to pick reads vs writes and keys.
+struct XorShift {
+    explicit XorShift(uint64_t seed) : state(seed ? seed : 0x9e3779b97f4a7c15ULL) {}
+    uint64_t next(void) {
+        state ^= state << 13U;
+        state ^= state >> 7U;
+        state ^= state << 17U;
+        return state;
+    }
+    uint64_t state;
+};
+
+// A workload owns the shared structure for one (component, threads) run.
+// operate() performs exactly one read or one write and is called in a loop
+// by every worker until the measured window closes.
+class Workload {
+    public:
+        virtual ~Workload(void) = default;
+        virtual void operate(size_t thread_index, bool read, XorShift& rng) = 0;
+};
+
+struct SweepNode {
+    explicit SweepNode(uint64_t v = 0) : value(v) {}
+    uint64_t value;
+};
+
+class HashSetWorkload : public Workload {
+    public:
+        explicit HashSetWorkload(size_t threads) : m_set(C_KEYS * (threads + 1)) {
+            for (uint64_t k = 0; k < C_KEYS; ++k) {
+                m_set.insert(k);
+            }
+        }
+        void operate(size_t thread_index, bool read, XorShift& rng) override {
+            if (read) {
+                volatile bool found = m_set.contains(rng.next() % C_KEYS);
+                static_cast<void>(found);
+                return;
+            }
+            // Writers churn a private key range so inserts never collide.
+            const uint64_t key = C_KEYS * (thread_index + 1) + (rng.next() % C_KEYS);
+            if (!m_set.insert(key)) {
+                m_set.remove(key);
+            }
+        }
+    private:
+        static constexpr uint64_t C_KEYS = 256ULL;
+        HashSet<uint64_t> m_set;
+};
+
+class BitmaskTableWorkload : public Workload {
+    public:
+        explicit BitmaskTableWorkload(size_t threads) : m_table(std::max<size_t>(64UL, threads * 4)) {
+            m_nodes.reserve(threads * 2);
+            for (size_t i = 0; i < threads * 2; ++i) {
+                m_nodes.emplace_back(std::make_unique<SweepNode>(i));
+            }
+            // Keep part of the table populated so scans have work to do.
+            for (size_t i = 0; i < threads; ++i) {
+                m_table.set(m_nodes[i].get());
+            }
+        }
+        void operate(size_t thread_index, bool read, XorShift&) override {
+            if (read) {
+                const SweepNode* needle = m_nodes[thread_index].get();
+                volatile bool found = m_table.find([needle](const SweepNode* p) { return p == needle; });
+                static_cast<void>(found);
+                return;
+            }
+            auto index = m_table.acquire();
+            if (index) {
+                m_table.set(index.value(), m_nodes[m_nodes.size() / 2 + thread_index % (m_nodes.size() / 2)].get());
+                m_table.release(index.value());
+            }
+        }
+    private:
+        std::vector<std::unique_ptr<SweepNode>> m_nodes;
+        BitmaskTable<SweepNode, 0> m_table;
+};
+
+class HazardRegistryWorkload : public Workload {
+    public:
+        explicit HazardRegistryWorkload(size_t threads) : m_registry(std::max<size_t>(64UL, threads * 4)) {
+            m_nodes.reserve(threads * 2);
+            for (size_t i = 0; i < threads * 2; ++i) {
+                m_nodes.emplace_back(std::make_unique<SweepNode>(i));
+            }
+            for (size_t i = 0; i < threads; ++i) {
+                m_registry.add(m_nodes[i].get());
+            }
+        }
+        void operate(size_t thread_index, bool read, XorShift& rng) override {
+            if (read) {
+                volatile bool found = m_registry.contains(m_nodes[rng.next() % m_nodes.size()].get());
+                static_cast<void>(found);
+                return;
+            }
+            SweepNode* mine = m_nodes[m_nodes.size() / 2 + thread_index % (m_nodes.size() / 2)].get();
+            m_registry.add(mine);
+            m_registry.remove(mine);
+        }
+    private:
+        std::vector<std::unique_ptr<SweepNode>> m_nodes;
+        HazardRegistry<SweepNode> m_registry;
+};
+
+class ThreadRegistryWorkload : public Workload {
+    public:
+        explicit ThreadRegistryWorkload(size_t) {}
+        void operate(size_t, bool read, XorShift&) override {
+            auto& registry = ThreadRegistry::instance();
+            if (read) {
+                volatile bool registered = registry.registered();
+                static_cast<void>(registered);
+                return;
+            }
+            registry.unregister();
+            registry.register_id();
+        }
+};
+
+// protect()/retire() through the manager: readers protect the shared source,
+// writers swap in a fresh node and retire the old one.
+class ProtectedPointerWorkload : public Workload {
+    public:
+        using Manager = HazardPointerManager<SweepNode, 0>;
+        explicit ProtectedPointerWorkload(size_t threads) : m_manager(Manager::instance(std::max<size_t>(64UL, threads * 2))),
+                                                            m_source(new SweepNode(0)) {
+        }
+        ~ProtectedPointerWorkload(void) override {
+            m_manager.retire(m_source.exchange(nullptr));
+            m_manager.reclaim();
+        }
+        void operate(size_t, bool read, XorShift& rng) override {
+            if (read) {
+                auto guard = m_manager.try_protect(m_source);
+                if (guard) {
+                    volatile uint64_t value = guard->value;
+                    static_cast<void>(value);
+                }
+                return;
+            }
+            SweepNode* old = m_source.exchange(new SweepNode(rng.next()), std::memory_order_acq_rel);
+            m_manager.retire(old);
+        }
+    private:
+        Manager& m_manager;
+        std::atomic<SweepNode*> m_source;
+};
+
+struct AupNode {
+    explicit AupNode(uint64_t v = 0) : value(v) {}
+    uint64_t value;
+};
+
+class AtomicUniquePtrWorkload : public Workload {
+    public:
+        explicit AtomicUniquePtrWorkload(size_t threads) {
+            // atomic_unique_ptr uses the default dynamic manager; size it for the sweep first.
+            HazardPointerManager<AupNode>::instance(std::max<size_t>(64UL, hardware_threads() * 4));
+            static_cast<void>(threads);
+            m_ptr.store(new AupNode(0));
+        }
+        void operate(size_t, bool read, XorShift& rng) override {
+            if (read) {
+                auto guard = m_ptr.protect();
+                if (guard) {
+                    volatile uint64_t value = guard->value;
+                    static_cast<void>(value);
+                }
+                return;
+            }
+            m_ptr.store(new AupNode(rng.next()));
+        }
+    private:
+        atomic_unique_ptr<AupNode> m_ptr;
+};
+
+class HashTableWorkload : public Workload {
+    public:
+        explicit HashTableWorkload(size_t) {
+            for (uint64_t k = 0; k < C_KEYS; ++k) {
+                m_table.insert(k, std::make_shared<uint64_t>(k));
+            }
+        }
+        void operate(size_t, bool read, XorShift& rng) override {
+            const uint64_t key = rng.next() % C_KEYS;
+            if (read) {
+                auto value = m_table.find(key);
+                static_cast<void>(value);
+                return;
+            }
+            m_table.update(key, std::make_shared<uint64_t>(key + 1));
+        }
+    private:
+        static constexpr uint64_t C_KEYS = 1024ULL;
+        HashTable<uint64_t, uint64_t, 1024> m_table;
+};
+
+using WorkloadFactory = std::function<std::unique_ptr<Workload>(size_t threads)>;
+
+template <typename W>
+WorkloadFactory factory(void) {
+    return [](size_t threads) { return std::make_unique<W>(threads); };
+}
+
+const std::vector<std::pair<std::string, WorkloadFactory>>& registry_of_workloads(void) {
+    static const std::vector<std::pair<std::string, WorkloadFactory>> workloads{
+        {"HashSet",          factory<HashSetWorkload>()},
+        {"BitmaskTable",     factory<BitmaskTableWorkload>()},
+        {"HazardRegistry",   factory<HazardRegistryWorkload>()},
+        {"ThreadRegistry",   factory<ThreadRegistryWorkload>()},
+        {"ProtectedPointer", factory<ProtectedPointerWorkload>()},
+        {"AtomicUniquePtr",  factory<AtomicUniquePtrWorkload>()},
+        {"HashTable",        factory<HashTableWorkload>()},
+    };
+    return workloads;
+}
+
+//--------------------------------------------------------------
+// Measurement
+//--------------------------------------------------------------
+struct SweepResult {
+    std::string component;
+    uint32_t read_ratio{0};
+    size_t threads{0};
+    uint64_t operations{0};
+    double seconds{0.0};
+    double ops_per_sec{0.0};
+    double efficiency{0.0};
+    Perf::Sample perf;  // summed over workers; divide by operations for per-op figures
+};
+
+struct alignas(64) PaddedCounter {
+    uint64_t value{0};
+    Perf::Sample perf;
+};
+
+SweepResult measure(const std::string& component,
+                    const WorkloadFactory& make,
+                    uint32_t read_ratio,
+                    size_t threads,
+                    const SweepOptions& options) {
+    auto workload = make(threads);
+    std::vector<PaddedCounter> counters(threads);
+    std::atomic<size_t> ready{0};
+    std::atomic<bool> start{false};
+    std::atomic<bool> stop{false};
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    for (size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t]() {
+            if (options.pin) {
+                static_cast<void>(pin_current_thread(t));
+            }
+            ThreadRegistry::instance().register_id();
+            Perf::CounterGroup perf;
+            XorShift rng(0x2545F4914F6CDD1DULL * (t + 1));
+            ready.fetch_add(1, std::memory_order_acq_rel);
+            while (!start.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            perf.start();
+            uint64_t ops = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                const bool read = (rng.next() % 100U) < read_ratio;
+                workload->operate(t, read, rng);
+                ++ops;
+            }
+            counters[t].perf  = perf.stop();
+            counters[t].value = ops;
+        });
+    }
+
+    while (ready.load(std::memory_order_acquire) < threads) {
+        std::this_thread::yield();
+    }
+    const auto begin = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+    std::this_thread::sleep_for(options.duration);
+    stop.store(true, std::memory_order_relaxed);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    const auto end = std::chrono::steady_clock::now();
+    workload.reset();
+
+    SweepResult result;
+    result.component  = component;
+    result.read_ratio = read_ratio;
+    result.threads    = threads;
+    for (const auto& counter : counters) {
+        result.operations += counter.value;
+        result.perf       += counter.perf;
+    }
+    result.seconds     = std::chrono::duration<double>(end - begin).count();
+    result.ops_per_sec = result.seconds > 0.0 ? static_cast<double>(result.operations) / result.seconds : 0.0;
+    return result;
+}
+
+double per_op(const SweepResult& r, size_t event) {
+    return r.operations ? r.perf.values.at(event) / static_cast<double>(r.operations) : 0.0;
+}
+
+// Efficiency = per-thread throughput at N threads over single-thread throughput.
+void fill_efficiency(std::vector<SweepResult>& results) {
+    std::map<std::pair<std::string, uint32_t>, double> single;
+    for (const auto& r : results) {
+        if (r.threads == 1) {
+            single[{r.component, r.read_ratio}] = r.ops_per_sec;
+        }
+    }
+    for (auto& r : results) {
+        const auto it = single.find({r.component, r.read_ratio});
+        if (it != single.end() and it->second > 0.0) {
+            r.efficiency = r.ops_per_sec / (it->second * static_cast<double>(r.threads));
+        }
+    }
+}
+
+//--------------------------------------------------------------
+// Reports
+//--------------------------------------------------------------
+std::string json_escape(const std::string& text) {
+    std::string out;
+    for (char c : text) {
+        if (c == '"' or c == '\\') {
+            out.push_back('\\');
+        }
+        out.push_back(c);
+    }
+    return out;
+}
+
+bool write_json(const std::string& path, const std::vector<SweepResult>& results, const SweepOptions& options) {
+    std::ofstream out(path);
+    if (!out) {
+        return false;
+    }
+    out << std::setprecision(12);
+    out << "{\n  \"context\": {\"hardware_threads\": " << hardware_threads()
+        << ", \"duration_ms\": " << options.duration.count()
+        << ", \"pinned\": " << (options.pin ? "true" : "false") << "},\n  \"results\": [\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto& r = results[i];
+        out << "    {\"component\": \"" << json_escape(r.component) << "\""
+            << ", \"read_ratio\": " << r.read_ratio
+            << ", \"threads\": " << r.threads
+            << ", \"operations\": " << r.operations
+            << ", \"seconds\": " << r.seconds
+            << ", \"ops_per_sec\": " << r.ops_per_sec
+            << ", \"efficiency\": " << r.efficiency;
+        for (size_t e = 0; e < Perf::C_EVENTS; ++e) {
+            if (r.perf.valid.at(e)) {
+                out << ", \"" << Perf::C_EVENT_NAMES.at(e) << "\": " << per_op(r, e);
+            }
+        }
+        out << "}"
+            << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    out << "  ]\n}\n";
+    return static_cast<bool>(out);
+}
+
+constexpr const char* C_CSV_HEADER = "component,read_ratio,threads,operations,seconds,ops_per_sec,efficiency,"
+                                     "cycles_per_op,instructions_per_op,l1d_misses_per_op,llc_misses_per_op,branch_misses_per_op";
+
+bool write_csv(const std::string& path, const std::vector<SweepResult>& results) {
+    std::ofstream out(path);
+    if (!out) {
+        return false;
+    }
+    out << std::setprecision(12);
+    out << C_CSV_HEADER << "\n";
+    for (const auto& r : results) {
+        out << r.component << ',' << r.read_ratio << ',' << r.threads << ',' << r.operations << ','
+            << r.seconds << ',' << r.ops_per_sec << ',' << r.efficiency;
+        // Counter columns stay empty when perf events were unavailable.
+        for (size_t e = 0; e < Perf::C_EVENTS; ++e) {
+            out << ',';
+            if (r.perf.valid.at(e)) {
+                out << per_op(r, e);
+            }
+        }
+        out << "\n";
+    }
+    return static_cast<bool>(out);
+}
+
+using BaselineKey = std::tuple<std::string, uint32_t, size_t>;
+
+std::optional<std::map<BaselineKey, double>> read_baseline(const std::string& path) {
+    std::ifstream in(path);
+    if (!in) {
+        return std::nullopt;
+    }
+    std::map<BaselineKey, double> baseline;
+    std::string line;
+    std::getline(in, line); // header
+    while (std::getline(in, line)) {
+        const auto fields = split(line, ',');
+        if (fields.size() < 6) {
+            continue;
+        }
+        baseline[{fields[0], static_cast<uint32_t>(std::stoul(fields[1])), std::stoul(fields[2])}] = std::stod(fields[5]);
+    }
+    return baseline;
+}
+
+// Returns the number of points whose throughput dropped by more than the threshold.
+size_t compare_baseline(const std::map<BaselineKey, double>& baseline,
+                        const std::vector<SweepResult>& results,
+                        double threshold) {
+    size_t regressions = 0;
+    std::printf("\n%-18s %6s %8s %14s %14s %9s\n", "component", "read%", "threads", "baseline", "current", "delta");
+    for (const auto& r : results) {
+        const auto it = baseline.find({r.component, r.read_ratio, r.threads});
+        if (it == baseline.end() or it->second <= 0.0) {
+            continue;
+        }
+        const double delta      = (r.ops_per_sec - it->second) / it->second;
+        const bool regressed    = delta < -threshold;
+        regressions            += regressed ? 1U : 0U;
+        std::printf("%-18s %6u %8zu %14.0f %14.0f %+8.1f%%%s\n",
+                    r.component.c_str(), r.read_ratio, r.threads, it->second, r.ops_per_sec,
+                    delta * 100.0, regressed ? "  REGRESSION" : "");
+    }
+    return regressions;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    auto parsed = parse_options(argc, argv);
+    if (!parsed) {
+        return 2;
+    }
+    const SweepOptions& options = parsed.value();
+
+    if (options.list) {
+        for (const auto& [name, make] : registry_of_workloads()) {
+            static_cast<void>(make);
+            std::cout << name << "\n";
+        }
+        return 0;
+    }
+
+    std::vector<SweepResult> results;
+    std::printf("%-18s %6s %8s %14s %10s\n", "component", "read%", "threads", "ops/sec", "efficiency");
+    for (const auto& [name, make] : registry_of_workloads()) {
+        if (!options.components.empty() and
+            std::find(options.components.begin(), options.components.end(), name) == options.components.end()) {
+            continue;
+        }
+        for (const uint32_t ratio : options.read_ratios) {
+            std::vector<SweepResult> series;
+            for (const size_t threads : options.threads) {
+                series.push_back(measure(name, make, ratio, threads, options));
+            }
+            fill_efficiency(series);
+            for (const auto& r : series) {
+                std::printf("%-18s %6u %8zu %14.0f %10.2f",
+                            r.component.c_str(), r.read_ratio, r.threads, r.ops_per_sec, r.efficiency);
+                for (size_t e = 0; e < Perf::C_EVENTS; ++e) {
+                    if (r.perf.valid.at(e)) {
+                        std::printf("  %s=%.2f", Perf::C_EVENT_NAMES.at(e).data(), per_op(r, e));
+                    }
+                }
+                std::printf("\n");
+            }
+            results.insert(results.end(), series.begin(), series.end());
+        }
+    }
+
+    if (!options.json_path.empty() and !write_json(options.json_path, results, options)) {
+        std::cerr << "failed to write " << options.json_path << std::endl;
+        return 2;
+    }
+    if (!options.csv_path.empty() and !write_csv(options.csv_path, results)) {
+        std::cerr << "failed to write " << options.csv_path << std::endl;
+        return 2;
+    }
+
+    if (!options.baseline_path.empty()) {
+        const auto baseline = read_baseline(options.baseline_path);
+        if (!baseline) {
+            std::cerr << "failed to read baseline " << options.baseline_path << std::endl;
+            return 2;
+        }
+        const size_t regressions = compare_baseline(baseline.value(), results, options.threshold);
+        if (regressions) {
+            std::printf("\n%zu regression(s) beyond %.1f%%\n", regressions, options.threshold * 100.0);
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,131 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "HashTable.hpp"
+#include "SnapshotMap.hpp"
+#include "PerfCounters.hpp"
+
+using namespace HazardSystem;
+
+// Read cost as the map grows. SnapshotMap::get pays one hazard publication
+// plus a binary search; Snapshot batches many lookups under that one
+// publication. HashTable::find loads a shared_ptr per bucket node, and the
+// baseline takes a shared lock.
+
+using Map = SnapshotMap<uint64_t, uint64_t>;
+
+static std::vector<std::pair<uint64_t, uint64_t>> entries(int64_t count) {
+    std::vector<std::pair<uint64_t, uint64_t>> out;
+    out.reserve(static_cast<size_t>(count));
+    for (int64_t i = 0; i < count; ++i) {
+        out.emplace_back(static_cast<uint64_t>(i) * 2654435761ULL, static_cast<uint64_t>(i));
+    }
+    return out;
+}
+
+static void BM_SnapshotMap_Get(benchmark::State& state) {
+    const auto data = entries(state.range(0));
+    Map map(data);
+    size_t i = 0;
+
+    Perf::Scope perf(state, 1.0);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(map.get(data[i].first));
+        i = (i + 1) % data.size();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+// 64 lookups under a single protect.
+static void BM_SnapshotMap_SnapshotBatch64(benchmark::State& state) {
+    const auto data = entries(state.range(0));
+    Map map(data);
+    size_t i = 0;
+
+    Perf::Scope perf(state, 64.0);
+    for (auto _ : state) {
+        auto snapshot = map.snapshot();
+        for (int k = 0; k < 64; ++k) {
+            benchmark::DoNotOptimize(snapshot->find(data[i].first));
+            i = (i + 1) % data.size();
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * 64);
+}
+
+static void BM_HashTable_Find(benchmark::State& state) {
+    const auto data = entries(state.range(0));
+    HashTable<uint64_t, uint64_t, 4096> table;
+    for (const auto& [key, value] : data) {
+        table.insert(key, std::make_shared<uint64_t>(value));
+    }
+    size_t i = 0;
+
+    Perf::Scope perf(state, 1.0);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(table.find(data[i].first));
+        i = (i + 1) % data.size();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_SharedMutexMap_Find(benchmark::State& state) {
+    const auto data = entries(state.range(0));
+    std::unordered_map<uint64_t, uint64_t> map(data.begin(), data.end());
+    std::shared_mutex mutex;
+    size_t i = 0;
+
+    Perf::Scope perf(state, 1.0);
+    for (auto _ : state) {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        auto it = map.find(data[i].first);
+        benchmark::DoNotOptimize(it);
+        i = (i + 1) % data.size();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Writer cost: one copy of the map per commit, whatever the batch size.
+static void BM_SnapshotMap_Commit(benchmark::State& state) {
+    const auto data    = entries(state.range(0));
+    const int64_t size = state.range(1);
+    Map map(data);
+    uint64_t next = 0;
+
+    for (auto _ : state) {
+        Map::Batch batch;
+        for (int64_t k = 0; k < size; ++k) {
+            batch.insert_or_assign(data[next % data.size()].first, next);
+            ++next;
+        }
+        benchmark::DoNotOptimize(map.commit(batch));
+    }
+
+    state.SetItemsProcessed(state.iterations() * size);
+}
+
+BENCHMARK(BM_SnapshotMap_Get)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK(BM_SnapshotMap_SnapshotBatch64)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK(BM_HashTable_Find)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK(BM_SharedMutexMap_Find)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK(BM_SnapshotMap_Commit)->ArgsProduct({{1024, 1 << 16}, {1, 64}})->ArgNames({"entries", "batch"});
+
+int main(int argc, char** argv) {
+    std::cout << "SnapshotMap: one-protect reads vs HashTable vs shared_mutex map, and commit cost\n";
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,100 @@
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "HazardPointerManager.hpp"
+#include "ThreadRegistry.hpp"
+
+using namespace HazardSystem;
+
+struct ChurnNode {
+    explicit ChurnNode(int v = 0) : value(v) {}
+    int value;
+};
+
+using ChurnManager = HazardPointerManager<ChurnNode, 0>;
+
+// Each short-lived thread registers, protects the shared node once, swaps in a
+// replacement, retires the old node and exits. This is the lifecycle an RPC
+// layer pays for every spawned worker.
+static void churn_once(ChurnManager& manager, std::atomic<ChurnNode*>& source, int seed) {
+    auto guard = manager.protect(source);
+    benchmark::DoNotOptimize(guard.get());
+    guard.reset();
+    manager.retire(source.exchange(new ChurnNode(seed), std::memory_order_acq_rel));
+}
+
+// Spawn and join one thread per iteration.
+static void BM_ThreadChurn_Sequential(benchmark::State& state) {
+    auto& manager = ChurnManager::instance(64);
+    std::atomic<ChurnNode*> source{new ChurnNode(0)};
+    int seed = 0;
+
+    for (auto _ : state) {
+        std::thread([&manager, &source, s = ++seed] {
+            churn_once(manager, source, s);
+        }).join();
+    }
+
+    delete source.exchange(nullptr);
+    manager.reclaim();
+    state.counters["records"] = static_cast<double>(manager.record_size());
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Spawn a burst of concurrent short-lived threads per iteration.
+static void BM_ThreadChurn_Burst(benchmark::State& state) {
+    const size_t burst = static_cast<size_t>(state.range(0));
+    auto& manager = ChurnManager::instance(64);
+    std::atomic<ChurnNode*> source{new ChurnNode(0)};
+    std::vector<std::thread> threads;
+    threads.reserve(burst);
+    int seed = 0;
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < burst; ++i) {
+            threads.emplace_back([&manager, &source, s = ++seed] {
+                churn_once(manager, source, s);
+            });
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+        threads.clear();
+    }
+
+    delete source.exchange(nullptr);
+    manager.reclaim();
+    state.counters["records"] = static_cast<double>(manager.record_size());
+    state.SetItemsProcessed(state.iterations() * burst);
+}
+
+// Baseline: the cost of a bare thread spawn/join with no hazard system use.
+static void BM_ThreadChurn_BareThread(benchmark::State& state) {
+    for (auto _ : state) {
+        std::thread([] {
+            benchmark::ClobberMemory();
+        }).join();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_ThreadChurn_BareThread)->UseRealTime();
+BENCHMARK(BM_ThreadChurn_Sequential)->UseRealTime();
+BENCHMARK(BM_ThreadChurn_Burst)->RangeMultiplier(2)->Range(2, 16)->UseRealTime();
+
+int main(int argc, char** argv) {
+    ::benchmark::Initialize(&argc, argv);
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+
+    std::cout << "=== Thread Churn Benchmark ===\n";
+    std::cout << "items_per_second is short-lived threads completed per second.\n\n";
+
+    ::benchmark::RunSpecifiedBenchmarks();
+    ::benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,104 @@
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+
+#include "HazardPointerManager.hpp"
+#include "PerfCounters.hpp"
+#include "VersionedCell.hpp"
+#include "atomic_unique_ptr.hpp"
+
+using namespace HazardSystem;
+
+// Reading a small published value of 16..2048 bytes from 1..4 threads. Each
+// iteration reads the whole value (sums every word). Every 64 iterations
+// thread 0 replaces it, so both sides pay their write path too.
+//   VersionedCell:     seqlock copy, retried if a store overlapped.
+//   atomic_unique_ptr: protect(), read through the hazard, release; a store
+//                      allocates the new value and retires the old one.
+// The size where the two lines cross is where to switch from one to the other.
+// Items are reads.
+
+template <size_t Bytes>
+struct Payload {
+    uint64_t words[Bytes / sizeof(uint64_t)];
+};
+
+template <size_t Bytes>
+static Payload<Bytes> make_payload(const uint64_t& seed) {
+    Payload<Bytes> payload;
+    for (size_t i = 0; i < Bytes / sizeof(uint64_t); ++i) {
+        payload.words[i] = seed + i;
+    }
+    return payload;
+}
+
+template <size_t Bytes>
+static uint64_t sum(const Payload<Bytes>& payload) {
+    uint64_t total = 0;
+    for (size_t i = 0; i < Bytes / sizeof(uint64_t); ++i) {
+        total += payload.words[i];
+    }
+    return total;
+}
+
+template <typename Read, typename Replace>
+static void run(benchmark::State& state, Read&& read, Replace&& replace) {
+    uint64_t total = 0;
+    uint64_t i     = 0;
+    Perf::Scope perf(state, 1.0);
+    for (auto _ : state) {
+        total += read();
+        if (state.thread_index() == 0 and (++i & 63u) == 0) {
+            replace(i);
+        }
+    }
+    benchmark::DoNotOptimize(total);
+    state.SetItemsProcessed(state.iterations());
+}
+
+template <size_t Bytes>
+static void BM_VersionedCell_Read(benchmark::State& state) {
+    static VersionedCell<Payload<Bytes>> s_cell(make_payload<Bytes>(1));
+    run(state,
+        [] { return sum(*s_cell.protect()); },
+        [](uint64_t i) { s_cell.store(make_payload<Bytes>(i)); });
+}
+
+template <size_t Bytes>
+static void BM_AtomicUniquePtr_Read(benchmark::State& state) {
+    // Sized before atomic_unique_ptr caches the default (one slot per core) instance.
+    static auto& s_manager = HazardPointerManager<Payload<Bytes>>::instance(64);
+    static atomic_unique_ptr<Payload<Bytes>> s_ptr(new Payload<Bytes>(make_payload<Bytes>(1)));
+    benchmark::DoNotOptimize(&s_manager);
+    run(state,
+        [] {
+            auto view = s_ptr.protect();
+            return view ? sum(*view) : 0;
+        },
+        [](uint64_t i) { s_ptr.store(new Payload<Bytes>(make_payload<Bytes>(i))); });
+}
+
+#define VERSIONED_CELL_SIZES(BM)                                          \
+    BENCHMARK_TEMPLATE(BM, 16)->ThreadRange(1, 4)->UseRealTime();         \
+    BENCHMARK_TEMPLATE(BM, 32)->ThreadRange(1, 4)->UseRealTime();         \
+    BENCHMARK_TEMPLATE(BM, 64)->ThreadRange(1, 4)->UseRealTime();         \
+    BENCHMARK_TEMPLATE(BM, 128)->ThreadRange(1, 4)->UseRealTime();        \
+    BENCHMARK_TEMPLATE(BM, 256)->ThreadRange(1, 4)->UseRealTime();        \
+    BENCHMARK_TEMPLATE(BM, 512)->ThreadRange(1, 4)->UseRealTime();        \
+    BENCHMARK_TEMPLATE(BM, 1024)->ThreadRange(1, 4)->UseRealTime();       \
+    BENCHMARK_TEMPLATE(BM, 2048)->ThreadRange(1, 4)->UseRealTime()
+
+VERSIONED_CELL_SIZES(BM_VersionedCell_Read);
+VERSIONED_CELL_SIZES(BM_AtomicUniquePtr_Read);
+
+int main(int argc, char** argv) {
+    std::cout << "VersionedCell: seqlock copy vs hazard-protected atomic_unique_ptr by value size\n";
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,127 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "HazardPointerManager.hpp"
+#include "PerfCounters.hpp"
+
+using namespace HazardSystem;
+
+// R readers protect one source 8192 times each while 2 writers replace it
+// (new node, exchange, retire) as fast as they can. Every protect is timed
+// on its own; the counters report the p50/p99/p99.9/max of those latencies
+// across all readers, and how many calls came back empty. try_protect gives
+// up after 100 lost validations; wait_free_protect posts a help request
+// after 4 and never fails. Items are protect calls.
+
+static constexpr size_t C_PER_READER = 8192;
+static constexpr int C_WRITERS       = 2;
+
+struct Quote {
+    uint64_t price;
+    uint64_t size;
+};
+
+using Manager = HazardPointerManager<Quote, 0>;
+
+template <typename Protect>
+static void run_storm(benchmark::State& state, Protect&& protect) {
+    const size_t readers = static_cast<size_t>(state.range(0));
+    Manager& manager     = Manager::instance(64);
+    std::atomic<Quote*> source{new Quote{0, 0}};
+
+    std::vector<uint64_t> latencies;
+    uint64_t failed = 0;
+    Perf::Scope perf(state, static_cast<double>(readers * C_PER_READER));
+    for (auto _ : state) {
+        std::atomic<bool> stop{false};
+        std::atomic<size_t> ready{0};
+        std::atomic<uint64_t> empty{0};
+        std::vector<std::vector<uint64_t>> samples(readers);
+        std::vector<std::thread> threads;
+
+        for (int w = 0; w < C_WRITERS; ++w) {
+            threads.emplace_back([&] {
+                uint64_t price = 0;
+                while (!stop.load(std::memory_order_relaxed)) {
+                    manager.retire(source.exchange(new Quote{++price, price}));
+                }
+            });
+        }
+        for (size_t r = 0; r < readers; ++r) {
+            threads.emplace_back([&, r] {
+                auto& mine = samples[r];
+                mine.reserve(C_PER_READER);
+                ready.fetch_add(1);
+                while (ready.load() < readers) {
+                    std::this_thread::yield();
+                }
+                uint64_t sum = 0;
+                for (size_t i = 0; i < C_PER_READER; ++i) {
+                    const auto start = std::chrono::steady_clock::now();
+                    auto guard       = protect(manager, source);
+                    const auto end   = std::chrono::steady_clock::now();
+                    mine.push_back(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()));
+                    if (guard) {
+                        sum += guard->price;
+                    } else {
+                        empty.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+                benchmark::DoNotOptimize(sum);
+            });
+        }
+        for (size_t t = C_WRITERS; t < threads.size(); ++t) {
+            threads[t].join();
+        }
+        stop.store(true);
+        for (int w = 0; w < C_WRITERS; ++w) {
+            threads[static_cast<size_t>(w)].join();
+        }
+
+        for (const auto& mine : samples) {
+            latencies.insert(latencies.end(), mine.begin(), mine.end());
+        }
+        failed += empty.load();
+        manager.reclaim();
+    }
+    delete source.exchange(nullptr);
+
+    std::sort(latencies.begin(), latencies.end());
+    const auto at = [&](double q) {
+        return static_cast<double>(latencies[std::min(latencies.size() - 1, static_cast<size_t>(q * static_cast<double>(latencies.size())))]);
+    };
+    state.counters["p50_ns"]  = at(0.50);
+    state.counters["p99_ns"]  = at(0.99);
+    state.counters["p999_ns"] = at(0.999);
+    state.counters["max_ns"]  = static_cast<double>(latencies.back());
+    state.counters["failed"]  = static_cast<double>(failed);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(readers * C_PER_READER));
+}
+
+static void BM_WaitFreeProtect_Storm(benchmark::State& state) {
+    run_storm(state, [](Manager& manager, std::atomic<Quote*>& source) { return manager.wait_free_protect(source); });
+}
+
+static void BM_TryProtect_Storm(benchmark::State& state) {
+    run_storm(state, [](Manager& manager, std::atomic<Quote*>& source) { return manager.try_protect(source); });
+}
+
+BENCHMARK(BM_WaitFreeProtect_Storm)->RangeMultiplier(2)->Range(1, 4)->UseRealTime();
+BENCHMARK(BM_TryProtect_Storm)->RangeMultiplier(2)->Range(1, 4)->UseRealTime();
+
+int main(int argc, char** argv) {
+    std::cout << "WaitFreeProtect: helped protect vs try_protect under a writer storm\n";
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
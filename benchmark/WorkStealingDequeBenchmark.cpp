@@ -0,0 +1,101 @@
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+
+#include "WorkStealingDeque.hpp"
+#include "PerfCounters.hpp"
+
+using namespace HazardSystem;
+
+using Deque = WorkStealingDeque<uint64_t>;
+
+// Owner-only traffic: push a batch, pop it back. Growth happens on the first
+// iterations only, so this is the steady-state push/pop cost.
+static void BM_WorkStealingDeque_OwnerPushPop(benchmark::State& state) {
+    const int64_t batch = state.range(0);
+    Deque deque(64);
+
+    Perf::Scope perf(state, static_cast<double>(batch * 2));
+    for (auto _ : state) {
+        for (int64_t i = 0; i < batch; ++i) {
+            deque.push(static_cast<uint64_t>(i));
+        }
+        for (int64_t i = 0; i < batch; ++i) {
+            benchmark::DoNotOptimize(deque.pop());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * batch * 2);
+}
+
+// Growth from a tiny buffer every iteration: each doubling retires the old
+// buffer through the hazard manager.
+static void BM_WorkStealingDeque_GrowAndRetire(benchmark::State& state) {
+    const int64_t items = state.range(0);
+
+    for (auto _ : state) {
+        Deque deque(2);
+        for (int64_t i = 0; i < items; ++i) {
+            deque.push(static_cast<uint64_t>(i));
+        }
+        benchmark::DoNotOptimize(deque.capacity());
+    }
+
+    state.SetItemsProcessed(state.iterations() * items);
+}
+
+// Thread 0 owns the deque and keeps it stocked; every other thread steals.
+// items_per_second counts successful steals and owner pops together.
+static std::unique_ptr<Deque> g_deque;
+
+static void BM_WorkStealingDeque_Steal(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        g_deque = std::make_unique<Deque>(1024, static_cast<size_t>(state.threads()));
+    }
+
+    int64_t taken = 0;
+    if (state.thread_index() == 0) {
+        uint64_t next = 0;
+        for (auto _ : state) {
+            // Keep roughly a few hundred items available to the thieves.
+            if (g_deque->size() < 512) {
+                for (int i = 0; i < 64; ++i) {
+                    g_deque->push(next++);
+                }
+            }
+            if (g_deque->pop()) {
+                ++taken;
+            }
+        }
+    } else {
+        for (auto _ : state) {
+            if (g_deque->steal()) {
+                ++taken;
+            }
+        }
+    }
+
+    state.SetItemsProcessed(taken);
+    if (state.thread_index() == 0) {
+        state.counters["thieves"] = static_cast<double>(state.threads() - 1);
+    }
+}
+
+BENCHMARK(BM_WorkStealingDeque_OwnerPushPop)->RangeMultiplier(8)->Range(8, 4096);
+BENCHMARK(BM_WorkStealingDeque_GrowAndRetire)->RangeMultiplier(16)->Range(256, 1 << 16);
+BENCHMARK(BM_WorkStealingDeque_Steal)
+    ->Threads(3)->Threads(5)->Threads(9)->Threads(17)->Threads(33)->Threads(65)
+    ->UseRealTime();
+
+int main(int argc, char** argv) {
+    std::cout << "Chase-Lev work-stealing deque (owner push/pop, growth, 2-64 thieves)\n";
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,844 @@
+#pragma once
+//--------------------------------------------------------------
+// Standard C++ library
+//--------------------------------------------------------------
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <array>
+#include <algorithm>
+#include <functional>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+//--------------------------------------------------------------
+// User Defined Headers
+//--------------------------------------------------------------
+#include "Backoff.hpp"
+#include "HazardPointerManager.hpp"
+#include "ProtectedPointer.hpp"
+//--------------------------------------------------------------
+namespace HazardSystem {
+    //--------------------------------------------------------------
+    // B+-tree with optimistic lock coupling (Leis et al., "The ART of
+    // Practical Synchronization"), for ordered data that is too large for a
+    // skip list's per-key towers.
+    //
+    // Every node carries a version word: bit 0 obsolete, bit 1 locked, the
+    // rest a counter bumped by each unlock. Readers never write to shared
+    // memory beyond their hazard slots: they note a node's version, read it,
+    // and restart if the version moved. Writers descend the same way and
+    // upgrade only the one or two nodes they change. Full nodes are split on
+    // the way down, so a split never propagates upwards.
+    //
+    // Optimistic reads may see a node freed under them, so nodes are owned
+    // through HazardPointerManager<Node>. Descent is hand over hand: protect
+    // the child, then validate the parent's version, which proves the child
+    // was still linked after the hazard went up. A lookup holds two hazards,
+    // an insert three. Erase merges a leaf that falls under a quarter full
+    // into its right sibling when both fit; the absorbed leaf (and a root
+    // left with a single child) is marked obsolete and retired. Inner nodes
+    // are allowed to run sparse.
+    //
+    // Iterators copy one leaf at a time and protect only that leaf, to follow
+    // its next link. Keys and values are read while writers may be moving
+    // them, hence stored as atomics and required to be trivially copyable.
+    //--------------------------------------------------------------
+    template<typename Key, typename Value, typename Compare = std::less<Key>>
+    class BPlusTree {
+        //--------------------------------------------------------------
+        static_assert(std::is_trivially_copyable_v<Key> and std::is_trivially_copyable_v<Value>,
+                      "BPlusTree reads keys and values optimistically; both must be trivially copyable");
+        //--------------------------------------------------------------
+        public:
+            //--------------------------------------------------------------
+            struct Node {
+                //--------------------------
+                explicit Node(const bool& leaf_) : leaf(leaf_), version(0UL), count(0U) {
+                    //--------------------------
+                }// end explicit Node(const bool& leaf_)
+                //--------------------------
+                Node(const Node&)               = delete;
+                Node& operator=(const Node&)    = delete;
+                //--------------------------
+                virtual ~Node(void) = default;
+                //--------------------------
+                const bool leaf;
+                std::atomic<uint64_t> version;
+                std::atomic<uint16_t> count;
+                //--------------------------
+            };// end struct Node
+            //--------------------------------------------------------------
+            using Manager = HazardPointerManager<Node, 0>;
+            //--------------------------------------------------------------
+            // Forward iterator over a snapshot of one leaf at a time. Entries a
+            // writer adds or removes while the iterator is elsewhere may or may
+            // not be seen; keys come out strictly increasing. The tree must
+            // outlive it.
+            class Iterator {
+                //--------------------------------------------------------------
+                public:
+                    //--------------------------------------------------------------
+                    Iterator(Iterator&&) noexcept               = default;
+                    Iterator& operator=(Iterator&&) noexcept    = default;
+                    Iterator(const Iterator&)                   = delete;
+                    Iterator& operator=(const Iterator&)        = delete;
+                    //--------------------------
+                    bool valid(void) const {
+                        return m_index < m_entries.size();
+                    }// end bool valid(void) const
+                    //--------------------------
+                    explicit operator bool(void) const {
+                        return valid();
+                    }// end explicit operator bool(void) const
+                    //--------------------------
+                    const Key& key(void) const {
+                        return m_entries[m_index].first;
+                    }// end const Key& key(void) const
+                    //--------------------------
+                    const Value& value(void) const {
+                        return m_entries[m_index].second;
+                    }// end const Value& value(void) const
+                    //--------------------------
+                    Iterator& operator++(void) {
+                        //--------------------------
+                        if (++m_index == m_entries.size()) {
+                            m_tree->next_leaf(*this);
+                        }// end if (++m_index == m_entries.size())
+                        return *this;
+                        //--------------------------
+                    }// end Iterator& operator++(void)
+                    //--------------------------------------------------------------
+                private:
+                    //--------------------------------------------------------------
+                    friend class BPlusTree;
+                    //--------------------------
+                    explicit Iterator(const BPlusTree* tree) : m_tree(tree), m_index(0UL) {
+                        m_entries.reserve(C_LEAF_CAPACITY);
+                    }// end explicit Iterator(const BPlusTree* tree)
+                    //--------------------------
+                    const BPlusTree* m_tree;
+                    ProtectedPointer<Node> m_leaf;
+                    std::vector<std::pair<Key, Value>> m_entries;
+                    size_t m_index;
+                //--------------------------------------------------------------
+            };// end class Iterator
+            //--------------------------------------------------------------
+            // readers sizes the node manager shared by every tree of this type,
+            // on first use only; each thread needs up to three slots.
+            explicit BPlusTree(const size_t& readers = C_DEFAULT_READERS) : m_manager(Manager::instance(std::max<size_t>(1UL, readers) * C_HAZARDS_PER_THREAD)),
+                                                                            m_root(new Leaf()),
+                                                                            m_size(0UL) {
+                //--------------------------
+            }// end explicit BPlusTree(const size_t& readers)
+            //--------------------------
+            BPlusTree(const BPlusTree&)             = delete;
+            BPlusTree& operator=(const BPlusTree&)  = delete;
+            BPlusTree(BPlusTree&&)                  = delete;
+            BPlusTree& operator=(BPlusTree&&)       = delete;
+            //--------------------------
+            // No other thread may still be using the tree.
+            ~BPlusTree(void) {
+                destroy(m_root.load(std::memory_order_acquire));
+            }// end ~BPlusTree(void)
+            //--------------------------
+            // True if key was new, false if an existing value was replaced.
+            bool insert_or_assign(const Key& key, const Value& value) {
+                return insert_data(key, value);
+            }// end bool insert_or_assign(const Key& key, const Value& value)
+            //--------------------------
+            bool erase(const Key& key) {
+                return erase_data(key);
+            }// end bool erase(const Key& key)
+            //--------------------------
+            std::optional<Value> find(const Key& key) const {
+                return find_data(key);
+            }// end std::optional<Value> find(const Key& key) const
+            //--------------------------
+            bool contains(const Key& key) const {
+                return find_data(key).has_value();
+            }// end bool contains(const Key& key) const
+            //--------------------------
+            // First entry whose key is not less than key.
+            Iterator lower_bound(const Key& key) const {
+                //--------------------------
+                Iterator _it(this);
+                seek(_it, &key, false);
+                return _it;
+                //--------------------------
+            }// end Iterator lower_bound(const Key& key) const
+            //--------------------------
+            Iterator begin(void) const {
+                //--------------------------
+                Iterator _it(this);
+                seek(_it, nullptr, false);
+                return _it;
+                //--------------------------
+            }// end Iterator begin(void) const
+            //--------------------------
+            // Calls fn(key, value) in key order for up to limit entries from the
+            // first key not less than from; returns how many it visited.
+            template<typename Fn>
+            size_t scan(const Key& from, const size_t& limit, Fn&& fn) const {
+                //--------------------------
+                size_t _visited = 0UL;
+                for (Iterator _it = lower_bound(from); _it and _visited < limit; ++_it, ++_visited) {
+                    fn(_it.key(), _it.value());
+                }// end for (Iterator _it = lower_bound(from); ...)
+                return _visited;
+                //--------------------------
+            }// end size_t scan(const Key& from, const size_t& limit, Fn&& fn) const
+            //--------------------------
+            size_t size(void) const {
+                return m_size.load(std::memory_order_relaxed);
+            }// end size_t size(void) const
+            //--------------------------
+            bool empty(void) const {
+                return size() == 0UL;
+            }// end bool empty(void) const
+            //--------------------------------------------------------------
+        protected:
+            //--------------------------------------------------------------
+            static constexpr size_t C_LEAF_CAPACITY  = 64UL;
+            static constexpr size_t C_INNER_CAPACITY = 64UL;
+            //--------------------------
+            struct Leaf final : Node {
+                Leaf(void) : Node(true), next(nullptr) {
+                    //--------------------------
+                }// end Leaf(void)
+                //--------------------------
+                std::array<std::atomic<Key>, C_LEAF_CAPACITY> keys;
+                std::array<std::atomic<Value>, C_LEAF_CAPACITY> values;
+                // Right neighbour, for iterators; changed under this leaf's lock.
+                std::atomic<Leaf*> next;
+            };// end struct Leaf
+            //--------------------------
+            // children[i] holds keys <= keys[i]; children[count] the rest.
+            struct Inner final : Node {
+                Inner(void) : Node(false) {
+                    //--------------------------
+                }// end Inner(void)
+                //--------------------------
+                std::array<std::atomic<Key>, C_INNER_CAPACITY> keys;
+                std::array<std::atomic<Node*>, C_INNER_CAPACITY + 1UL> children{};
+            };// end struct Inner
+            //--------------------------
+            enum class Step : uint8_t {
+                Done = 0,
+                // The tree changed shape under us (usually our own split).
+                Retry,
+                // A version check failed or a node was locked.
+                Contended
+            };// end enum class Step
+            //--------------------------------------------------------------
+            // Version lock
+            //--------------------------------------------------------------
+            static bool read_lock(const Node* node, uint64_t& version) {
+                version = node->version.load(std::memory_order_acquire);
+                return (version & (C_LOCKED | C_OBSOLETE)) == 0UL;
+            }// end static bool read_lock(const Node* node, uint64_t& version)
+            //--------------------------
+            // seq_cst so that a hazard published before it is visible to a writer
+            // that locks the node afterwards and then retires one of its children.
+            static bool validate(const Node* node, const uint64_t& version) {
+                return node->version.load(std::memory_order_seq_cst) == version;
+            }// end static bool validate(const Node* node, const uint64_t& version)
+            //--------------------------
+            static bool obsolete(const Node* node) {
+                return node->version.load(std::memory_order_acquire) & C_OBSOLETE;
+            }// end static bool obsolete(const Node* node)
+            //--------------------------
+            static bool upgrade(Node* node, const uint64_t& version) {
+                uint64_t _expected = version;
+                return node->version.compare_exchange_strong(_expected, version + C_LOCKED, std::memory_order_seq_cst, std::memory_order_relaxed);
+            }// end static bool upgrade(Node* node, const uint64_t& version)
+            //--------------------------
+            // Only for a node nobody else can unlink: its parent is write-locked.
+            static void write_lock(Node* node) {
+                //--------------------------
+                Backoff _backoff;
+                while (true) {
+                    uint64_t _version = node->version.load(std::memory_order_relaxed);
+                    if (!(_version & C_LOCKED) and upgrade(node, _version)) {
+                        return;
+                    }// end if (!(_version & C_LOCKED) and upgrade(node, _version))
+                    _backoff.pause();
+                }// end while (true)
+                //--------------------------
+            }// end static void write_lock(Node* node)
+            //--------------------------
+            // Clears the lock bit and carries into the counter.
+            static void write_unlock(Node* node) {
+                node->version.fetch_add(C_LOCKED, std::memory_order_release);
+            }// end static void write_unlock(Node* node)
+            //--------------------------
+            static void write_unlock_obsolete(Node* node) {
+                node->version.fetch_add(C_LOCKED | C_OBSOLETE, std::memory_order_release);
+            }// end static void write_unlock_obsolete(Node* node)
+            //--------------------------------------------------------------
+            // Node contents (callers validate or hold the lock)
+            //--------------------------------------------------------------
+            static size_t entries(const Node* node) {
+                //--------------------------
+                // A torn read may see any count; never index past the arrays.
+                const size_t _count = node->count.load(std::memory_order_relaxed);
+                return std::min(_count, node->leaf ? C_LEAF_CAPACITY : C_INNER_CAPACITY);
+                //--------------------------
+            }// end static size_t entries(const Node* node)
+            //--------------------------
+            template<size_t N>
+            size_t search(const std::array<std::atomic<Key>, N>& keys, const size_t& count, const Key& key) const {
+                //--------------------------
+                size_t _low = 0UL, _high = count;
+                while (_low < _high) {
+                    const size_t _middle = (_low + _high) / 2UL;
+                    if (m_compare(keys[_middle].load(std::memory_order_relaxed), key)) {
+                        _low = _middle + 1UL;
+                    } else {
+                        _high = _middle;
+                    }// end if (m_compare(...))
+                }// end while (_low < _high)
+                return _low;
+                //--------------------------
+            }// end size_t search(const std::array<std::atomic<Key>, N>& keys, const size_t& count, const Key& key) const
+            //--------------------------
+            bool full(const Node* node) const {
+                return entries(node) == (node->leaf ? C_LEAF_CAPACITY : C_INNER_CAPACITY);
+            }// end bool full(const Node* node) const
+            //--------------------------
+            Node* child_for(const Inner* inner, const Key& key) const {
+                return inner->children[search(inner->keys, entries(inner), key)].load(std::memory_order_acquire);
+            }// end Node* child_for(const Inner* inner, const Key& key) const
+            //--------------------------
+            bool leaf_insert(Leaf* leaf, const Key& key, const Value& value) const {
+                //--------------------------
+                const size_t _count = entries(leaf);
+                const size_t _pos   = search(leaf->keys, _count, key);
+                if (_pos < _count and !m_compare(key, leaf->keys[_pos].load(std::memory_order_relaxed))) {
+                    leaf->values[_pos].store(value, std::memory_order_relaxed);
+                    return false;
+                }// end if (key already present)
+                //--------------------------
+                for (size_t i = _count; i > _pos; --i) {
+                    leaf->keys[i].store(leaf->keys[i - 1UL].load(std::memory_order_relaxed), std::memory_order_relaxed);
+                    leaf->values[i].store(leaf->values[i - 1UL].load(std::memory_order_relaxed), std::memory_order_relaxed);
+                }// end for (size_t i = _count; i > _pos; --i)
+                leaf->keys[_pos].store(key, std::memory_order_relaxed);
+                leaf->values[_pos].store(value, std::memory_order_relaxed);
+                leaf->count.store(static_cast<uint16_t>(_count + 1UL), std::memory_order_relaxed);
+                return true;
+                //--------------------------
+            }// end bool leaf_insert(Leaf* leaf, const Key& key, const Value& value) const
+            //--------------------------
+            bool leaf_remove(Leaf* leaf, const Key& key) const {
+                //--------------------------
+                const size_t _count = entries(leaf);
+                const size_t _pos   = search(leaf->keys, _count, key);
+                if (_pos == _count or m_compare(key, leaf->keys[_pos].load(std::memory_order_relaxed))) {
+                    return false;
+                }// end if (key not present)
+                //--------------------------
+                for (size_t i = _pos + 1UL; i < _count; ++i) {
+                    leaf->keys[i - 1UL].store(leaf->keys[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+                    leaf->values[i - 1UL].store(leaf->values[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+                }// end for (size_t i = _pos + 1UL; i < _count; ++i)
+                leaf->count.store(static_cast<uint16_t>(_count - 1UL), std::memory_order_relaxed);
+                return true;
+                //--------------------------
+            }// end bool leaf_remove(Leaf* leaf, const Key& key) const
+            //--------------------------
+            // Links child as the right neighbour of the child that held separator.
+            void inner_insert(Inner* inner, const Key& separator, Node* child) const {
+                //--------------------------
+                const size_t _count = entries(inner);
+                const size_t _pos   = search(inner->keys, _count, separator);
+                for (size_t i = _count; i > _pos; --i) {
+                    inner->keys[i].store(inner->keys[i - 1UL].load(std::memory_order_relaxed), std::memory_order_relaxed);
+                    inner->children[i + 1UL].store(inner->children[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+                }// end for (size_t i = _count; i > _pos; --i)
+                inner->keys[_pos].store(separator, std::memory_order_relaxed);
+                inner->children[_pos + 1UL].store(child, std::memory_order_release);
+                inner->count.store(static_cast<uint16_t>(_count + 1UL), std::memory_order_relaxed);
+                //--------------------------
+            }// end void inner_insert(Inner* inner, const Key& separator, Node* child) const
+            //--------------------------
+            // Drops keys[pos] and children[pos + 1].
+            static void inner_remove(Inner* inner, const size_t& pos) {
+                //--------------------------
+                const size_t _count = entries(inner);
+                for (size_t i = pos + 1UL; i < _count; ++i) {
+                    inner->keys[i - 1UL].store(inner->keys[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+                    inner->children[i].store(inner->children[i + 1UL].load(std::memory_order_relaxed), std::memory_order_relaxed);
+                }// end for (size_t i = pos + 1UL; i < _count; ++i)
+                inner->count.store(static_cast<uint16_t>(_count - 1UL), std::memory_order_relaxed);
+                //--------------------------
+            }// end static void inner_remove(Inner* inner, const size_t& pos)
+            //--------------------------
+            // Moves the upper half of node (locked) into a new right sibling.
+            // Returns the sibling and the separator that goes up to the parent.
+            static std::pair<Node*, Key> split(Node* node) {
+                //--------------------------
+                const size_t _count = entries(node);
+                const size_t _keep  = _count / 2UL;
+                //--------------------------
+                if (node->leaf) {
+                    auto* _leaf  = static_cast<Leaf*>(node);
+                    auto* _right = new Leaf();
+                    for (size_t i = _keep; i < _count; ++i) {
+                        _right->keys[i - _keep].store(_leaf->keys[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+                        _right->values[i - _keep].store(_leaf->values[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+                    }// end for (size_t i = _keep; i < _count; ++i)
+                    _right->count.store(static_cast<uint16_t>(_count - _keep), std::memory_order_relaxed);
+                    _right->next.store(_leaf->next.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                    _leaf->count.store(static_cast<uint16_t>(_keep), std::memory_order_relaxed);
+                    _leaf->next.store(_right, std::memory_order_release);
+                    return {_right, _leaf->keys[_keep - 1UL].load(std::memory_order_relaxed)};
+                }// end if (node->leaf)
+                //--------------------------
+                // The middle key moves up and leaves both halves.
+                auto* _inner = static_cast<Inner*>(node);
+                auto* _right = new Inner();
+                for (size_t i = _keep + 1UL; i < _count; ++i) {
+                    _right->keys[i - _keep - 1UL].store(_inner->keys[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+                }// end for (size_t i = _keep + 1UL; i < _count; ++i)
+                for (size_t i = _keep + 1UL; i <= _count; ++i) {
+                    _right->children[i - _keep - 1UL].store(_inner->children[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+                }// end for (size_t i = _keep + 1UL; i <= _count; ++i)
+                _right->count.store(static_cast<uint16_t>(_count - _keep - 1UL), std::memory_order_relaxed);
+                _inner->count.store(static_cast<uint16_t>(_keep), std::memory_order_relaxed);
+                return {_right, _inner->keys[_keep].load(std::memory_order_relaxed)};
+                //--------------------------
+            }// end static std::pair<Node*, Key> split(Node* node)
+            //--------------------------------------------------------------
+            // Descent
+            //--------------------------------------------------------------
+            bool protect_root(ProtectedPointer<Node>& out, uint64_t& version) const {
+                //--------------------------
+                Node* _root = m_root.load(std::memory_order_acquire);
+                out         = m_manager.protect(_root);
+                if (!out or m_root.load(std::memory_order_seq_cst) != _root) {
+                    return false;
+                }// end if (!out or m_root.load(std::memory_order_seq_cst) != _root)
+                return read_lock(_root, version);
+                //--------------------------
+            }// end bool protect_root(ProtectedPointer<Node>& out, uint64_t& version) const
+            //--------------------------
+            // Takes child of node (read at version): protected and read-locked in
+            // out. The version check proves child was still linked once protected.
+            bool take_child(const Node* node, const uint64_t& version, Node* child, ProtectedPointer<Node>& out, uint64_t& out_version) const {
+                //--------------------------
+                out = m_manager.protect(child);
+                return out and validate(node, version) and read_lock(child, out_version);
+                //--------------------------
+            }// end bool take_child(...) const
+            //--------------------------
+            // Leaves leaf protected and read-locked at version, parents released.
+            // Without a key it takes the leftmost path.
+            bool find_leaf(const Key* key, ProtectedPointer<Node>& leaf, uint64_t& version) const {
+                //--------------------------
+                if (!protect_root(leaf, version)) {
+                    return false;
+                }// end if (!protect_root(leaf, version))
+                while (!leaf->leaf) {
+                    const auto* _inner      = static_cast<const Inner*>(leaf.get());
+                    Node* _next             = key ? child_for(_inner, *key) : _inner->children[0].load(std::memory_order_acquire);
+                    ProtectedPointer<Node> _child;
+                    uint64_t _child_version = 0UL;
+                    if (!take_child(_inner, version, _next, _child, _child_version)) {
+                        return false;
+                    }// end if (!take_child(...))
+                    leaf    = std::move(_child);
+                    version = _child_version;
+                }// end while (!leaf->leaf)
+                return true;
+                //--------------------------
+            }// end bool find_leaf(const Key* key, ProtectedPointer<Node>& leaf, uint64_t& version) const
+            //--------------------------------------------------------------
+            // Readers
+            //--------------------------------------------------------------
+            std::optional<Value> find_data(const Key& key) const {
+                //--------------------------
+                Backoff _backoff;
+                while (true) {
+                    //--------------------------
+                    ProtectedPointer<Node> _node;
+                    uint64_t _version = 0UL;
+                    if (find_leaf(&key, _node, _version)) {
+                        const auto* _leaf   = static_cast<const Leaf*>(_node.get());
+                        const size_t _count = entries(_leaf);
+                        const size_t _pos   = search(_leaf->keys, _count, key);
+                        std::optional<Value> _result;
+                        if (_pos < _count and !m_compare(key, _leaf->keys[_pos].load(std::memory_order_relaxed))) {
+                            _result = _leaf->values[_pos].load(std::memory_order_relaxed);
+                        }// end if (key present)
+                        if (validate(_leaf, _version)) {
+                            return _result;
+                        }// end if (validate(_leaf, _version))
+                    }// end if (find_leaf(&key, _node, _version))
+                    _backoff.pause();
+                    //--------------------------
+                }// end while (true)
+                //--------------------------
+            }// end std::optional<Value> find_data(const Key& key) const
+            //--------------------------
+            // Copies the entries of leaf after bound (from bound when !strict; all
+            // of them without one) and checks the copy against version.
+            bool snapshot(const Leaf* leaf, const uint64_t& version, const Key* bound, const bool& strict, std::vector<std::pair<Key, Value>>& out) const {
+                //--------------------------
+                out.clear();
+                const size_t _count = entries(leaf);
+                size_t _pos         = bound ? search(leaf->keys, _count, *bound) : 0UL;
+                for (; _pos < _count; ++_pos) {
+                    const Key _key = leaf->keys[_pos].load(std::memory_order_relaxed);
+                    if (bound and strict and !m_compare(*bound, _key)) {
+                        continue;
+                    }// end if (bound and strict and !m_compare(*bound, _key))
+                    out.emplace_back(_key, leaf->values[_pos].load(std::memory_order_relaxed));
+                }// end for (; _pos < _count; ++_pos)
+                return validate(leaf, version);
+                //--------------------------
+            }// end bool snapshot(...) const
+            //--------------------------
+            // Loads it with the first leaf holding entries from (or after) bound.
+            void seek(Iterator& it, const Key* bound, const bool& strict) const {
+                //--------------------------
+                // bound may point into it.m_entries, which snapshot() rewrites.
+                std::optional<Key> _bound;
+                if (bound) {
+                    _bound.emplace(*bound);
+                }// end if (bound)
+                //--------------------------
+                Backoff _backoff;
+                while (true) {
+                    //--------------------------
+                    uint64_t _version = 0UL;
+                    if (find_leaf(_bound ? &*_bound : nullptr, it.m_leaf, _version) and
+                        snapshot(static_cast<const Leaf*>(it.m_leaf.get()), _version, _bound ? &*_bound : nullptr, strict, it.m_entries)) {
+                        break;
+                    }// end if (find_leaf(...) and snapshot(...))
+                    _backoff.pause();
+                    //--------------------------
+                }// end while (true)
+                //--------------------------
+                it.m_index = 0UL;
+                if (it.m_entries.empty()) {
+                    next_leaf(it, _bound ? &*_bound : nullptr);
+                }// end if (it.m_entries.empty())
+                //--------------------------
+            }// end void seek(Iterator& it, const Key* bound, const bool& strict) const
+            //--------------------------
+            void next_leaf(Iterator& it) const {
+                //--------------------------
+                std::optional<Key> _last;
+                if (!it.m_entries.empty()) {
+                    _last.emplace(it.m_entries.back().first);
+                }// end if (!it.m_entries.empty())
+                next_leaf(it, _last ? &*_last : nullptr);
+                //--------------------------
+            }// end void next_leaf(Iterator& it) const
+            //--------------------------
+            // Follows next links from it.m_leaf, one hazard handed to the next,
+            // until a leaf has entries above last. A leaf that went obsolete (merged
+            // away) is replaced by a fresh search for the first key after last.
+            void next_leaf(Iterator& it, const Key* last) const {
+                //--------------------------
+                Backoff _backoff;
+                it.m_index = 0UL;
+                it.m_entries.clear();
+                while (it.m_leaf) {
+                    //--------------------------
+                    const auto* _leaf = static_cast<const Leaf*>(it.m_leaf.get());
+                    uint64_t _version = 0UL;
+                    if (!read_lock(_leaf, _version)) {
+                        if (obsolete(_leaf)) {
+                            seek(it, last, true);
+                            return;
+                        }// end if (obsolete(_leaf))
+                        _backoff.pause();
+                        continue;
+                    }// end if (!read_lock(_leaf, _version))
+                    //--------------------------
+                    Leaf* _next = _leaf->next.load(std::memory_order_acquire);
+                    ProtectedPointer<Node> _guard;
+                    if (_next) {
+                        _guard = m_manager.protect(_next);
+                    }// end if (_next)
+                    if ((_next and !_guard) or !validate(_leaf, _version)) {
+                        _backoff.pause();
+                        continue;
+                    }// end if ((_next and !_guard) or !validate(_leaf, _version))
+                    it.m_leaf = std::move(_guard);
+                    //--------------------------
+                    // A split since the last copy can put already seen keys here again.
+                    while (_next) {
+                        uint64_t _next_version = 0UL;
+                        if (read_lock(_next, _next_version) and snapshot(_next, _next_version, last, true, it.m_entries)) {
+                            break;
+                        }// end if (read_lock(...) and snapshot(...))
+                        if (obsolete(_next)) {
+                            seek(it, last, true);
+                            return;
+                        }// end if (obsolete(_next))
+                        _backoff.pause();
+                    }// end while (_next)
+                    if (!it.m_entries.empty()) {
+                        return;
+                    }// end if (!it.m_entries.empty())
+                    //--------------------------
+                }// end while (it.m_leaf)
+                //--------------------------
+            }// end void next_leaf(Iterator& it, const Key* last) const
+            //--------------------------------------------------------------
+            // Writers
+            //--------------------------------------------------------------
+            bool insert_data(const Key& key, const Value& value) {
+                //--------------------------
+                Backoff _backoff;
+                bool _inserted = false;
+                while (true) {
+                    const Step _step = insert_attempt(key, value, _inserted);
+                    if (_step == Step::Done) {
+                        break;
+                    }// end if (_step == Step::Done)
+                    if (_step == Step::Contended) {
+                        _backoff.pause();
+                    }// end if (_step == Step::Contended)
+                }// end while (true)
+                //--------------------------
+                if (_inserted) {
+                    m_size.fetch_add(1UL, std::memory_order_relaxed);
+                }// end if (_inserted)
+                return _inserted;
+                //--------------------------
+            }// end bool insert_data(const Key& key, const Value& value)
+            //--------------------------
+            Step insert_attempt(const Key& key, const Value& value, bool& inserted) {
+                //--------------------------
+                ProtectedPointer<Node> _node, _parent;
+                uint64_t _version = 0UL, _parent_version = 0UL;
+                if (!protect_root(_node, _version)) {
+                    return Step::Contended;
+                }// end if (!protect_root(_node, _version))
+                //--------------------------
+                while (true) {
+                    //--------------------------
+                    if (full(_node.get())) {
+                        return split_attempt(_node.get(), _version, _parent.get(), _parent_version);
+                    }// end if (full(_node.get()))
+                    if (_node->leaf) {
+                        break;
+                    }// end if (_node->leaf)
+                    //--------------------------
+                    if (_parent and !validate(_parent.get(), _parent_version)) {
+                        return Step::Contended;
+                    }// end if (_parent and !validate(_parent.get(), _parent_version))
+                    ProtectedPointer<Node> _child;
+                    uint64_t _child_version = 0UL;
+                    // Three hazards at most: parent, node and the child being taken.
+                    if (!take_child(_node.get(), _version, child_for(static_cast<const Inner*>(_node.get()), key), _child, _child_version)) {
+                        return Step::Contended;
+                    }// end if (!take_child(...))
+                    _parent         = std::move(_node);
+                    _parent_version = _version;
+                    _node           = std::move(_child);
+                    _version        = _child_version;
+                    //--------------------------
+                }// end while (true)
+                //--------------------------
+                auto* _leaf = static_cast<Leaf*>(_node.get());
+                if (!upgrade(_leaf, _version)) {
+                    return Step::Contended;
+                }// end if (!upgrade(_leaf, _version))
+                if (_parent and !validate(_parent.get(), _parent_version)) {
+                    write_unlock(_leaf);
+                    return Step::Contended;
+                }// end if (_parent and !validate(_parent.get(), _parent_version))
+                inserted = leaf_insert(_leaf, key, value);
+                write_unlock(_leaf);
+                return Step::Done;
+                //--------------------------
+            }// end Step insert_attempt(const Key& key, const Value& value, bool& inserted)
+            //--------------------------
+            // Splits a full node (parent is not full, or it would have been split
+            // on the way down), growing a new root when node is the root.
+            Step split_attempt(Node* node, const uint64_t& version, Node* parent, const uint64_t& parent_version) {
+                //--------------------------
+                if (parent and !upgrade(parent, parent_version)) {
+                    return Step::Contended;
+                }// end if (parent and !upgrade(parent, parent_version))
+                if (!upgrade(node, version)) {
+                    if (parent) {
+                        write_unlock(parent);
+                    }// end if (parent)
+                    return Step::Contended;
+                }// end if (!upgrade(node, version))
+                if (!parent and m_root.load(std::memory_order_relaxed) != node) {
+                    // Someone grew a root above node since we read it.
+                    write_unlock(node);
+                    return Step::Retry;
+                }// end if (!parent and ...)
+                //--------------------------
+                const auto [_right, _separator] = split(node);
+                if (parent) {
+                    inner_insert(static_cast<Inner*>(parent), _separator, _right);
+                } else {
+                    auto* _root = new Inner();
+                    _root->keys[0].store(_separator, std::memory_order_relaxed);
+                    _root->children[0].store(node, std::memory_order_relaxed);
+                    _root->children[1].store(_right, std::memory_order_relaxed);
+                    _root->count.store(1U, std::memory_order_relaxed);
+                    m_root.store(_root, std::memory_order_seq_cst);
+                }// end if (parent)
+                //--------------------------
+                write_unlock(node);
+                if (parent) {
+                    write_unlock(parent);
+                }// end if (parent)
+                return Step::Retry;
+                //--------------------------
+            }// end Step split_attempt(...)
+            //--------------------------
+            bool erase_data(const Key& key) {
+                //--------------------------
+                Backoff _backoff;
+                bool _erased = false;
+                while (erase_attempt(key, _erased) != Step::Done) {
+                    _backoff.pause();
+                }// end while (erase_attempt(key, _erased) != Step::Done)
+                //--------------------------
+                if (_erased) {
+                    m_size.fetch_sub(1UL, std::memory_order_relaxed);
+                }// end if (_erased)
+                return _erased;
+                //--------------------------
+            }// end bool erase_data(const Key& key)
+            //--------------------------
+            Step erase_attempt(const Key& key, bool& erased) {
+                //--------------------------
+                ProtectedPointer<Node> _node, _parent;
+                uint64_t _version = 0UL, _parent_version = 0UL;
+                if (!protect_root(_node, _version)) {
+                    return Step::Contended;
+                }// end if (!protect_root(_node, _version))
+                //--------------------------
+                while (!_node->leaf) {
+                    if (_parent and !validate(_parent.get(), _parent_version)) {
+                        return Step::Contended;
+                    }// end if (_parent and !validate(_parent.get(), _parent_version))
+                    ProtectedPointer<Node> _child;
+                    uint64_t _child_version = 0UL;
+                    if (!take_child(_node.get(), _version, child_for(static_cast<const Inner*>(_node.get()), key), _child, _child_version)) {
+                        return Step::Contended;
+                    }// end if (!take_child(...))
+                    _parent         = std::move(_node);
+                    _parent_version = _version;
+                    _node           = std::move(_child);
+                    _version        = _child_version;
+                }// end while (!_node->leaf)
+                //--------------------------
+                // Lock the parent too (top down) when the leaf may have to merge.
+                auto* _leaf        = static_cast<Leaf*>(_node.get());
+                auto* _inner       = static_cast<Inner*>(_parent.get());
+                const bool _merge  = _inner and entries(_leaf) <= C_MERGE_THRESHOLD;
+                if (_merge and !upgrade(_inner, _parent_version)) {
+                    return Step::Contended;
+                }// end if (_merge and !upgrade(_inner, _parent_version))
+                if (!upgrade(_leaf, _version)) {
+                    if (_merge) {
+                        write_unlock(_inner);
+                    }// end if (_merge)
+                    return Step::Contended;
+                }// end if (!upgrade(_leaf, _version))
+                if (_inner and !_merge and !validate(_inner, _parent_version)) {
+                    write_unlock(_leaf);
+                    return Step::Contended;
+                }// end if (_inner and !_merge and ...)
+                //--------------------------
+                erased = leaf_remove(_leaf, key);
+                if (!_merge) {
+                    write_unlock(_leaf);
+                    return Step::Done;
+                }// end if (!_merge)
+                //--------------------------
+                merge(_inner, _leaf);
+                write_unlock(_leaf);
+                if (_inner->count.load(std::memory_order_relaxed) == 0U and m_root.load(std::memory_order_relaxed) == _inner) {
+                    // A root with one child steps aside.
+                    m_root.store(_leaf, std::memory_order_seq_cst);
+                    write_unlock_obsolete(_inner);
+                    m_manager.retire(_inner);
+                } else {
+                    write_unlock(_inner);
+                }// end if (root left with one child)
+                return Step::Done;
+                //--------------------------
+            }// end Step erase_attempt(const Key& key, bool& erased)
+            //--------------------------
+            // With parent and leaf locked: folds leaf's right sibling into leaf if
+            // both fit, then unlinks and retires the sibling.
+            void merge(Inner* parent, Leaf* leaf) {
+                //--------------------------
+                const size_t _count = entries(parent);
+                size_t _pos         = 0UL;
+                while (_pos < _count and parent->children[_pos].load(std::memory_order_relaxed) != leaf) {
+                    ++_pos;
+                }// end while (...)
+                if (_pos == _count) {
+                    // Rightmost child: nothing to its right under this parent.
+                    return;
+                }// end if (_pos == _count)
+                //--------------------------
+                // Not protected, but it cannot be unlinked while we hold the parent.
+                auto* _right = static_cast<Leaf*>(parent->children[_pos + 1UL].load(std::memory_order_relaxed));
+                write_lock(_right);
+                const size_t _left_count  = entries(leaf);
+                const size_t _right_count = entries(_right);
+                if (_left_count + _right_count > C_MERGE_LIMIT) {
+                    write_unlock(_right);
+                    return;
+                }// end if (_left_count + _right_count > C_MERGE_LIMIT)
+                //--------------------------
+                for (size_t i = 0UL; i < _right_count; ++i) {
+                    leaf->keys[_left_count + i].store(_right->keys[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+                    leaf->values[_left_count + i].store(_right->values[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+                }// end for (size_t i = 0UL; i < _right_count; ++i)
+                leaf->count.store(static_cast<uint16_t>(_left_count + _right_count), std::memory_order_relaxed);
+                leaf->next.store(_right->next.load(std::memory_order_relaxed), std::memory_order_release);
+                inner_remove(parent, _pos);
+                //--------------------------
+                write_unlock_obsolete(_right);
+                m_manager.retire(_right);
+                //--------------------------
+            }// end void merge(Inner* parent, Leaf* leaf)
+            //--------------------------
+            static void destroy(Node* node) {
+                //--------------------------
+                if (!node->leaf) {
+                    auto* _inner = static_cast<Inner*>(node);
+                    for (size_t i = 0UL; i <= entries(_inner); ++i) {
+                        destroy(_inner->children[i].load(std::memory_order_relaxed));
+                    }// end for (size_t i = 0UL; i <= entries(_inner); ++i)
+                }// end if (!node->leaf)
+                delete node;
+                //--------------------------
+            }// end static void destroy(Node* node)
+            //--------------------------------------------------------------
+        private:
+            //--------------------------------------------------------------
+            static constexpr uint64_t C_OBSOLETE          = 1UL;
+            static constexpr uint64_t C_LOCKED            = 2UL;
+            static constexpr size_t C_MERGE_THRESHOLD     = C_LEAF_CAPACITY / 4UL;
+            static constexpr size_t C_MERGE_LIMIT         = C_LEAF_CAPACITY * 3UL / 4UL;
+            static constexpr size_t C_DEFAULT_READERS     = 64UL;
+            static constexpr size_t C_HAZARDS_PER_THREAD  = 3UL;
+            //--------------------------
+            Manager& m_manager;
+            Compare m_compare;
+            alignas(64) std::atomic<Node*> m_root;
+            alignas(64) std::atomic<size_t> m_size;
+        //--------------------------------------------------------------
+    };// end class BPlusTree
+    //--------------------------------------------------------------
+}// end namespace HazardSystem
+//--------------------------------------------------------------
@@ -0,0 +1,141 @@
+#pragma once
+//--------------------------------------------------------------
+// Standard cpp library
+//--------------------------------------------------------------
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+//--------------------------------------------------------------
+// Platform headers
+//--------------------------------------------------------------
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+//--------------------------------------------------------------
+namespace HazardSystem {
+    //--------------------------------------------------------------
+    // Bounded, escalating backoff for spin sites.
+    //
+    // Each call to pause() moves one step further: a doubling burst of CPU
+    // relax instructions, then std::this_thread::yield(). wait_while() goes one
+    // stage further and parks on the atomic itself (futex on Linux) once
+    // yielding has not helped, so a waiter stops burning the core a preempted
+    // holder needs to finish. Writers that can be waited on must notify.
+    //
+    // Waits on another thread's unfinished step (a Busy HashSet slot, a
+    // registry entry between install and first count or between last count
+    // and tombstone, a hazard release) use wait_while. CAS retry loops only
+    // pause(): a failed CAS means some other thread got through, so there is
+    // nobody to park behind.
+    //
+    // A thread that calls set_spin_only(true) (HazardPointerManager::warm_up
+    // does) never leaves user space here: pause() stays at the longest relax
+    // burst and wait_while() keeps spinning instead of yielding or parking.
+    //--------------------------------------------------------------
+    class Backoff {
+        //--------------------------------------------------------------
+        public:
+            //--------------------------------------------------------------
+            Backoff(void) : m_step(0U) {
+                //--------------------------
+            }// end Backoff(void)
+            //--------------------------
+            void pause(void) {
+                pause_step();
+            }// end void pause(void)
+            //--------------------------
+            void reset(void) {
+                m_step = 0U;
+            }// end void reset(void)
+            //--------------------------
+            bool spinning(void) const {
+                return m_step < C_SPIN_STEPS;
+            }// end bool spinning(void) const
+            //--------------------------
+            // Wait until the atomic no longer holds value; returns the new value.
+            template <typename V>
+            V wait_while(const std::atomic<V>& atom, V value, std::memory_order order = std::memory_order_acquire) {
+                return wait_while_data(atom, value, order);
+            }// end V wait_while(const std::atomic<V>& atom, V value, std::memory_order order)
+            //--------------------------
+            static void relax(void) {
+                cpu_relax();
+            }// end static void relax(void)
+            //--------------------------
+            // Per thread: no yield and no futex wait from any Backoff on this thread.
+            static void set_spin_only(const bool& enabled) {
+                spin_only_flag() = enabled;
+            }// end static void set_spin_only(const bool& enabled)
+            //--------------------------
+            static bool spin_only(void) {
+                return spin_only_flag();
+            }// end static bool spin_only(void)
+            //--------------------------------------------------------------
+        protected:
+            //--------------------------------------------------------------
+            void pause_step(void) {
+                //--------------------------
+                if (m_step < C_SPIN_STEPS or spin_only_flag()) {
+                    const uint32_t _spins = 1U << std::min(m_step, C_SPIN_STEPS - 1U);
+                    for (uint32_t i = 0; i < _spins; ++i) {
+                        cpu_relax();
+                    }// end for (uint32_t i = 0; i < _spins; ++i)
+                } else {
+                    std::this_thread::yield();
+                }// end if (m_step < C_SPIN_STEPS or spin_only_flag())
+                //--------------------------
+                if (m_step < C_SPIN_STEPS + C_YIELD_STEPS) {
+                    ++m_step;
+                }// end if (m_step < C_SPIN_STEPS + C_YIELD_STEPS)
+                //--------------------------
+            }// end void pause_step(void)
+            //--------------------------
+            template <typename V>
+            V wait_while_data(const std::atomic<V>& atom, V value, std::memory_order order) {
+                //--------------------------
+                V _current = atom.load(order);
+                while (_current == value) {
+                    if (m_step < C_SPIN_STEPS + C_YIELD_STEPS or spin_only_flag()) {
+                        pause_step();
+                    } else {
+                        atom.wait(value, order);
+                    }// end if (m_step < C_SPIN_STEPS + C_YIELD_STEPS or spin_only_flag())
+                    _current = atom.load(order);
+                }// end while (_current == value)
+                //--------------------------
+                return _current;
+                //--------------------------
+            }// end V wait_while_data(const std::atomic<V>& atom, V value, std::memory_order order)
+            //--------------------------
+            static void cpu_relax(void) {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+                _mm_pause();
+#elif defined(_MSC_VER) && defined(_M_ARM64)
+                __yield();
+#elif defined(__x86_64__) || defined(__i386__)
+                __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+                asm volatile("yield" ::: "memory");
+#else
+                std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+            }// end static void cpu_relax(void)
+            //--------------------------
+            static bool& spin_only_flag(void) {
+                static thread_local bool tls_spin_only = false;
+                return tls_spin_only;
+            }// end static bool& spin_only_flag(void)
+            //--------------------------------------------------------------
+        private:
+            //--------------------------------------------------------------
+            static constexpr uint32_t C_SPIN_STEPS  = 7U;  // 1 .. 64 relax instructions
+            static constexpr uint32_t C_YIELD_STEPS = 8U;  // yields before parking
+            //--------------------------
+            uint32_t m_step;
+        //--------------------------------------------------------------
+    };// end class Backoff
+    //--------------------------------------------------------------
+}// end namespace HazardSystem
+//--------------------------------------------------------------
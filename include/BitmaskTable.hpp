@@ -22,6 +22,8 @@
 // User Defined Headers
 //--------------------------------------------------------------
 #include "HazardPointer.hpp"
+#include "Backoff.hpp"
+#include "MemoryPolicy.hpp"
 //--------------------------------------------------------------
 namespace HazardSystem {
     //--------------------------------------------------------------
@@ -32,7 +34,7 @@ namespace HazardSystem {
             //--------------------------------------------------------------
             static constexpr uint16_t C_ARRAY_LIMIT = 1024U;
             //--------------------------
-            using SlotType                  = std::conditional_t<(N == 0) or (N > C_ARRAY_LIMIT), std::vector<HazardPointer<T>>,
+            using SlotType                  = std::conditional_t<(N == 0) or (N > C_ARRAY_LIMIT), std::vector<HazardPointer<T>, PolicyAllocator<HazardPointer<T>>>,
                                                                 std::array<HazardPointer<T>, N>>;
 
             //--------------------------------------------------------------
@@ -68,26 +70,27 @@ namespace HazardSystem {
             }// end BitmaskTable(void)
             //--------------------------
             template <uint16_t M = N, std::enable_if_t< (M == 0), int> = 0>
-            BitmaskTable(const size_t& capacity) :  m_capacity(bitmask_capacity_calculator(capacity)),
-                                                    m_mask_count(bitmask_table_calculator(m_capacity.load(std::memory_order_acquire))),
-                                                    m_size(0UL),
-                                                    m_hint(0UL),
-                                                    m_slots(m_capacity.load(std::memory_order_acquire)),
-                                                    m_bitmask(m_mask_count.load(std::memory_order_acquire)),
-                                                    m_initialized(Initialization(0ULL)) {
+            BitmaskTable(   const size_t& capacity,
+                            const MemoryPolicy& policy = MemoryPolicy{}) :  m_capacity(bitmask_capacity_calculator(capacity)),
+                                                                            m_mask_count(bitmask_table_calculator(m_capacity.load(std::memory_order_acquire))),
+                                                                            m_size(0UL),
+                                                                            m_hint(0UL),
+                                                                            m_slots(m_capacity.load(std::memory_order_acquire), PolicyAllocator<HazardPointer<T>>(policy)),
+                                                                            m_bitmask(m_mask_count.load(std::memory_order_acquire), PolicyAllocator<std::atomic<uint64_t>>(policy)),
+                                                                            m_initialized(Initialization(0ULL)) {
                 //--------------------------
-            }// end BitmaskTable(const size_t& capacity)
+            }// end BitmaskTable(const size_t& capacity, const MemoryPolicy& policy)
             //--------------------------
             template <uint16_t M = N, std::enable_if_t< (M > C_ARRAY_LIMIT), int> = 0>
-            BitmaskTable(void) :    m_capacity(bitmask_capacity_calculator(N)),
-                                    m_mask_count(bitmask_table_calculator(m_capacity.load(std::memory_order_acquire))),
-                                    m_size(0UL),
-                                    m_hint(0U),
-                                    m_slots(m_capacity.load(std::memory_order_acquire)),
-                                    m_bitmask(m_mask_count.load(std::memory_order_acquire)),
-                                    m_initialized(Initialization(0ULL)) {
+            explicit BitmaskTable(const MemoryPolicy& policy = MemoryPolicy{}) :    m_capacity(bitmask_capacity_calculator(N)),
+                                                                                    m_mask_count(bitmask_table_calculator(m_capacity.load(std::memory_order_acquire))),
+                                                                                    m_size(0UL),
+                                                                                    m_hint(0U),
+                                                                                    m_slots(m_capacity.load(std::memory_order_acquire), PolicyAllocator<HazardPointer<T>>(policy)),
+                                                                                    m_bitmask(m_mask_count.load(std::memory_order_acquire), PolicyAllocator<std::atomic<uint64_t>>(policy)),
+                                                                                    m_initialized(Initialization(0ULL)) {
                 //--------------------------
-            }// end BitmaskTable(const size_t& capacity)
+            }// end explicit BitmaskTable(const MemoryPolicy& policy)
             //--------------------------
             ~BitmaskTable(void)                           = default;
             //--------------------------
@@ -256,6 +259,7 @@ namespace HazardSystem {
             std::enable_if_t<(M > 0) and (M <= 64), std::optional<IndexType>> acquire_data(void) {
                 //--------------------------
                 uint64_t mask = m_bitmask.load(std::memory_order_relaxed);
+                Backoff _backoff;
                 //--------------------------
                 while (mask != ~0ULL) {
                     //--------------------------
@@ -272,6 +276,7 @@ namespace HazardSystem {
                         m_size.fetch_add(1, std::memory_order_relaxed);
                         return index;
                     }// end if (m_bitmask.compare_exchange_weak(mask, desired, std::memory_order_acq_rel, std::memory_order_relaxed)))
+                    _backoff.pause();
                 }// end while (mask != ~0ULL)
                 //--------------------------
                 return std::nullopt;
@@ -284,6 +289,7 @@ namespace HazardSystem {
                 const IndexType _capacity   = get_capacity();
                 const IndexType _mask_count  = get_mask_count();
                 const IndexType start_part   = m_hint.load(std::memory_order_relaxed) % _mask_count;
+                Backoff _backoff;
                 //--------------------------
                 for (uint16_t i = 0; i < _mask_count; ++i) {
                     //--------------------------
@@ -306,6 +312,7 @@ namespace HazardSystem {
                             m_size.fetch_add(1, std::memory_order_relaxed);
                             return slot_index;
                         }// end if (m_bitmask.at(part).compare_exchange_weak(mask, desired, std::memory_order_acq_rel))
+                        _backoff.pause();
                     }// end while (mask != ~0ULL)
                 }// end for (uint16_t part = 0; part < get_mask_count(); ++part) 
                 //--------------------------
@@ -815,7 +822,7 @@ namespace HazardSystem {
             std::atomic<size_t> m_capacity, m_mask_count, m_size;
             std::atomic<IndexType> m_hint;
             //--------------------------
-            using BitmaskType = std::conditional_t<(N == 0) or (N > C_ARRAY_LIMIT), std::vector<std::atomic<uint64_t>>,
+            using BitmaskType = std::conditional_t<(N == 0) or (N > C_ARRAY_LIMIT), std::vector<std::atomic<uint64_t>, PolicyAllocator<std::atomic<uint64_t>>>,
                                     std::conditional_t<(N > C_BITS_PER_MASK) and (N <= C_ARRAY_LIMIT ), std::array<std::atomic<uint64_t>, C_MASK_COUNT>,
                                     std::atomic<uint64_t>>>;
             //--------------------------
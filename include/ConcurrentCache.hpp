@@ -0,0 +1,264 @@
+#pragma once
+//--------------------------------------------------------------
+// Standard C++ library
+//--------------------------------------------------------------
+#include <cstddef>
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+#include <algorithm>
+//--------------------------------------------------------------
+// User Defined Headers
+//--------------------------------------------------------------
+#include "HashTable.hpp"
+#include "HazardPointerManager.hpp"
+//--------------------------------------------------------------
+namespace HazardSystem {
+    //--------------------------------------------------------------
+    // Fixed-capacity key/value cache with CLOCK eviction and no global lock.
+    //
+    // Entries live in a ring of capacity slots. A HashTable with N buckets maps
+    // each key to its slot; lookups go key -> slot -> entry and check the entry
+    // key, so a mapping left behind by a racing eviction reads as a miss. A hit
+    // sets its slot's reference bit. Inserting into a full cache advances a
+    // shared clock hand with fetch_add, clears reference bits as it passes and
+    // swaps the new entry into the first slot whose bit was already clear. The
+    // bits live beside the slots, not in the entries, so the hand never reads
+    // an entry it does not own. The entry it displaces is retired through
+    // HazardPointerManager, so readers copying a value out of it finish before
+    // it is freed.
+    //
+    // Two racing put()s of one key may both claim a slot; the index keeps the
+    // later one and the other is evicted in due course. Eviction removes the
+    // displaced key from the index, which unlinks its node. A put whose entry
+    // is evicted before its own index insert lands re-reads the slot afterwards
+    // and drops the mapping itself, so the index holds about capacity nodes
+    // however many distinct keys pass through.
+    //--------------------------------------------------------------
+    template<typename Key, typename Value, size_t N = 1024UL>
+    class ConcurrentCache {
+        public:
+            //--------------------------------------------------------------
+            // At least 4-byte aligned: wait_free_protect tags the low pointer bit.
+            struct alignas(Key) alignas(Value) alignas(4) Entry {
+                //--------------------------
+                template<typename... Args>
+                Entry(const Key& key_, Args&&... args) :    key(key_),
+                                                            value(std::forward<Args>(args)...) {
+                    //--------------------------
+                }// end Entry(const Key& key_, Args&&... args)
+                //--------------------------
+                const Key key;
+                const Value value;
+                //--------------------------
+            };// end struct Entry
+            //--------------------------------------------------------------
+            using Manager = HazardPointerManager<Entry, 0>;
+            //--------------------------------------------------------------
+            // readers sizes the entry manager shared by every cache of this
+            // Key/Value, on first use only.
+            explicit ConcurrentCache(   const size_t& capacity,
+                                        const size_t& readers = C_DEFAULT_READERS) :  m_capacity(std::max<size_t>(1UL, capacity)),
+                                                                                      m_hand(0UL),
+                                                                                      m_size(0UL),
+                                                                                      m_slots(m_capacity),
+                                                                                      m_referenced(m_capacity),
+                                                                                      m_slot_ids(make_slot_ids(m_capacity)),
+                                                                                      m_manager(Manager::instance(std::max<size_t>(1UL, readers))) {
+                //--------------------------
+            }// end explicit ConcurrentCache(const size_t& capacity, const size_t& readers)
+            //--------------------------
+            ConcurrentCache(const ConcurrentCache&)             = delete;
+            ConcurrentCache& operator=(const ConcurrentCache&)  = delete;
+            ConcurrentCache(ConcurrentCache&&)                  = delete;
+            ConcurrentCache& operator=(ConcurrentCache&&)       = delete;
+            //--------------------------
+            // No other thread may still be using the cache; evicted entries stay
+            // with the manager.
+            ~ConcurrentCache(void) {
+                for (auto& slot : m_slots) {
+                    delete slot.load(std::memory_order_relaxed);
+                }// end for (auto& slot : m_slots)
+            }// end ~ConcurrentCache(void)
+            //--------------------------
+            std::optional<Value> get(const Key& key) {
+                return get_data(key);
+            }// end std::optional<Value> get(const Key& key)
+            //--------------------------
+            bool contains(const Key& key) {
+                return static_cast<bool>(protect_entry(key).second);
+            }// end bool contains(const Key& key)
+            //--------------------------
+            // Inserts or replaces; evicts one entry when the cache is full.
+            template<typename... Args>
+            void put(const Key& key, Args&&... args) {
+                put_data(key, std::forward<Args>(args)...);
+            }// end void put(const Key& key, Args&&... args)
+            //--------------------------
+            bool erase(const Key& key) {
+                return erase_data(key);
+            }// end bool erase(const Key& key)
+            //--------------------------
+            size_t size(void) const {
+                return m_size.load(std::memory_order_acquire);
+            }// end size_t size(void) const
+            //--------------------------
+            size_t capacity(void) const {
+                return m_capacity;
+            }// end size_t capacity(void) const
+            //--------------------------
+            // Keys the index maps; at most capacity() once writers are quiet.
+            size_t index_size(void) const {
+                return m_index.size();
+            }// end size_t index_size(void) const
+            //--------------------------------------------------------------
+        protected:
+            //--------------------------------------------------------------
+            std::optional<Value> get_data(const Key& key) {
+                //--------------------------
+                // Holds the entry against a concurrent evict-and-retire while we copy out.
+                auto [_slot, _entry] = protect_entry(key);
+                if (!_entry) {
+                    return std::nullopt;
+                }// end if (!_entry)
+                //--------------------------
+                // Test first so hot slots do not bounce their cache line on every hit.
+                // A late hit on a slot just refilled only marks the new entry.
+                if (!m_referenced[_slot].load(std::memory_order_relaxed)) {
+                    m_referenced[_slot].store(true, std::memory_order_relaxed);
+                }// end if (!m_referenced[_slot].load(std::memory_order_relaxed))
+                //--------------------------
+                return std::optional<Value>(_entry->value);
+                //--------------------------
+            }// end std::optional<Value> get_data(const Key& key)
+            //--------------------------
+            template<typename... Args>
+            void put_data(const Key& key, Args&&... args) {
+                //--------------------------
+                auto* _entry = new Entry(key, std::forward<Args>(args)...);
+                //--------------------------
+                // Replace in place when the key already owns a slot.
+                auto [_slot, _current] = protect_entry(key);
+                if (_current) {
+                    Entry* _expected = _current.get();
+                    if (m_slots[_slot].compare_exchange_strong(_expected, _entry, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                        m_referenced[_slot].store(true, std::memory_order_relaxed);
+                        m_manager.retire(_expected);
+                        return;
+                    }// end if (m_slots[_slot].compare_exchange_strong(...))
+                }// end if (_current)
+                //--------------------------
+                const size_t _installed = install(_entry);
+                m_index.insert(key, m_slot_ids[_installed]);
+                //--------------------------
+                // A put that evicted our entry before the insert above found no
+                // mapping to remove. Drop it unless the slot still holds this key.
+                auto _resident = m_manager.wait_free_protect(m_slots[_installed]);
+                if (!_resident or !(_resident->key == key)) {
+                    m_index.remove(key, m_slot_ids[_installed]);
+                }// end if (!_resident or !(_resident->key == key))
+                //--------------------------
+            }// end void put_data(const Key& key, Args&&... args)
+            //--------------------------
+            bool erase_data(const Key& key) {
+                //--------------------------
+                auto [_slot, _current] = protect_entry(key);
+                if (!_current) {
+                    return false;
+                }// end if (!_current)
+                //--------------------------
+                Entry* _expected = _current.get();
+                if (!m_slots[_slot].compare_exchange_strong(_expected, nullptr, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                    return false;
+                }// end if (!m_slots[_slot].compare_exchange_strong(...))
+                //--------------------------
+                m_index.remove(key, m_slot_ids[_slot]);
+                m_size.fetch_sub(1UL, std::memory_order_acq_rel);
+                m_manager.retire(_expected);
+                return true;
+                //--------------------------
+            }// end bool erase_data(const Key& key)
+            //--------------------------
+            // CLOCK sweep: a set reference bit buys the slot's entry one more pass
+            // of the hand. A fresh entry starts with its bit set.
+            size_t install(Entry* entry) {
+                //--------------------------
+                while (true) {
+                    //--------------------------
+                    const size_t _slot  = m_hand.fetch_add(1UL, std::memory_order_relaxed) % m_capacity;
+                    Entry* _victim      = m_slots[_slot].load(std::memory_order_acquire);
+                    //--------------------------
+                    if (_victim and m_referenced[_slot].exchange(false, std::memory_order_relaxed)) {
+                        continue;
+                    }// end if (_victim and m_referenced[_slot].exchange(false, std::memory_order_relaxed))
+                    //--------------------------
+                    // _victim is not protected and may already be retired by a racing
+                    // put or erase; it is dereferenced only after this CAS unlinks it.
+                    if (!m_slots[_slot].compare_exchange_strong(_victim, entry, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                        continue;
+                    }// end if (!m_slots[_slot].compare_exchange_strong(...))
+                    m_referenced[_slot].store(true, std::memory_order_relaxed);
+                    //--------------------------
+                    if (_victim) {
+                        m_index.remove(_victim->key, m_slot_ids[_slot]);
+                        m_manager.retire(_victim);
+                    } else {
+                        m_size.fetch_add(1UL, std::memory_order_acq_rel);
+                    }// end if (_victim)
+                    //--------------------------
+                    return _slot;
+                    //--------------------------
+                }// end while (true)
+                //--------------------------
+            }// end size_t install(Entry* entry)
+            //--------------------------
+            // The key's slot and its entry, protected; empty unless the entry still holds key.
+            std::pair<size_t, ProtectedPointer<Entry>> protect_entry(const Key& key) {
+                //--------------------------
+                const std::shared_ptr<const size_t> _slot = m_index.find(key);
+                if (!_slot) {
+                    return {0UL, ProtectedPointer<Entry>()};
+                }// end if (!_slot)
+                //--------------------------
+                // Bounded even under write churn, so a present key never reads as a miss.
+                auto _entry = m_manager.wait_free_protect(m_slots[*_slot]);
+                if (!_entry or !(_entry->key == key)) {
+                    return {*_slot, ProtectedPointer<Entry>()};
+                }// end if (!_entry or !(_entry->key == key))
+                //--------------------------
+                return {*_slot, std::move(_entry)};
+                //--------------------------
+            }// end std::pair<size_t, ProtectedPointer<Entry>> protect_entry(const Key& key)
+            //--------------------------
+            // One shared id per slot: the index stores these, so a conditional
+            // remove can tell whether the key still points at the slot we evicted.
+            static std::vector<std::shared_ptr<const size_t>> make_slot_ids(const size_t& capacity) {
+                //--------------------------
+                std::vector<std::shared_ptr<const size_t>> _ids;
+                _ids.reserve(capacity);
+                for (size_t i = 0; i < capacity; ++i) {
+                    _ids.push_back(std::make_shared<const size_t>(i));
+                }// end for (size_t i = 0; i < capacity; ++i)
+                return _ids;
+                //--------------------------
+            }// end static std::vector<std::shared_ptr<const size_t>> make_slot_ids(const size_t& capacity)
+            //--------------------------------------------------------------
+        private:
+            //--------------------------------------------------------------
+            static constexpr size_t C_DEFAULT_READERS = 64UL;
+            //--------------------------
+            const size_t m_capacity;
+            alignas(64) std::atomic<size_t> m_hand;
+            alignas(64) std::atomic<size_t> m_size;
+            std::vector<std::atomic<Entry*>> m_slots;
+            std::vector<std::atomic<bool>> m_referenced;
+            const std::vector<std::shared_ptr<const size_t>> m_slot_ids;
+            HashTable<Key, const size_t, N> m_index;
+            Manager& m_manager;
+        //--------------------------------------------------------------
+    };// end class ConcurrentCache
+    //--------------------------------------------------------------
+}// end namespace HazardSystem
+//--------------------------------------------------------------
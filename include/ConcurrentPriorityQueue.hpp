@@ -0,0 +1,470 @@
+#pragma once
+//--------------------------------------------------------------
+// Standard C++ library
+//--------------------------------------------------------------
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <array>
+#include <vector>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <functional>
+#include <algorithm>
+#include <bit>
+//--------------------------------------------------------------
+// User Defined Headers
+//--------------------------------------------------------------
+#include "HazardPointerManager.hpp"
+#include "ProtectedPointer.hpp"
+//--------------------------------------------------------------
+namespace HazardSystem {
+    //--------------------------------------------------------------
+    // Lock-free min-priority queue: the skiplist of Lindén and Jonsson ("A
+    // Skiplist-Based Concurrent Priority Queue with Minimal Memory Contention").
+    //
+    // pop() claims the first live node by setting the delete bit in its
+    // predecessor's level-0 pointer, so deleted nodes always form a prefix of
+    // the list and inserts that race a pop fail their CAS instead of linking
+    // into it. The prefix is unlinked in one head swing once it grows past
+    // bound_offset nodes, rather than node by node, which keeps pops from all
+    // writing the same few cache lines. pop_batch() claims several consecutive
+    // nodes in one walk.
+    //
+    // Reclamation goes through HazardPointerManager at epoch granularity.
+    // Every operation protects the current epoch slot (one hazard, however far
+    // it walks). Whoever unlinks a prefix moves the queue to the next epoch
+    // and parks the nodes; they are freed once no operation still holds an
+    // epoch from before the unlink. The unlink is taken by one thread at a time
+    // through a try-flag that nobody waits on: a pop that loses it just leaves
+    // the prefix for a later one. A parked prefix stays chained through its
+    // own marked level-0 links, which nothing writes again, so limbo records
+    // only where each prefix starts and ends, in a vector that keeps its
+    // capacity.
+    //--------------------------------------------------------------
+    template<typename Key, typename Value, typename Compare = std::less<Key>>
+    class ConcurrentPriorityQueue {
+        //--------------------------------------------------------------
+        protected:
+            //--------------------------------------------------------------
+            static constexpr size_t C_MAX_LEVEL = 24UL;
+            static constexpr size_t C_EPOCHS    = 8UL;
+            //--------------------------
+            struct Node {
+                //--------------------------
+                Node(const Key& key_, Value value_, const size_t& level_) : key(key_),
+                                                                            value(std::move(value_)),
+                                                                            level(level_),
+                                                                            inserting(true),
+                                                                            next(std::make_unique<std::atomic<uintptr_t>[]>(level_)) {
+                    //--------------------------
+                }// end Node(const Key& key_, Value value_, const size_t& level_)
+                //--------------------------
+                explicit Node(const size_t& level_) :   key(),
+                                                        value(),
+                                                        level(level_),
+                                                        inserting(false),
+                                                        next(std::make_unique<std::atomic<uintptr_t>[]>(level_)) {
+                    //--------------------------
+                }// end explicit Node(const size_t& level_)
+                //--------------------------
+                Key key;
+                Value value;
+                const size_t level;
+                std::atomic<bool> inserting;
+                // Bit 0 of next[0] is the delete bit for the successor; upper levels are never marked.
+                std::unique_ptr<std::atomic<uintptr_t>[]> next;
+                //--------------------------
+            };// end struct Node
+            //--------------------------
+            // An unlinked prefix [first, end) and the epoch it was parked in.
+            struct Parked {
+                uint64_t sequence;
+                Node* first;
+                Node* end;
+                size_t count;
+            };// end struct Parked
+            //--------------------------------------------------------------
+        public:
+            //--------------------------------------------------------------
+            // Only ever protected, never retired: the slots belong to the queue.
+            struct alignas(64) Epoch {
+            };// end struct Epoch
+            //--------------------------------------------------------------
+            using Manager = HazardPointerManager<Epoch, 0>;
+            //--------------------------------------------------------------
+            // threads sizes the epoch manager shared by every queue of these
+            // types, on first use only; an operation that finds no free slot waits
+            // for one.
+            explicit ConcurrentPriorityQueue(   const size_t& bound_offset = C_DEFAULT_BOUND_OFFSET,
+                                                const size_t& threads = C_DEFAULT_THREADS) :  m_bound_offset(std::max<size_t>(1UL, bound_offset)),
+                                                                                              m_head(C_MAX_LEVEL),
+                                                                                              m_epochs{},
+                                                                                              m_epoch(0UL),
+                                                                                              m_current(&m_epochs[0]),
+                                                                                              m_cleaning(false),
+                                                                                              m_oldest(0UL),
+                                                                                              m_parked(0UL),
+                                                                                              m_manager(Manager::instance(std::max<size_t>(1UL, threads))) {
+                //--------------------------
+                for (size_t i = 0; i < C_MAX_LEVEL; ++i) {
+                    m_head.next[i].store(0U, std::memory_order_relaxed);
+                }// end for (size_t i = 0; i < C_MAX_LEVEL; ++i)
+                //--------------------------
+            }// end explicit ConcurrentPriorityQueue(const size_t& bound_offset, const size_t& threads)
+            //--------------------------
+            ConcurrentPriorityQueue(const ConcurrentPriorityQueue&)             = delete;
+            ConcurrentPriorityQueue& operator=(const ConcurrentPriorityQueue&)  = delete;
+            ConcurrentPriorityQueue(ConcurrentPriorityQueue&&)                  = delete;
+            ConcurrentPriorityQueue& operator=(ConcurrentPriorityQueue&&)       = delete;
+            //--------------------------
+            // No other thread may still be using the queue.
+            ~ConcurrentPriorityQueue(void) {
+                //--------------------------
+                Node* _node = pointer(m_head.next[0].load(std::memory_order_relaxed));
+                while (_node) {
+                    Node* _next = pointer(_node->next[0].load(std::memory_order_relaxed));
+                    delete _node;
+                    _node = _next;
+                }// end while (_node)
+                //--------------------------
+                for (const Parked& parked : m_limbo) {
+                    free_chain(parked);
+                }// end for (const Parked& parked : m_limbo)
+                //--------------------------
+            }// end ~ConcurrentPriorityQueue(void)
+            //--------------------------
+            void push(const Key& key, Value value) {
+                push_data(key, std::move(value));
+            }// end void push(const Key& key, Value value)
+            //--------------------------
+            // Smallest key first (by Compare); empty when nothing is left.
+            std::optional<std::pair<Key, Value>> pop(void) {
+                //--------------------------
+                std::optional<std::pair<Key, Value>> _out;
+                pop_data(1UL, [&_out](const Key& key, Value&& value) { _out.emplace(key, std::move(value)); });
+                return _out;
+                //--------------------------
+            }// end std::optional<std::pair<Key, Value>> pop(void)
+            //--------------------------
+            // Appends up to count of the smallest entries to out in order; returns how many.
+            size_t pop_batch(std::vector<std::pair<Key, Value>>& out, const size_t& count) {
+                return pop_data(count, [&out](const Key& key, Value&& value) { out.emplace_back(key, std::move(value)); });
+            }// end size_t pop_batch(std::vector<std::pair<Key, Value>>& out, const size_t& count)
+            //--------------------------
+            bool empty(void) const {
+                return empty_data();
+            }// end bool empty(void) const
+            //--------------------------
+            // Unlinked nodes still waiting for older operations to finish; only
+            // exact while no pop is running.
+            size_t parked(void) const {
+                return m_parked.load(std::memory_order_acquire);
+            }// end size_t parked(void) const
+            //--------------------------------------------------------------
+        protected:
+            //--------------------------------------------------------------
+            // RAII epoch hazard for the duration of one operation. wait_free_protect
+            // cannot be starved by epoch changes; it only comes back empty when no
+            // hazard slot is free, and then we wait for an operation to finish.
+            ProtectedPointer<Epoch> enter(void) const {
+                //--------------------------
+                Backoff _backoff;
+                while (true) {
+                    auto _epoch = m_manager.wait_free_protect(m_current);
+                    if (_epoch) {
+                        return _epoch;
+                    }// end if (_epoch)
+                    _backoff.pause();
+                }// end while (true)
+                //--------------------------
+            }// end ProtectedPointer<Epoch> enter(void) const
+            //--------------------------
+            void push_data(const Key& key, Value value) {
+                //--------------------------
+                const auto _guard     = enter();
+                const size_t _height  = random_level();
+                auto* _node           = new Node(key, std::move(value), _height);
+                std::array<Node*, C_MAX_LEVEL> _preds{};
+                std::array<Node*, C_MAX_LEVEL> _succs{};
+                //--------------------------
+                Node* _deleted = nullptr;
+                while (true) {
+                    //--------------------------
+                    _deleted = locate(key, _preds, _succs);
+                    _node->next[0].store(raw(_succs[0]), std::memory_order_relaxed);
+                    uintptr_t _expected = raw(_succs[0]);
+                    // Fails if the predecessor's successor got deleted meanwhile.
+                    if (_preds[0]->next[0].compare_exchange_strong(_expected, raw(_node), std::memory_order_acq_rel, std::memory_order_acquire)) {
+                        break;
+                    }// end if (_preds[0]->next[0].compare_exchange_strong(...))
+                    //--------------------------
+                }// end while (true)
+                //--------------------------
+                for (size_t i = 1; i < _height;) {
+                    //--------------------------
+                    _node->next[i].store(raw(_succs[i]), std::memory_order_release);
+                    if (marked(_node->next[0].load(std::memory_order_acquire)) or
+                        (_succs[i] and (_succs[i] == _deleted or marked(_succs[i]->next[0].load(std::memory_order_acquire))))) {
+                        break;
+                    }// end if (the node or its successor is already in the deleted prefix)
+                    //--------------------------
+                    uintptr_t _expected = raw(_succs[i]);
+                    if (_preds[i]->next[i].compare_exchange_strong(_expected, raw(_node), std::memory_order_acq_rel, std::memory_order_acquire)) {
+                        ++i;
+                        continue;
+                    }// end if (_preds[i]->next[i].compare_exchange_strong(...))
+                    //--------------------------
+                    _deleted = locate(key, _preds, _succs);
+                    if (_succs[0] != _node) {
+                        break;
+                    }// end if (_succs[0] != _node)
+                    //--------------------------
+                }// end for (size_t i = 1; i < _height;)
+                //--------------------------
+                // Until here the unlink stops short of this node, see pop_data().
+                _node->inserting.store(false, std::memory_order_release);
+                //--------------------------
+            }// end void push_data(const Key& key, Value value)
+            //--------------------------
+            // Claims up to count live nodes in key order, handing each to sink(key, value&&).
+            template<typename Sink>
+            size_t pop_data(const size_t& count, Sink&& sink) {
+                //--------------------------
+                if (count == 0UL) {
+                    return 0UL;
+                }// end if (count == 0UL)
+                //--------------------------
+                const auto _guard         = enter();
+                Node* _node               = &m_head;
+                Node* _new_head           = nullptr;
+                size_t _offset            = 0UL;
+                size_t _taken             = 0UL;
+                const uintptr_t _observed = m_head.next[0].load(std::memory_order_acquire);
+                //--------------------------
+                while (_taken < count) {
+                    //--------------------------
+                    uintptr_t _next = _node->next[0].load(std::memory_order_acquire);
+                    if (!pointer(_next)) {
+                        break;
+                    }// end if (!pointer(_next))
+                    //--------------------------
+                    // Nothing at or after a node still being linked may be unlinked.
+                    if (!_new_head and _node != &m_head and _node->inserting.load(std::memory_order_acquire)) {
+                        _new_head = _node;
+                    }// end if (!_new_head and ...)
+                    //--------------------------
+                    if (!marked(_next)) {
+                        _next = _node->next[0].fetch_or(1U, std::memory_order_acq_rel);
+                    }// end if (!marked(_next))
+                    ++_offset;
+                    _node = pointer(_next);
+                    //--------------------------
+                    if (!marked(_next)) {
+                        sink(_node->key, std::move(_node->value));
+                        ++_taken;
+                    }// end if (!marked(_next))
+                    //--------------------------
+                }// end while (_taken < count)
+                //--------------------------
+                if (_node == &m_head) {
+                    return _taken;
+                }// end if (_node == &m_head)
+                if (!_new_head) {
+                    _new_head = _node;
+                }// end if (!_new_head)
+                //--------------------------
+                if (_offset > m_bound_offset) {
+                    unlink_prefix(_observed, _new_head);
+                }// end if (_offset > m_bound_offset)
+                //--------------------------
+                return _taken;
+                //--------------------------
+            }// end size_t pop_data(const size_t& count, Sink&& sink)
+            //--------------------------
+            bool empty_data(void) const {
+                //--------------------------
+                const auto _guard  = enter();
+                const Node* _node  = &m_head;
+                while (true) {
+                    const uintptr_t _next = _node->next[0].load(std::memory_order_acquire);
+                    if (!pointer(_next)) {
+                        return true;
+                    }// end if (!pointer(_next))
+                    if (!marked(_next)) {
+                        return false;
+                    }// end if (!marked(_next))
+                    _node = pointer(_next);
+                }// end while (true)
+                //--------------------------
+            }// end bool empty_data(void) const
+            //--------------------------
+            // Swing the head past [observed, new_head), park those nodes and free
+            // whatever no older operation can still reach.
+            void unlink_prefix(const uintptr_t& observed, Node* new_head) {
+                //--------------------------
+                if (m_head.next[0].load(std::memory_order_acquire) != observed or
+                    m_cleaning.exchange(true, std::memory_order_acquire)) {
+                    return;
+                }// end if (someone else moved the head or is already cleaning)
+                //--------------------------
+                uintptr_t _expected = observed;
+                if (m_head.next[0].compare_exchange_strong(_expected, raw(new_head) | 1U, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                    //--------------------------
+                    restructure();
+                    //--------------------------
+                    size_t _count = 0;
+                    for (Node* _node = pointer(observed); _node != new_head; _node = pointer(_node->next[0].load(std::memory_order_relaxed))) {
+                        ++_count;
+                    }// end for (Node* _node = pointer(observed); _node != new_head; ...)
+                    //--------------------------
+                    // Operations that start from here on cannot reach the prefix.
+                    if (_count > 0UL) {
+                        const uint64_t _sequence = m_epoch.load(std::memory_order_relaxed);
+                        m_epoch.store(_sequence + 1UL, std::memory_order_relaxed);
+                        m_current.store(&m_epochs[(_sequence + 1UL) % C_EPOCHS], std::memory_order_seq_cst);
+                        m_parked.fetch_add(_count, std::memory_order_release);
+                        m_limbo.push_back(Parked{_sequence, pointer(observed), new_head, _count});
+                    }// end if (_count > 0UL)
+                    //--------------------------
+                }// end if (m_head.next[0].compare_exchange_strong(...))
+                //--------------------------
+                free_parked();
+                m_cleaning.store(false, std::memory_order_release);
+                //--------------------------
+            }// end void unlink_prefix(const uintptr_t& observed, Node* new_head)
+            //--------------------------
+            // Upper levels of the head skip every node whose successor is deleted.
+            void restructure(void) {
+                //--------------------------
+                Node* _pred = &m_head;
+                for (size_t i = C_MAX_LEVEL - 1UL; i > 0UL;) {
+                    //--------------------------
+                    uintptr_t _first = m_head.next[i].load(std::memory_order_acquire);
+                    Node* _h         = pointer(_first);
+                    if (!_h or !marked(_h->next[0].load(std::memory_order_acquire))) {
+                        --i;
+                        continue;
+                    }// end if (!_h or !marked(_h->next[0].load(std::memory_order_acquire)))
+                    //--------------------------
+                    Node* _cur = pointer(_pred->next[i].load(std::memory_order_acquire));
+                    while (_cur and marked(_cur->next[0].load(std::memory_order_acquire))) {
+                        _pred = _cur;
+                        _cur  = pointer(_pred->next[i].load(std::memory_order_acquire));
+                    }// end while (_cur and marked(_cur->next[0].load(std::memory_order_acquire)))
+                    //--------------------------
+                    if (m_head.next[i].compare_exchange_strong(_first, _pred->next[i].load(std::memory_order_acquire), std::memory_order_acq_rel, std::memory_order_acquire)) {
+                        --i;
+                    }// end if (m_head.next[i].compare_exchange_strong(...))
+                    //--------------------------
+                }// end for (size_t i = C_MAX_LEVEL - 1UL; i > 0UL;)
+                //--------------------------
+            }// end void restructure(void)
+            //--------------------------
+            // Parked nodes from epoch e are free once no slot holds an epoch <= e.
+            // A slot reused by a newer epoch only delays this, never hastens it.
+            void free_parked(void) {
+                //--------------------------
+                const uint64_t _current = m_epoch.load(std::memory_order_relaxed);
+                while (m_oldest < _current and !m_manager.is_protected(&m_epochs[m_oldest % C_EPOCHS])) {
+                    ++m_oldest;
+                }// end while (m_oldest < _current and ...)
+                //--------------------------
+                size_t _freed = 0;
+                while (_freed < m_limbo.size() and m_limbo[_freed].sequence < m_oldest) {
+                    free_chain(m_limbo[_freed]);
+                    m_parked.fetch_sub(m_limbo[_freed].count, std::memory_order_release);
+                    ++_freed;
+                }// end while (_freed < m_limbo.size() and m_limbo[_freed].sequence < m_oldest)
+                m_limbo.erase(m_limbo.begin(), m_limbo.begin() + static_cast<std::ptrdiff_t>(_freed));
+                //--------------------------
+            }// end void free_parked(void)
+            //--------------------------
+            // end belongs to a later prefix or is still linked; it is only compared.
+            static void free_chain(const Parked& parked) {
+                //--------------------------
+                for (Node* _node = parked.first; _node != parked.end;) {
+                    Node* _next = pointer(_node->next[0].load(std::memory_order_relaxed));
+                    delete _node;
+                    _node = _next;
+                }// end for (Node* _node = parked.first; _node != parked.end;)
+                //--------------------------
+            }// end static void free_chain(const Parked& parked)
+            //--------------------------
+            Node* locate(const Key& key, std::array<Node*, C_MAX_LEVEL>& preds, std::array<Node*, C_MAX_LEVEL>& succs) {
+                //--------------------------
+                Node* _deleted = nullptr;
+                Node* _node    = &m_head;
+                //--------------------------
+                for (size_t i = C_MAX_LEVEL; i-- > 0UL;) {
+                    //--------------------------
+                    uintptr_t _next = _node->next[i].load(std::memory_order_acquire);
+                    bool _mark      = marked(_next);
+                    Node* _cur      = pointer(_next);
+                    //--------------------------
+                    while (_cur and (Compare{}(_cur->key, key) or
+                                     marked(_cur->next[0].load(std::memory_order_acquire)) or
+                                     (i == 0UL and _mark))) {
+                        if (i == 0UL and _mark) {
+                            _deleted = _cur;
+                        }// end if (i == 0UL and _mark)
+                        _node = _cur;
+                        _next = _node->next[i].load(std::memory_order_acquire);
+                        _mark = marked(_next);
+                        _cur  = pointer(_next);
+                    }// end while (_cur and ...)
+                    //--------------------------
+                    preds[i] = _node;
+                    succs[i] = _cur;
+                    //--------------------------
+                }// end for (size_t i = C_MAX_LEVEL; i-- > 0UL;)
+                //--------------------------
+                return _deleted;
+                //--------------------------
+            }// end Node* locate(const Key& key, ...)
+            //--------------------------
+            static size_t random_level(void) {
+                //--------------------------
+                thread_local uint64_t _state = 0x9E3779B97F4A7C15ULL ^ reinterpret_cast<uintptr_t>(&_state);
+                _state ^= _state << 13;
+                _state ^= _state >> 7;
+                _state ^= _state << 17;
+                return std::min<size_t>(static_cast<size_t>(std::countr_zero(_state | (1ULL << 63))) + 1UL, C_MAX_LEVEL);
+                //--------------------------
+            }// end static size_t random_level(void)
+            //--------------------------
+            static Node* pointer(const uintptr_t& value) {
+                return reinterpret_cast<Node*>(value & ~static_cast<uintptr_t>(1U));
+            }// end static Node* pointer(const uintptr_t& value)
+            //--------------------------
+            static bool marked(const uintptr_t& value) {
+                return (value & 1U) != 0U;
+            }// end static bool marked(const uintptr_t& value)
+            //--------------------------
+            static uintptr_t raw(const Node* node) {
+                return reinterpret_cast<uintptr_t>(node);
+            }// end static uintptr_t raw(const Node* node)
+            //--------------------------------------------------------------
+        private:
+            //--------------------------------------------------------------
+            static constexpr size_t C_DEFAULT_BOUND_OFFSET = 32UL;
+            static constexpr size_t C_DEFAULT_THREADS      = 64UL;
+            //--------------------------
+            const size_t m_bound_offset;
+            Node m_head;
+            std::array<Epoch, C_EPOCHS> m_epochs;
+            std::atomic<uint64_t> m_epoch;
+            alignas(64) std::atomic<Epoch*> m_current;
+            alignas(64) std::atomic<bool> m_cleaning;
+            // Owned by whoever holds m_cleaning.
+            uint64_t m_oldest;
+            std::vector<Parked> m_limbo;
+            // Nodes in m_limbo, readable without m_cleaning.
+            std::atomic<size_t> m_parked;
+            Manager& m_manager;
+        //--------------------------------------------------------------
+    };// end class ConcurrentPriorityQueue
+    //--------------------------------------------------------------
+}// end namespace HazardSystem
+//--------------------------------------------------------------
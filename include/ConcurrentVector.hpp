@@ -0,0 +1,421 @@
+#pragma once
+//--------------------------------------------------------------
+// Standard C++ library
+//--------------------------------------------------------------
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <array>
+#include <memory>
+#include <new>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <algorithm>
+#include <bit>
+//--------------------------------------------------------------
+// User Defined Headers
+//--------------------------------------------------------------
+#include "HazardPointerManager.hpp"
+//--------------------------------------------------------------
+namespace HazardSystem {
+    //--------------------------------------------------------------
+    enum class VectorLayout : uint8_t {
+        Segmented,  // geometric segments that never move; growth copies nothing
+        Contiguous  // one array, copied into a twice larger one on growth
+    };// end enum class VectorLayout
+    //--------------------------------------------------------------
+    // Append-only vector shared between threads.
+    //
+    // push_back claims an index with one fetch_add and constructs the element in
+    // place; get(index) reads it back without taking a lock. An element becomes
+    // visible once its writer has finished constructing it, so indices can fill
+    // out of order and get() reports a slot that is claimed but not yet written
+    // as empty.
+    //
+    // Segmented keeps the elements in segments of B, 2B, 4B, ... cells whose
+    // addresses never change. A missing segment is installed by CAS, so
+    // push_back is lock-free and get() is wait-free.
+    //
+    // Contiguous keeps a single array. The writer that first runs past the end
+    // copies it into one twice the size, publishes it and retires the old array
+    // through HazardPointerManager, as atomic_unique_ptr::store_data does with
+    // the pointers it replaces. Readers protect the array for the duration of
+    // the copy-out, waiting only if more than `readers` threads read at once.
+    // Growth waits for writers still filling the old array, and writers past
+    // the end wait for the new one; pick Segmented when push_back must never
+    // wait.
+    //--------------------------------------------------------------
+    template<typename T, VectorLayout Layout = VectorLayout::Segmented>
+    class ConcurrentVector {
+        //--------------------------------------------------------------
+        static_assert(Layout == VectorLayout::Segmented or std::is_copy_constructible_v<T>,
+                      "ConcurrentVector<T, Contiguous> copies elements on growth");
+        //--------------------------------------------------------------
+        public:
+            //--------------------------------------------------------------
+            struct Cell {
+                //--------------------------
+                Cell(void) = default;
+                Cell(const Cell&)            = delete;
+                Cell& operator=(const Cell&) = delete;
+                //--------------------------
+                ~Cell(void) {
+                    if (ready.load(std::memory_order_relaxed)) {
+                        std::destroy_at(value());
+                    }// end if (ready.load(std::memory_order_relaxed))
+                }// end ~Cell(void)
+                //--------------------------
+                T* value(void) {
+                    return std::launder(reinterpret_cast<T*>(storage));
+                }// end T* value(void)
+                //--------------------------
+                const T* value(void) const {
+                    return std::launder(reinterpret_cast<const T*>(storage));
+                }// end const T* value(void) const
+                //--------------------------
+                std::atomic<bool> ready{false};
+                alignas(T) std::byte storage[sizeof(T)];
+                //--------------------------
+            };// end struct Cell
+            //--------------------------
+            struct Buffer {
+                //--------------------------
+                explicit Buffer(const size_t& capacity_) :  capacity(capacity_),
+                                                            cells(std::make_unique_for_overwrite<Cell[]>(capacity_)) {
+                    //--------------------------
+                }// end explicit Buffer(const size_t& capacity_)
+                //--------------------------
+                const size_t capacity;
+                std::unique_ptr<Cell[]> cells;
+                //--------------------------
+            };// end struct Buffer
+            //--------------------------------------------------------------
+            using Manager = HazardPointerManager<Buffer, 0>;
+            //--------------------------------------------------------------
+            // capacity is the first segment (or the initial array) and is rounded
+            // up to a power of two. readers sizes the buffer manager shared by
+            // every contiguous vector of this T, on first use only.
+            explicit ConcurrentVector(  const size_t& capacity = 64UL,
+                                        const size_t& readers = C_DEFAULT_READERS) :    m_base(capacity_size(capacity)),
+                                                                                        m_base_shift(static_cast<size_t>(std::countr_zero(m_base))),
+                                                                                        m_reserved(0UL),
+                                                                                        m_size(0UL),
+                                                                                        m_growing(false),
+                                                                                        m_segments{},
+                                                                                        m_buffer(nullptr),
+                                                                                        m_manager(manager(readers)) {
+                //--------------------------
+                if constexpr (Layout == VectorLayout::Contiguous) {
+                    m_buffer.store(new Buffer(m_base), std::memory_order_relaxed);
+                }// end if constexpr (Layout == VectorLayout::Contiguous)
+                //--------------------------
+            }// end explicit ConcurrentVector(const size_t& capacity, const size_t& readers)
+            //--------------------------
+            ConcurrentVector(const ConcurrentVector&)             = delete;
+            ConcurrentVector& operator=(const ConcurrentVector&)  = delete;
+            ConcurrentVector(ConcurrentVector&&)                  = delete;
+            ConcurrentVector& operator=(ConcurrentVector&&)       = delete;
+            //--------------------------
+            // No other thread may still be using the vector; arrays retired by
+            // earlier growth stay with the manager.
+            ~ConcurrentVector(void) {
+                //--------------------------
+                for (auto& segment : m_segments) {
+                    delete[] segment.load(std::memory_order_relaxed);
+                }// end for (auto& segment : m_segments)
+                delete m_buffer.load(std::memory_order_relaxed);
+                //--------------------------
+            }// end ~ConcurrentVector(void)
+            //--------------------------
+            // Returns the index the element was written to.
+            size_t push_back(const T& value) {
+                return emplace_data(value);
+            }// end size_t push_back(const T& value)
+            //--------------------------
+            size_t push_back(T&& value) {
+                return emplace_data(std::move(value));
+            }// end size_t push_back(T&& value)
+            //--------------------------
+            template<typename... Args>
+            size_t emplace_back(Args&&... args) {
+                return emplace_data(std::forward<Args>(args)...);
+            }// end size_t emplace_back(Args&&... args)
+            //--------------------------
+            // Empty when index is unclaimed or still being written.
+            std::optional<T> get(const size_t& index) const {
+                return get_data(index);
+            }// end std::optional<T> get(const size_t& index) const
+            //--------------------------
+            // Segmented only: elements never move, so the reference stays valid
+            // for the life of the vector. nullptr under the same rules as get().
+            const T* at(const size_t& index) const requires (Layout == VectorLayout::Segmented) {
+                const Cell* _cell = segment_cell(index);
+                return _cell ? _cell->value() : nullptr;
+            }// end const T* at(const size_t& index) const
+            //--------------------------
+            // Visits the written elements among the first claimed() indices.
+            template<typename Func>
+            void for_each(Func&& func) const {
+                for_each_data(std::forward<Func>(func));
+            }// end void for_each(Func&& func) const
+            //--------------------------
+            // Completed push_backs.
+            size_t size(void) const {
+                return m_size.load(std::memory_order_acquire);
+            }// end size_t size(void) const
+            //--------------------------
+            // Indices handed out so far, written or not.
+            size_t claimed(void) const {
+                return m_reserved.load(std::memory_order_acquire);
+            }// end size_t claimed(void) const
+            //--------------------------
+            bool empty(void) const {
+                return size() == 0UL;
+            }// end bool empty(void) const
+            //--------------------------
+            size_t capacity(void) const {
+                return capacity_data();
+            }// end size_t capacity(void) const
+            //--------------------------------------------------------------
+        protected:
+            //--------------------------------------------------------------
+            template<typename... Args>
+            size_t emplace_data(Args&&... args) {
+                //--------------------------
+                const size_t _index = m_reserved.fetch_add(1UL, std::memory_order_acq_rel);
+                Cell& _cell         = claim_cell(_index);
+                //--------------------------
+                ::new (static_cast<void*>(_cell.storage)) T(std::forward<Args>(args)...);
+                _cell.ready.store(true, std::memory_order_release);
+                m_size.fetch_add(1UL, std::memory_order_release);
+                //--------------------------
+                return _index;
+                //--------------------------
+            }// end size_t emplace_data(Args&&... args)
+            //--------------------------
+            std::optional<T> get_data(const size_t& index) const {
+                //--------------------------
+                if constexpr (Layout == VectorLayout::Segmented) {
+                    const Cell* _cell = segment_cell(index);
+                    return _cell ? std::optional<T>(*_cell->value()) : std::nullopt;
+                } else {
+                    //--------------------------
+                    if (index >= m_reserved.load(std::memory_order_acquire)) {
+                        return std::nullopt;
+                    }// end if (index >= m_reserved.load(std::memory_order_acquire))
+                    //--------------------------
+                    // Holds the array against a concurrent grow-and-retire while we copy out.
+                    auto _buffer = protect_buffer();
+                    if (index >= _buffer->capacity) {
+                        return std::nullopt;
+                    }// end if (index >= _buffer->capacity)
+                    //--------------------------
+                    const Cell& _cell = _buffer->cells[index];
+                    if (!_cell.ready.load(std::memory_order_acquire)) {
+                        return std::nullopt;
+                    }// end if (!_cell.ready.load(std::memory_order_acquire))
+                    //--------------------------
+                    return std::optional<T>(*_cell.value());
+                    //--------------------------
+                }// end if constexpr (Layout == VectorLayout::Segmented)
+                //--------------------------
+            }// end std::optional<T> get_data(const size_t& index) const
+            //--------------------------
+            template<typename Func>
+            void for_each_data(Func&& func) const {
+                //--------------------------
+                const size_t _claimed = m_reserved.load(std::memory_order_acquire);
+                //--------------------------
+                if constexpr (Layout == VectorLayout::Segmented) {
+                    for (size_t i = 0; i < _claimed; ++i) {
+                        if (const Cell* _cell = segment_cell(i)) {
+                            func(i, *_cell->value());
+                        }// end if (const Cell* _cell = segment_cell(i))
+                    }// end for (size_t i = 0; i < _claimed; ++i)
+                } else {
+                    //--------------------------
+                    // One protection for the whole walk instead of one per element.
+                    auto _buffer = protect_buffer();
+                    //--------------------------
+                    const size_t _end = std::min(_claimed, _buffer->capacity);
+                    for (size_t i = 0; i < _end; ++i) {
+                        const Cell& _cell = _buffer->cells[i];
+                        if (_cell.ready.load(std::memory_order_acquire)) {
+                            func(i, *_cell.value());
+                        }// end if (_cell.ready.load(std::memory_order_acquire))
+                    }// end for (size_t i = 0; i < _end; ++i)
+                    //--------------------------
+                }// end if constexpr (Layout == VectorLayout::Segmented)
+                //--------------------------
+            }// end void for_each_data(Func&& func) const
+            //--------------------------
+            size_t capacity_data(void) const {
+                //--------------------------
+                if constexpr (Layout == VectorLayout::Segmented) {
+                    size_t _capacity = 0UL;
+                    for (size_t s = 0; s < C_MAX_SEGMENTS; ++s) {
+                        if (m_segments[s].load(std::memory_order_acquire)) {
+                            _capacity += segment_size(s);
+                        }// end if (m_segments[s].load(std::memory_order_acquire))
+                    }// end for (size_t s = 0; s < C_MAX_SEGMENTS; ++s)
+                    return _capacity;
+                } else {
+                    return m_buffer.load(std::memory_order_acquire)->capacity;
+                }// end if constexpr (Layout == VectorLayout::Segmented)
+                //--------------------------
+            }// end size_t capacity_data(void) const
+            //--------------------------
+            Cell& claim_cell(const size_t& index) {
+                //--------------------------
+                if constexpr (Layout == VectorLayout::Segmented) {
+                    const auto [_segment, _offset] = locate(index);
+                    return segment(_segment)[_offset];
+                } else {
+                    return array_cell(index);
+                }// end if constexpr (Layout == VectorLayout::Segmented)
+                //--------------------------
+            }// end Cell& claim_cell(const size_t& index)
+            //--------------------------------------------------------------
+            // Segmented layout: segment s holds m_base << s cells and starts at
+            // index m_base * (2^s - 1).
+            //--------------------------------------------------------------
+            std::pair<size_t, size_t> locate(const size_t& index) const {
+                //--------------------------
+                const size_t _segment = static_cast<size_t>(std::bit_width((index >> m_base_shift) + 1UL)) - 1UL;
+                const size_t _offset  = index - ((segment_size(_segment)) - m_base);
+                return {_segment, _offset};
+                //--------------------------
+            }// end std::pair<size_t, size_t> locate(const size_t& index) const
+            //--------------------------
+            size_t segment_size(const size_t& segment) const {
+                return m_base << segment;
+            }// end size_t segment_size(const size_t& segment) const
+            //--------------------------
+            const Cell* segment_cell(const size_t& index) const {
+                //--------------------------
+                const auto [_segment, _offset] = locate(index);
+                if (_segment >= C_MAX_SEGMENTS) {
+                    return nullptr;
+                }// end if (_segment >= C_MAX_SEGMENTS)
+                //--------------------------
+                const Cell* _cells = m_segments[_segment].load(std::memory_order_acquire);
+                if (!_cells or !_cells[_offset].ready.load(std::memory_order_acquire)) {
+                    return nullptr;
+                }// end if (!_cells or !_cells[_offset].ready.load(std::memory_order_acquire))
+                //--------------------------
+                return &_cells[_offset];
+                //--------------------------
+            }// end const Cell* segment_cell(const size_t& index) const
+            //--------------------------
+            // Installs the segment if missing; a writer that loses the race frees its copy.
+            Cell* segment(const size_t& segment) {
+                //--------------------------
+                Cell* _cells = m_segments[segment].load(std::memory_order_acquire);
+                if (_cells) {
+                    return _cells;
+                }// end if (_cells)
+                //--------------------------
+                Cell* _fresh = new Cell[segment_size(segment)];
+                if (m_segments[segment].compare_exchange_strong(_cells, _fresh, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                    return _fresh;
+                }// end if (m_segments[segment].compare_exchange_strong(...))
+                //--------------------------
+                delete[] _fresh;
+                return _cells;
+                //--------------------------
+            }// end Cell* segment(const size_t& segment)
+            //--------------------------------------------------------------
+            // Contiguous layout.
+            //--------------------------------------------------------------
+            Cell& array_cell(const size_t& index) {
+                //--------------------------
+                while (true) {
+                    //--------------------------
+                    // Nobody retires this array before our cell is written: growth
+                    // waits for every claimed index below the old capacity.
+                    Buffer* _buffer = m_buffer.load(std::memory_order_acquire);
+                    if (index < _buffer->capacity) {
+                        return _buffer->cells[index];
+                    }// end if (index < _buffer->capacity)
+                    //--------------------------
+                    if (!m_growing.exchange(true, std::memory_order_acquire)) {
+                        //--------------------------
+                        if (m_buffer.load(std::memory_order_acquire) == _buffer) {
+                            grow(_buffer, index);
+                        }// end if (m_buffer.load(std::memory_order_acquire) == _buffer)
+                        m_growing.store(false, std::memory_order_release);
+                        //--------------------------
+                    } else {
+                        std::this_thread::yield();
+                    }// end if (!m_growing.exchange(true, std::memory_order_acquire))
+                    //--------------------------
+                }// end while (true)
+                //--------------------------
+            }// end Cell& array_cell(const size_t& index)
+            //--------------------------
+            // wait_free_protect never fails on a changing m_buffer, and m_buffer is
+            // never null, so it is empty only while every hazard slot is taken.
+            // Waiting for one keeps an empty get() meaning "not written yet".
+            ProtectedPointer<Buffer> protect_buffer(void) const {
+                //--------------------------
+                while (true) {
+                    auto _buffer = m_manager.wait_free_protect(m_buffer);
+                    if (_buffer) {
+                        return _buffer;
+                    }// end if (_buffer)
+                    std::this_thread::yield();
+                }// end while (true)
+                //--------------------------
+            }// end ProtectedPointer<Buffer> protect_buffer(void) const
+            //--------------------------
+            void grow(Buffer* old_buffer, const size_t& index) {
+                //--------------------------
+                const size_t _capacity = std::max(old_buffer->capacity * 2UL, std::bit_ceil(index + 1UL));
+                auto* _buffer          = new Buffer(_capacity);
+                //--------------------------
+                // Every index below the old capacity is claimed; wait for its writer.
+                for (size_t i = 0; i < old_buffer->capacity; ++i) {
+                    //--------------------------
+                    Cell& _from = old_buffer->cells[i];
+                    while (!_from.ready.load(std::memory_order_acquire)) {
+                        std::this_thread::yield();
+                    }// end while (!_from.ready.load(std::memory_order_acquire))
+                    //--------------------------
+                    ::new (static_cast<void*>(_buffer->cells[i].storage)) T(*_from.value());
+                    _buffer->cells[i].ready.store(true, std::memory_order_relaxed);
+                    //--------------------------
+                }// end for (size_t i = 0; i < old_buffer->capacity; ++i)
+                //--------------------------
+                m_buffer.store(_buffer, std::memory_order_release);
+                m_manager.retire(old_buffer);
+                //--------------------------
+            }// end void grow(Buffer* old_buffer, const size_t& index)
+            //--------------------------
+            static size_t capacity_size(const size_t& requested) {
+                return std::bit_ceil(std::max<size_t>(2UL, requested));
+            }// end static size_t capacity_size(const size_t& requested)
+            //--------------------------
+            static Manager& manager(const size_t& readers) {
+                return Manager::instance(std::max<size_t>(1UL, readers));
+            }// end static Manager& manager(const size_t& readers)
+            //--------------------------------------------------------------
+        private:
+            //--------------------------------------------------------------
+            static constexpr size_t C_DEFAULT_READERS = 64UL;
+            static constexpr size_t C_MAX_SEGMENTS    = 48UL;
+            //--------------------------
+            const size_t m_base;
+            const size_t m_base_shift;
+            alignas(64) std::atomic<size_t> m_reserved;
+            alignas(64) std::atomic<size_t> m_size;
+            alignas(64) std::atomic<bool> m_growing;
+            std::array<std::atomic<Cell*>, C_MAX_SEGMENTS> m_segments;
+            std::atomic<Buffer*> m_buffer;
+            Manager& m_manager;
+        //--------------------------------------------------------------
+    };// end class ConcurrentVector
+    //--------------------------------------------------------------
+}// end namespace HazardSystem
+//--------------------------------------------------------------
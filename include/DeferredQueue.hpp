@@ -0,0 +1,228 @@
+#pragma once
+//--------------------------------------------------------------
+// Standard C++ library
+//--------------------------------------------------------------
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <initializer_list>
+#include <optional>
+#include <utility>
+#include <vector>
+#include <algorithm>
+//--------------------------------------------------------------
+namespace HazardSystem {
+    //--------------------------------------------------------------
+    // Thread-local queue of deferred callbacks (call_rcu style). Each entry
+    // names the pointers it depends on; the callback runs from a reclaim scan
+    // once none of them is hazard-protected. Entries are batched and swept
+    // with the same hazard predicate as retired nodes.
+    //
+    // Up to C_INLINE_POINTERS pointers per entry are stored inline, so the
+    // common one-pointer defer does not allocate for them. A callback that
+    // throws ends the scan or clear() with that exception; entries that were
+    // ready but did not run yet go back on the queue for the next scan. The
+    // destructor cannot throw, so there a throwing callback is skipped and the
+    // rest still run.
+    //
+    // A scan moves ready entries into a scratch vector that is kept between
+    // scans and grown alongside the queue by defer(), so reclaim() itself does
+    // not allocate (the callbacks it runs may).
+    //--------------------------------------------------------------
+    template<typename T>
+    class DeferredQueue {
+        //--------------------------------------------------------------
+        public:
+            //--------------------------------------------------------------
+            using Callback = std::function<void(void)>;
+            //--------------------------------------------------------------
+            explicit DeferredQueue( const size_t& threshold,
+                                    const std::function<bool(const T*)>& is_hazard) :   m_threshold(std::max<size_t>(1UL, threshold)),
+                                                                                        m_next_scan(m_threshold),
+                                                                                        m_hazard(is_hazard) {
+                //--------------------------
+                m_entries.reserve(m_threshold);
+                m_ready.reserve(m_threshold);
+                //--------------------------
+            }// end explicit DeferredQueue(const size_t& threshold, const std::function<bool(const T*)>& is_hazard)
+            //--------------------------
+            DeferredQueue(void)                             = delete;
+            DeferredQueue(const DeferredQueue&)             = delete;
+            DeferredQueue& operator=(const DeferredQueue&)  = delete;
+            DeferredQueue(DeferredQueue&&)                  = delete;
+            DeferredQueue& operator=(DeferredQueue&&)       = delete;
+            //--------------------------
+            ~DeferredQueue(void) {
+                //--------------------------
+                while (!m_entries.empty()) {
+                    try {
+                        clear_data();
+                    } catch (...) {
+                        // Nothing may leave a destructor; the rest are still queued.
+                    }// end try
+                }// end while (!m_entries.empty())
+                //--------------------------
+            }// end ~DeferredQueue(void)
+            //--------------------------
+            bool defer(const T* pointer, Callback callback) {
+                return defer_data(&pointer, &pointer + 1, std::move(callback));
+            }// end bool defer(const T* pointer, Callback callback)
+            //--------------------------
+            bool defer(std::initializer_list<const T*> pointers, Callback callback) {
+                return defer_data(pointers.begin(), pointers.end(), std::move(callback));
+            }// end bool defer(std::initializer_list<const T*> pointers, Callback callback)
+            //--------------------------
+            bool defer(const std::vector<const T*>& pointers, Callback callback) {
+                return defer_data(pointers.begin(), pointers.end(), std::move(callback));
+            }// end bool defer(const std::vector<const T*>& pointers, Callback callback)
+            //--------------------------
+            std::optional<size_t> reclaim(void) {
+                return scan_and_run(m_hazard);
+            }// end std::optional<size_t> reclaim(void)
+            //--------------------------
+            template<typename Predicate>
+            std::optional<size_t> reclaim_with(Predicate&& hazard_view) {
+                return scan_and_run(std::forward<Predicate>(hazard_view));
+            }// end std::optional<size_t> reclaim_with(Predicate&& hazard_view)
+            //--------------------------
+            size_t size(void) const {
+                return m_entries.size();
+            }// end size_t size(void) const
+            //--------------------------
+            // Runs every pending callback regardless of hazards.
+            void clear(void) {
+                clear_data();
+            }// end void clear(void)
+            //--------------------------------------------------------------
+        protected:
+            //--------------------------------------------------------------
+            static constexpr size_t C_INLINE_POINTERS = 2UL;
+            //--------------------------
+            struct Entry {
+                //--------------------------
+                void add(const T* pointer) {
+                    if (!pointer) {
+                        return;
+                    }// end if (!pointer)
+                    if (count < C_INLINE_POINTERS) {
+                        pointers[count++] = pointer;
+                    } else {
+                        spilled.push_back(pointer);
+                    }// end if (count < C_INLINE_POINTERS)
+                }// end void add(const T* pointer)
+                //--------------------------
+                template<typename Predicate>
+                bool blocked(Predicate& hazard_view) const {
+                    const auto _hazard = [&hazard_view](const T* ptr) { return hazard_view(ptr); };
+                    return std::any_of(pointers.begin(), pointers.begin() + count, _hazard) or
+                           std::any_of(spilled.begin(), spilled.end(), _hazard);
+                }// end bool blocked(Predicate& hazard_view) const
+                //--------------------------
+                std::array<const T*, C_INLINE_POINTERS> pointers{};
+                size_t count{0};
+                std::vector<const T*> spilled;
+                Callback callback;
+                //--------------------------
+            };// end struct Entry
+            //--------------------------
+            template<typename Iterator>
+            bool defer_data(Iterator first, Iterator last, Callback&& callback) {
+                //--------------------------
+                if (!callback) {
+                    return false;
+                }// end if (!callback)
+                //--------------------------
+                Entry _entry;
+                for (; first != last; ++first) {
+                    _entry.add(*first);
+                }// end for (; first != last; ++first)
+                _entry.callback = std::move(callback);
+                m_entries.push_back(std::move(_entry));
+                if (m_ready.capacity() < m_entries.capacity()) {
+                    m_ready.reserve(m_entries.capacity());
+                }// end if (m_ready.capacity() < m_entries.capacity())
+                //--------------------------
+                if (m_entries.size() >= m_next_scan) {
+                    static_cast<void>(scan_and_run(m_hazard));
+                }// end if (m_entries.size() >= m_next_scan)
+                //--------------------------
+                return true;
+                //--------------------------
+            }// end bool defer_data(Iterator first, Iterator last, Callback&& callback)
+            //--------------------------
+            template<typename Predicate>
+            std::optional<size_t> scan_and_run(Predicate&& hazard_view) {
+                //--------------------------
+                // Split ready entries off first: a callback may defer more work
+                // onto this same queue. The scratch vector is taken, not shared, so
+                // a scan started from a callback gets an empty one of its own.
+                std::vector<Entry> _ready;
+                _ready.swap(m_ready);
+                size_t _kept = 0;
+                for (size_t i = 0; i < m_entries.size(); ++i) {
+                    Entry& _entry = m_entries[i];
+                    if (_entry.blocked(hazard_view)) {
+                        if (_kept != i) {
+                            m_entries[_kept] = std::move(_entry);
+                        }// end if (_kept != i)
+                        ++_kept;
+                    } else {
+                        _ready.push_back(std::move(_entry));
+                    }// end if (_entry.blocked(hazard_view))
+                }// end for (size_t i = 0; i < m_entries.size(); ++i)
+                m_entries.resize(_kept);
+                m_next_scan = std::max(m_threshold, _kept * 2UL);
+                //--------------------------
+                run_entries(_ready);
+                //--------------------------
+                const size_t _ran = _ready.size();
+                _ready.clear();
+                if (_ready.capacity() > m_ready.capacity()) {
+                    m_ready.swap(_ready);
+                }// end if (_ready.capacity() > m_ready.capacity())
+                return _ran ? std::optional<size_t>(_ran) : std::nullopt;
+                //--------------------------
+            }// end std::optional<size_t> scan_and_run(Predicate&& hazard_view)
+            //--------------------------
+            void clear_data(void) {
+                //--------------------------
+                while (!m_entries.empty()) {
+                    std::vector<Entry> _pending;
+                    _pending.swap(m_entries);
+                    run_entries(_pending);
+                }// end while (!m_entries.empty())
+                m_next_scan = m_threshold;
+                //--------------------------
+            }// end void clear_data(void)
+            //--------------------------
+            // Runs entries in order. If one throws, the ones after it go back on
+            // the queue before the exception propagates, so none is dropped.
+            void run_entries(std::vector<Entry>& entries) {
+                //--------------------------
+                size_t i = 0;
+                try {
+                    for (; i < entries.size(); ++i) {
+                        entries[i].callback();
+                    }// end for (; i < entries.size(); ++i)
+                } catch (...) {
+                    m_entries.insert(m_entries.end(),
+                                     std::make_move_iterator(entries.begin() + static_cast<std::ptrdiff_t>(i + 1)),
+                                     std::make_move_iterator(entries.end()));
+                    throw;
+                }// end try
+                //--------------------------
+            }// end void run_entries(std::vector<Entry>& entries)
+            //--------------------------------------------------------------
+        private:
+            //--------------------------------------------------------------
+            const size_t m_threshold;
+            size_t m_next_scan;
+            std::function<bool(const T*)> m_hazard;
+            std::vector<Entry> m_entries;
+            std::vector<Entry> m_ready;
+        //--------------------------------------------------------------
+    };// end class DeferredQueue
+    //--------------------------------------------------------------
+} // namespace HazardSystem
+//--------------------------------------------------------------
@@ -10,10 +10,12 @@
 #include <memory>
 #include <functional>
 #include <tuple>
+#include <memory_resource>
 //--------------------------------------------------------------
 namespace HazardSystem {
     //--------------------------------------------------------------
-    template<typename Key, typename T, size_t N>
+    // Nodes come from Allocator via allocate_shared, as in HashTable.
+    template<typename Key, typename T, size_t N, typename Allocator = std::allocator<std::byte>>
     class HashMultiTable {
         //--------------------------------------------------------------
         private:
@@ -63,9 +65,9 @@ namespace HazardSystem {
             //--------------------------------------------------------------
         public:
             //--------------------------------------------------------------
-            HashMultiTable(void) : m_size(0UL) {
+            explicit HashMultiTable(const Allocator& allocator = Allocator()) : m_size(0UL), m_allocator(allocator) {
                 //--------------------------
-            }// end HashMultiTable(void)
+            }// end explicit HashMultiTable(const Allocator& allocator)
             //--------------------------
             HashMultiTable(const HashMultiTable&)               = delete;
             HashMultiTable& operator=(const HashMultiTable&)    = delete;
@@ -90,6 +92,13 @@ namespace HazardSystem {
                 return find_data(key);
             }// end std::vector<std::shared_ptr<T>> find(const Key& key) const
             //--------------------------
+            // Calls fn(const std::shared_ptr<T>&) for every value under key and
+            // returns how many there were, without building a vector.
+            template <typename Func>
+            size_t find(const Key& key, Func&& fn) const {
+                return find_each(key, std::forward<Func>(fn));
+            }// end size_t find(const Key& key, Func&& fn) const
+            //--------------------------
             std::shared_ptr<T> find_first(const Key& key) const {
                 return find_first_data(key);
             }// end std::shared_ptr<T> find_first(const Key& key) const
@@ -147,7 +156,7 @@ namespace HazardSystem {
             bool insert_data(const Key& key, std::shared_ptr<T> data) {
                 //--------------------------
                 const size_t index  = hasher(key);
-                auto new_node       = std::make_shared<Node>(key, std::move(data));
+                auto new_node       = std::allocate_shared<Node>(m_allocator, key, std::move(data));
                 std::shared_ptr<Node> head;
                 //--------------------------
                 do {
@@ -219,21 +228,31 @@ namespace HazardSystem {
             std::vector<std::shared_ptr<T>> find_data(const Key& key) const {
                 //--------------------------
                 std::vector<std::shared_ptr<T>> results;
-                results.reserve(N);
+                find_each(key, [&results](const std::shared_ptr<T>& data) {
+                    results.push_back(data);
+                });
+                return results;
                 //--------------------------
+            }// end std::vector<std::shared_ptr<T>> find_data(const Key& key) const
+            //--------------------------------------------------------------
+            template <typename Func>
+            size_t find_each(const Key& key, Func&& fn) const {
+                //--------------------------
+                size_t found = 0;
                 std::shared_ptr<Node> current = m_table.at(hasher(key)).load(std::memory_order_acquire);
                 while (current) {
                     if (current->key == key) {
-                        results.push_back(current->data.load(std::memory_order_acquire));
+                        fn(current->data.load(std::memory_order_acquire));
+                        ++found;
                     }// end if (current->key == key)
                     //--------------------------
                     current = current->next.load(std::memory_order_acquire);
                     //--------------------------
                 }// end  while (current)
                 //--------------------------
-                return results;
+                return found;
                 //--------------------------
-            }// end std::vector<std::shared_ptr<T>> find_data(const Key& key) const
+            }// end size_t find_each(const Key& key, Func&& fn) const
             //--------------------------------------------------------------
             std::shared_ptr<T> find_first_data(const Key& key) const {
                 //--------------------------
@@ -688,8 +707,14 @@ namespace HazardSystem {
             //--------------------------------------------------------------
             std::atomic<size_t> m_size;
             std::array<std::atomic<std::shared_ptr<Node>>, N> m_table;
+            Allocator m_allocator;
         //--------------------------------------------------------------
     };  // end class HashMultiTable
     //--------------------------------------------------------------
+    namespace pmr {
+        template<typename Key, typename T, size_t N>
+        using HashMultiTable = HazardSystem::HashMultiTable<Key, T, N, std::pmr::polymorphic_allocator<std::byte>>;
+    }// end namespace pmr
+    //--------------------------------------------------------------
 } // end namespace HazardSystem
 //--------------------------------------------------------------
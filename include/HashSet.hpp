@@ -12,6 +12,10 @@
 #include <type_traits>
 #include <vector>
 //--------------------------------------------------------------
+// User Defined Headers
+//--------------------------------------------------------------
+#include "Backoff.hpp"
+//--------------------------------------------------------------
 namespace HazardSystem {
     //--------------------------------------------------------------
     // Lock-free, fixed-capacity, open-addressing hash set with double hashing.
@@ -164,6 +168,14 @@ namespace HazardSystem {
                 }// end if constexpr (C_USE_ARRAY)
             }// end const Slot& slot_at(size_t idx) const
             //--------------------------
+            // A Busy slot is held by an inserter between its claim and publish. If
+            // that thread is preempted, back off and finally park on the state word
+            // instead of spinning on a core the holder may need.
+            SlotState wait_while_busy(const Slot& slot) const {
+                Backoff _backoff;
+                return static_cast<SlotState>(_backoff.wait_while(slot.state, static_cast<uint8_t>(SlotState::Busy)));
+            }// end SlotState wait_while_busy(const Slot& slot) const
+            //--------------------------
             bool insert_data(const Key& key) {
                 //--------------------------
                 if (m_size.load(std::memory_order_relaxed) >= m_max_load) {
@@ -182,9 +194,9 @@ namespace HazardSystem {
                     Slot& slot          = slot_at(idx);
                     SlotState state     = static_cast<SlotState>(slot.state.load(std::memory_order_acquire));
                     //--------------------------
-                    while (state == SlotState::Busy) {
-                        state = static_cast<SlotState>(slot.state.load(std::memory_order_acquire));
-                    }// end while (state == SlotState::Busy)
+                    if (state == SlotState::Busy) {
+                        state = wait_while_busy(slot);
+                    }// end if (state == SlotState::Busy)
                     //--------------------------
                     switch (state) {
                         case SlotState::Occupied:
@@ -218,6 +230,7 @@ namespace HazardSystem {
                                     //--------------------------
                                     target_slot.state.store(static_cast<uint8_t>(SlotState::Occupied),
                                                             std::memory_order_release);
+                                    target_slot.state.notify_all();
                                     m_size.fetch_add(1, std::memory_order_relaxed);
                                     //--------------------------
                                     if (first_tombstone != C_NPOS) {
@@ -249,6 +262,7 @@ namespace HazardSystem {
                             std::memory_order_acquire)) {
                         target_slot.key = key;
                         target_slot.state.store(static_cast<uint8_t>(SlotState::Occupied), std::memory_order_release);
+                        target_slot.state.notify_all();
                         m_size.fetch_add(1, std::memory_order_relaxed);
                         if (m_deleted.load(std::memory_order_relaxed) > 0) {
                             m_deleted.fetch_sub(1, std::memory_order_relaxed);
@@ -272,9 +286,9 @@ namespace HazardSystem {
                     const Slot& slot    = slot_at(idx);
                     SlotState state     = static_cast<SlotState>(slot.state.load(std::memory_order_acquire));
                     //--------------------------
-                    while (state == SlotState::Busy) {
-                        state = static_cast<SlotState>(slot.state.load(std::memory_order_acquire));
-                    }// end while (state == SlotState::Busy)
+                    if (state == SlotState::Busy) {
+                        state = wait_while_busy(slot);
+                    }// end if (state == SlotState::Busy)
                     //--------------------------
                     if (state == SlotState::Empty) {
                         return false;
@@ -302,9 +316,9 @@ namespace HazardSystem {
                     Slot& slot          = slot_at(idx);
                     SlotState state     = static_cast<SlotState>(slot.state.load(std::memory_order_acquire));
                     //--------------------------
-                    while (state == SlotState::Busy) {
-                        state = static_cast<SlotState>(slot.state.load(std::memory_order_acquire));
-                    }// end while (state == SlotState::Busy)
+                    if (state == SlotState::Busy) {
+                        state = wait_while_busy(slot);
+                    }// end if (state == SlotState::Busy)
                     //--------------------------
                     if (state == SlotState::Empty) {
                         return false;
@@ -360,6 +374,7 @@ namespace HazardSystem {
                 //--------------------------
                 for (auto& slot : m_slots) {
                     slot.state.store(static_cast<uint8_t>(SlotState::Empty), std::memory_order_release);
+                    slot.state.notify_all();
                 }// end for (auto& slot : m_slots)
                 //--------------------------
                 m_size.store(0, std::memory_order_relaxed);
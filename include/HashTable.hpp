@@ -9,10 +9,19 @@
 #include <memory>
 #include <functional>
 #include <utility>
+#include <memory_resource>
 //--------------------------------------------------------------
 namespace HazardSystem {
 //--------------------------------------------------------------
-template<typename Key, typename T, size_t N>
+// Nodes (and their shared_ptr control blocks) come from Allocator via
+// allocate_shared; the allocator's resource must outlive every node handed out.
+//
+// remove() empties a key's node, then marks it dead (a sentinel value no insert
+// can replace) and unlinks it from its bucket, so memory follows the live keys
+// rather than every key ever inserted. Lookups skip dead nodes; an insert that
+// meets one pushes a fresh node. Unlinks race only with other unlinks, and a
+// lost one leaves a dead node behind for the next remove in that bucket to prune.
+template<typename Key, typename T, size_t N, typename Allocator = std::allocator<std::byte>>
     class HashTable {
         private:
             //--------------------------------------------------------------
@@ -34,7 +43,7 @@ template<typename Key, typename T, size_t N>
             //--------------------------------------------------------------
         public:
             //--------------------------------------------------------------
-            HashTable(void) : m_size(0UL) {
+            explicit HashTable(const Allocator& allocator = Allocator()) : m_size(0UL), m_allocator(allocator) {
                 //--------------------------
             }
             //--------------------------
@@ -61,6 +70,11 @@ template<typename Key, typename T, size_t N>
                 return remove_data(key);
             }// end bool remove(const Key& key)
             //--------------------------
+            // Removes key only while it still maps to expected (compared by pointer).
+            bool remove(const Key& key, const std::shared_ptr<T>& expected) {
+                return remove_data(key, expected);
+            }// end bool remove(const Key& key, const std::shared_ptr<T>& expected)
+            //--------------------------
             void clear(void) {
                 clear_data();
             }// end void clear(void)
@@ -90,16 +104,21 @@ template<typename Key, typename T, size_t N>
                     //--------------------------
                     while (current) {
                         if (current->key == key) {
-                            std::shared_ptr<T> old = current->data.exchange(data, std::memory_order_acq_rel);
-                            if (!old) {
-                                m_size.fetch_add(1UL, std::memory_order_relaxed);
-                            }// end if (!old)
-                            return true;
+                            std::shared_ptr<T> old = current->data.load(std::memory_order_acquire);
+                            while (old != dead() and !current->data.compare_exchange_weak(old, data,
+                                        std::memory_order_acq_rel, std::memory_order_acquire)) {
+                            }// end while (old != dead() and ...)
+                            if (old != dead()) {
+                                if (!old) {
+                                    m_size.fetch_add(1UL, std::memory_order_relaxed);
+                                }// end if (!old)
+                                return true;
+                            }// end if (old != dead())
                         }// end if (current->key == key)
                         current = current->next.load(std::memory_order_acquire);
                     }// end while (current)
                     //--------------------------
-                    auto new_node = std::make_shared<Node>(key, data);
+                    auto new_node = std::allocate_shared<Node>(m_allocator, key, data);
                     new_node->next.store(head, std::memory_order_release);
                     //--------------------------
                     if (m_table.at(index).compare_exchange_weak(head, new_node,
@@ -125,13 +144,15 @@ template<typename Key, typename T, size_t N>
                 while (head) {
                     if (head->key == key) {
                         std::shared_ptr<T> expected = head->data.load(std::memory_order_acquire);
-                        while (expected) {
+                        while (expected and expected != dead()) {
                             if (head->data.compare_exchange_weak(expected, data,
                                         std::memory_order_acq_rel, std::memory_order_acquire)) {
                                 return true;
                             }// end if (head->data.compare_exchange_weak
-                        }// end while (expected)
-                        return false;
+                        }// end while (expected and expected != dead())
+                        if (expected != dead()) {
+                            return false;
+                        }// end if (expected != dead())
                     }// end if (head->key == key)
                     head = head->next.load(std::memory_order_acquire);
                 }// end while (head)
@@ -152,7 +173,10 @@ template<typename Key, typename T, size_t N>
                 //--------------------------
                 while (current) {
                     if (current->key == key) {
-                        return current->data.load(std::memory_order_acquire);
+                        std::shared_ptr<T> data = current->data.load(std::memory_order_acquire);
+                        if (data != dead()) {
+                            return data;
+                        }// end if (data != dead())
                     }// end if (current->key == key)
                     current = current->next.load(std::memory_order_acquire);
                 }// end while (current)
@@ -168,12 +192,18 @@ template<typename Key, typename T, size_t N>
                 //--------------------------
                 while (current) {
                     if (current->key == key) {
-                        std::shared_ptr<T> old = current->data.exchange(nullptr, std::memory_order_acq_rel);
-                        if (old) {
+                        std::shared_ptr<T> old = current->data.load(std::memory_order_acquire);
+                        while (old and old != dead() and !current->data.compare_exchange_weak(old, nullptr,
+                                        std::memory_order_acq_rel, std::memory_order_acquire)) {
+                        }// end while (old and old != dead() and ...)
+                        if (old != dead()) {
+                            if (!old) {
+                                return false;
+                            }// end if (!old)
                             safe_decrement_size();
+                            unlink_data(index, current);
                             return true;
-                        }// end if (old)
-                        return false;
+                        }// end if (old != dead())
                     }// end if (current->key == key)
                     current = current->next.load(std::memory_order_acquire);
                 }// end while (current)
@@ -182,6 +212,35 @@ template<typename Key, typename T, size_t N>
                 //--------------------------
             }// end bool remove_data(const Key& key)
             //--------------------------
+            bool remove_data(const Key& key, const std::shared_ptr<T>& expected) {
+                //--------------------------
+                if (!expected) {
+                    return false;
+                }// end if (!expected)
+                //--------------------------
+                const size_t index              = hasher(key);
+                std::shared_ptr<Node> current   = m_table.at(index).load(std::memory_order_acquire);
+                //--------------------------
+                while (current) {
+                    if (current->key == key) {
+                        std::shared_ptr<T> _expected = expected;
+                        if (current->data.compare_exchange_strong(_expected, nullptr,
+                                    std::memory_order_acq_rel, std::memory_order_acquire)) {
+                            safe_decrement_size();
+                            unlink_data(index, current);
+                            return true;
+                        }// end if (current->data.compare_exchange_strong
+                        if (_expected != dead()) {
+                            return false;
+                        }// end if (_expected != dead())
+                    }// end if (current->key == key)
+                    current = current->next.load(std::memory_order_acquire);
+                }// end while (current)
+                //--------------------------
+                return false;
+                //--------------------------
+            }// end bool remove_data(const Key& key, const std::shared_ptr<T>& expected)
+            //--------------------------
             void clear_data(void) {
                 for (auto& bucket : m_table) { 
                     bucket.store(nullptr, std::memory_order_release);
@@ -200,7 +259,7 @@ template<typename Key, typename T, size_t N>
                         std::shared_ptr<Node> next = head->next.load(std::memory_order_acquire);
                         //--------------------------
                         std::shared_ptr<T> data = head->data.load(std::memory_order_acquire);
-                        if (data and is_hazard(data)) {
+                        if (data and data != dead() and is_hazard(data)) {
                             static_cast<void>(remove_data(head->key));
                         }// end if (!is_hazard(head->data.load(std::memory_order_acquire)))
                         //--------------------------
@@ -210,6 +269,58 @@ template<typename Key, typename T, size_t N>
                 }// end for (auto& bucket)
             }// end void scan_and_reclaim(const std::function<bool(std::shared_ptr<T>)>& is_hazard)
             //--------------------------
+            // Marks an emptied node dead, unless an insert refilled it first, and
+            // prunes its bucket.
+            void unlink_data(const size_t& index, const std::shared_ptr<Node>& node) {
+                //--------------------------
+                std::shared_ptr<T> _empty;
+                if (!node->data.compare_exchange_strong(_empty, dead(), std::memory_order_acq_rel, std::memory_order_acquire)) {
+                    return;
+                }// end if (!node->data.compare_exchange_strong(_empty, dead(), ...))
+                prune_bucket(index);
+                //--------------------------
+            }// end void unlink_data(const size_t& index, const std::shared_ptr<Node>& node)
+            //--------------------------
+            // Swings each link that points at a dead node to that node's successor.
+            // A dead node's own next is never cleared, so a stale snapshot of it
+            // still leads to every live node behind it.
+            void prune_bucket(const size_t& index) {
+                //--------------------------
+                auto& _bucket                   = m_table.at(index);
+                std::shared_ptr<Node> _current  = _bucket.load(std::memory_order_acquire);
+                while (_current and is_dead(_current)) {
+                    std::shared_ptr<Node> _next = _current->next.load(std::memory_order_acquire);
+                    if (_bucket.compare_exchange_strong(_current, _next, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                        _current = _next;
+                    }// end if (_bucket.compare_exchange_strong(_current, _next, ...))
+                }// end while (_current and is_dead(_current))
+                //--------------------------
+                std::shared_ptr<Node> _prev = _current;
+                while (_prev) {
+                    _current = _prev->next.load(std::memory_order_acquire);
+                    if (_current and is_dead(_current)) {
+                        std::shared_ptr<Node> _next = _current->next.load(std::memory_order_acquire);
+                        if (_prev->next.compare_exchange_strong(_current, _next, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                            continue;
+                        }// end if (_prev->next.compare_exchange_strong(_current, _next, ...))
+                        // Lost to another unlink or _prev itself was unlinked; move on.
+                    }// end if (_current and is_dead(_current))
+                    _prev = _current;
+                }// end while (_prev)
+                //--------------------------
+            }// end void prune_bucket(const size_t& index)
+            //--------------------------
+            static bool is_dead(const std::shared_ptr<Node>& node) {
+                return node->data.load(std::memory_order_acquire) == dead();
+            }// end static bool is_dead(const std::shared_ptr<Node>& node)
+            //--------------------------
+            // Owns nothing; only its address matters.
+            static const std::shared_ptr<T>& dead(void) {
+                alignas(T) static std::byte s_marker[sizeof(T)];
+                static const std::shared_ptr<T> s_dead(std::shared_ptr<T>(), reinterpret_cast<T*>(s_marker));
+                return s_dead;
+            }// end static const std::shared_ptr<T>& dead(void)
+            //--------------------------
             void safe_decrement_size(void) {
                 //--------------------------
                 size_t old_size = m_size.load(std::memory_order_acquire);
@@ -230,8 +341,14 @@ template<typename Key, typename T, size_t N>
             //--------------------------------------------------------------
             std::atomic<size_t> m_size;
             std::array<std::atomic<std::shared_ptr<Node>>, N> m_table;
+            Allocator m_allocator;
         //--------------------------------------------------------------
     }; // end class HashTable
     //--------------------------------------------------------------
+    namespace pmr {
+        template<typename Key, typename T, size_t N>
+        using HashTable = HazardSystem::HashTable<Key, T, N, std::pmr::polymorphic_allocator<std::byte>>;
+    }// end namespace pmr
+    //--------------------------------------------------------------
 } // end namespace HazardSystem
 //--------------------------------------------------------------
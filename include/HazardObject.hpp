@@ -0,0 +1,75 @@
+#pragma once
+//--------------------------------------------------------------
+// Standard C++ library
+//--------------------------------------------------------------
+#include <concepts>
+#include <cstddef>
+#include <span>
+//--------------------------------------------------------------
+namespace HazardSystem {
+    //--------------------------------------------------------------
+    template<typename T>
+    class RetireList;
+    //--------------------------------------------------------------
+    // Intrusive retire hook. A type that publicly derives from
+    // hazard_obj_base<T> carries its own list link and reclaim function, so
+    // HazardPointerManager<T>::retire(T*) links it into the thread's retire
+    // list without allocating (cf. folly::hazptr_obj_base).
+    //
+    //     struct Node : HazardSystem::hazard_obj_base<Node> { ... };
+    //--------------------------------------------------------------
+    template<typename T>
+    class hazard_obj_base {
+        //--------------------------------------------------------------
+        public:
+            //--------------------------------------------------------------
+            using reclaim_fn = void (*)(T*);
+            //--------------------------
+            bool hazard_retired(void) const noexcept {
+                return m_hazard_reclaim != nullptr;
+            }// end bool hazard_retired(void) const noexcept
+            //--------------------------------------------------------------
+        protected:
+            //--------------------------------------------------------------
+            hazard_obj_base(void) noexcept : m_hazard_next(nullptr),
+                                             m_hazard_reclaim(nullptr) {
+                //--------------------------
+            }// end hazard_obj_base(void)
+            //--------------------------
+            // Copies are fresh objects; they never inherit a pending retirement.
+            hazard_obj_base(const hazard_obj_base&) noexcept : hazard_obj_base() {
+                //--------------------------
+            }// end hazard_obj_base(const hazard_obj_base&)
+            //--------------------------
+            hazard_obj_base& operator=(const hazard_obj_base&) noexcept {
+                return *this;
+            }// end hazard_obj_base& operator=(const hazard_obj_base&)
+            //--------------------------
+            ~hazard_obj_base(void) = default;
+            //--------------------------------------------------------------
+        private:
+            //--------------------------------------------------------------
+            friend class RetireList<T>;
+            //--------------------------
+            T* m_hazard_next;
+            reclaim_fn m_hazard_reclaim;
+        //--------------------------------------------------------------
+    };// end class hazard_obj_base
+    //--------------------------------------------------------------
+    template<typename T>
+    concept IntrusiveRetirable = std::derived_from<T, hazard_obj_base<T>>;
+    //--------------------------------------------------------------
+    // Range hazards (HazardPointerManager::protect_range) are checked against
+    // a retired node's extent: its own sizeof(T) bytes by default. A slab whose
+    // storage lives elsewhere names it with hazard_extent(), which the scan calls
+    // while the node is retired but not yet reclaimed.
+    //
+    //     struct Slab { std::span<const std::byte> hazard_extent(void) const; };
+    //--------------------------------------------------------------
+    template<typename T>
+    concept ExtentRetirable = requires(const T& node) {
+        { node.hazard_extent() } -> std::convertible_to<std::span<const std::byte>>;
+    };
+    //--------------------------------------------------------------
+}// end namespace HazardSystem
+//--------------------------------------------------------------
@@ -60,8 +60,9 @@ namespace HazardSystem {
             }// end std::atomic<std::shared_ptr<T>>& atomic_ref() noexcept
             //--------------------------
             void store_safe(T* ptr) noexcept {
-                T* expected = this->load(std::memory_order_acquire);
-                while (!this->compare_exchange_weak(expected, ptr, std::memory_order_acq_rel, std::memory_order_relaxed));
+                // A single exchange publishes with the same ordering as the old CAS loop
+                // but cannot be starved by concurrent writers.
+                static_cast<void>(this->exchange(ptr, std::memory_order_acq_rel));
             }// end bool store(std::shared_ptr<T> p) noexcept
         //--------------------------
     }; // end struct HazardPointer    
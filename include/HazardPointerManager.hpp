@@ -3,6 +3,7 @@
 // Standard cpp library
 //--------------------------------------------------------------
 #include <cstddef>
+#include <cstdint>
 #include <cstdbool>
 #include <cassert>
 #include <vector>
@@ -14,6 +15,10 @@
 #include <utility>
 #include <bit>
 #include <unordered_set>
+#include <type_traits>
+#include <initializer_list>
+#include <memory_resource>
+#include <span>
 //--------------------------------------------------------------
 // User Defined Headers
 //--------------------------------------------------------------
@@ -23,10 +28,15 @@
 #include "ThreadRegistry.hpp"
 #include "HazardThreadManager.hpp"
 #include "ProtectedPointer.hpp"
+#include "ProtectedRange.hpp"
 #include "BitmaskTable.hpp"
 #include "RetireMap.hpp"
+#include "RetireList.hpp"
+#include "DeferredQueue.hpp"
 // #include "RetireSet.hpp"
 #include "HazardRegistry.hpp"
+#include "Backoff.hpp"
+#include "MemoryPolicy.hpp"
 //--------------------------------------------------------------
 namespace HazardSystem {
 //--------------------------------------------------------------
@@ -35,22 +45,43 @@ class HazardPointerManager {
     //-------------------------------------------------------------
     private:
         using BitmaskType = BitmaskTable<T, HAZARD_POINTERS>;
+        //--------------------------
+        // wait_free_protect request, one per hazard slot. state is 0 when idle,
+        // odd (sequence << 1 | 1) while pending, and the result pointer (or
+        // C_NULL_RESULT) once completed. A completed pointer stays there as the
+        // slot's hazard, in place of a registry entry, until the slot is released.
+        struct HelpRequest {
+            std::atomic<uintptr_t> state{0U};
+            std::atomic<const std::atomic<T*>*> source{nullptr};
+            std::atomic<uintptr_t> sequence{0U};
+        };// end struct HelpRequest
+        //--------------------------
+        // protect_range publication, one per hazard slot. begin is 0 while the
+        // slot holds no range; end is written before begin and cleared after it.
+        struct RangeSlot {
+            std::atomic<uintptr_t> begin{0U};
+            std::atomic<uintptr_t> end{0U};
+        };// end struct RangeSlot
     public:
         //--------------------------------------------------------------
         using IndexType = typename BitmaskType::IndexType;
         //--------------------------------------------------------------
     public:
         //--------------------------------------------------------------
+        // The memory policy places the slot and registry arrays (huge pages, NUMA);
+        // like the sizes, only the first call's arguments take effect.
         template<size_t N = HAZARD_POINTERS> 
-        static  std::enable_if_t<(N > 0), HazardPointerManager&> instance(const size_t& retired_size = 2UL) {
-            static HazardPointerManager instance(retired_size);
+        static  std::enable_if_t<(N > 0), HazardPointerManager&> instance(  const size_t& retired_size = 2UL,
+                                                                            const MemoryPolicy& policy = MemoryPolicy{}) {
+            static HazardPointerManager instance(retired_size, policy);
             return instance;
         } // end static HazardPointerManager& instance(void)
         //--------------------------
         template<size_t N = HAZARD_POINTERS> 
         static  std::enable_if_t<(N == 0), HazardPointerManager&> instance( const size_t& hazards_size = std::thread::hardware_concurrency(),
-                                                                            const size_t& retired_size = 2UL) {
-            static HazardPointerManager instance(hazards_size, retired_size);
+                                                                            const size_t& retired_size = 2UL,
+                                                                            const MemoryPolicy& policy = MemoryPolicy{}) {
+            static HazardPointerManager instance(hazards_size, retired_size, policy);
             return instance;
         } // end static HazardPointerManager& instance(void)
         //--------------------------
@@ -66,6 +97,8 @@ class HazardPointerManager {
             return protect_data(a_data);
         }// end ProtectedPointer<T> protect(const std::atomic<T*>& a_data)
         //--------------------------
+        // Loads (and refcounts) the shared_ptr twice and keeps a copy in the result;
+        // atomic_shared_ptr::protect borrows the object without refcount traffic.
         ProtectedPointer<T> protect(const std::atomic<std::shared_ptr<T>>& a_sp_data) {
             return protect_data(a_sp_data);
         }// end ProtectedPointer<T> protect(const std::atomic<std::shared_ptr<T>>& a_sp_data)
@@ -80,6 +113,23 @@ class HazardPointerManager {
             //--------------------------
         }// end ProtectedPointer<T> try_protect(const std::atomic<T*>& a_data, const size_t& max_retries = 100UL)
         //--------------------------
+        // Wait-free once a hazard slot is held: at most four ordinary attempts,
+        // each a bounded registry add (one probe pass, at most four failed CASes,
+        // never waiting on another thread's entry) and on a lost validation one
+        // fetch_sub remove. Then the request is posted and completed with one
+        // CAS, by the caller or by any thread about to reclaim, and the completed
+        // request itself is the hazard until release: no registry step, so no
+        // step count that depends on other threads. Taking the slot is the
+        // bitmask's lock-free CAS and sits outside this bound, as does thread
+        // registration on a thread's first call (warm_up() does it ahead).
+        // Never fails on a changing source; empty only for nullptr or when no
+        // hazard slot is free. a_data must outlive concurrent calls on it (a root
+        // or a member of a long-lived object, not a link inside a node that can
+        // be retired).
+        ProtectedPointer<T> wait_free_protect(const std::atomic<T*>& a_data) {
+            return protect_wait_free_data(a_data);
+        }// end ProtectedPointer<T> wait_free_protect(const std::atomic<T*>& a_data)
+        //--------------------------
         ProtectedPointer<T> try_protect(const std::atomic<std::shared_ptr<T>>& a_sp_data, const size_t& max_retries = 100UL) {
             //--------------------------
             if(!max_retries) {
@@ -90,6 +140,22 @@ class HazardPointerManager {
             //--------------------------
         }// end ProtectedPointer<T> try_protect(const std::atomic<std::shared_ptr<T>>& a_sp_data, const size_t& max_retries = 100UL)
         //--------------------------
+        // Range hazard for interior pointers. While the guard lives, no retired
+        // node whose extent (its own bytes, or hazard_extent(); see
+        // ExtentRetirable) overlaps [begin, begin + size) is reclaimed, so a slab
+        // outlives every slice a reader still holds. Takes one hazard slot. Like
+        // protect(T*), the caller must know the bytes are live at the call.
+        ProtectedRange protect_range(const void* begin, const size_t& size) {
+            return protect_range_data(begin, size);
+        }// end ProtectedRange protect_range(const void* begin, const size_t& size)
+        //--------------------------
+        // Loads the node from a_data and protects [offset, offset + length) of its
+        // extent; the node itself stays pointer-protected in the same slot. Empty if a_data is null or changed meanwhile, or if the slice
+        // does not fit the extent.
+        ProtectedRange protect_range(const std::atomic<T*>& a_data, const size_t& offset, const size_t& length) {
+            return protect_range_data(a_data, offset, length);
+        }// end ProtectedRange protect_range(const std::atomic<T*>& a_data, const size_t& offset, const size_t& length)
+        //--------------------------
         // Acquire a hazard pointer slot
         // std::pair<std::optional<IndexType>, std::shared_ptr<HazardPointer<T>>> acquire(void) {
         //     return acquire_data();
@@ -108,10 +174,35 @@ class HazardPointerManager {
             return retire_node(std::move(node));
         } // end bool retire(std::shared_ptr<T> node)
         //--------------------------
+        // For nodes built in a memory resource: destroyed and returned to resource
+        // once unprotected, so a monotonic arena can be dropped in bulk afterwards.
+        bool retire(T* node, std::pmr::memory_resource* resource) {
+            return retire_node(node, resource);
+        } // end bool retire(T* node, std::pmr::memory_resource* resource)
+        //--------------------------
+        // Intrusive types only: reclaim through a plain function pointer, no allocation.
+        template<typename U = T> requires IntrusiveRetirable<U>
+        bool retire(T* node, typename hazard_obj_base<U>::reclaim_fn reclaim) {
+            return retire_intrusive(node, reclaim);
+        } // end bool retire(T* node, typename hazard_obj_base<U>::reclaim_fn reclaim)
+        //--------------------------
+        // Run callback once none of pointers is hazard-protected. Deferred work is
+        // batched per thread and swept by the same scan that reclaims retired nodes.
+        bool defer(std::initializer_list<const T*> pointers, std::function<void(void)> callback) {
+            return defer_data(pointers, std::move(callback));
+        } // end bool defer(std::initializer_list<const T*> pointers, std::function<void(void)> callback)
+        //--------------------------
+        bool defer(const T* pointer, std::function<void(void)> callback) {
+            return defer_data(pointer, std::move(callback));
+        } // end bool defer(const T* pointer, std::function<void(void)> callback)
+        //--------------------------
         void reclaim(void) {
             scan_and_reclaim();
         } // end void reclaim(void)
         //--------------------------
+        // Frees, regardless of hazards, everything this thread retired or
+        // deferred and whatever exited threads left in their pooled records.
+        // Call it only once no thread still reads those nodes.
         void reclaim_all(void) {
             scan_and_reclaim_all();
         } // end void reclaim_all(void)
@@ -120,10 +211,54 @@ class HazardPointerManager {
             clear_data();
         } // end void clear(void)
         //--------------------------
+        // Real-time profile for the calling thread: call once before its
+        // latency-critical work. Registers the thread, builds its retire record and
+        // pins that record's RetireMap at max(threshold, 2 x hazard slots)
+        // preallocated nodes, and puts the thread's Backoff in spin-only mode. From
+        // then on protect, try_protect, wait_free_protect, retire and reclaim on
+        // this thread neither allocate, lock, yield nor park: every wait on
+        // another thread spins. A pointer hazard pins at most one node, so with
+        // twice as many nodes as slots a full map has an unprotected node to free
+        // while only pointer hazards are held. Caveats: a range (protect_range,
+        // from any thread) pins every retired node it overlaps, so while ranges
+        // are held the map can fill with pinned nodes and retire returns false,
+        // leaving the node with the caller; reclaim runs ready deferred callbacks
+        // without allocating, but the callbacks may, and defer itself allocates;
+        // a release or registry update still makes one futex wake while some
+        // non-warmed thread is parked in wait_unprotected, synchronize or the
+        // registry; a spinning thread can wait out a preempted holder's time
+        // slice; a custom deleter's std::function is built by the caller.
+        bool warm_up(void) {
+            return warm_up_data();
+        } // end bool warm_up(void)
+        //--------------------------
+        // Block until no hazard slot publishes pointer. Waiters park on a release
+        // generation counter instead of polling reclaim(). Do not call this while
+        // the calling thread itself protects pointer.
+        void wait_unprotected(const T* pointer) {
+            wait_unprotected_data(pointer);
+        } // end void wait_unprotected(const T* pointer)
+        //--------------------------
+        // Grace period: block until every hazard published at the time of the call
+        // has been released. Hazards taken afterwards are not waited for.
+        void synchronize(void) {
+            synchronize_data();
+        } // end void synchronize(void)
+        //--------------------------
+        // Non-blocking check: true while some hazard slot publishes pointer. Only
+        // a "no" is lasting, and only if the pointer can no longer be protected.
+        bool is_protected(const T* pointer) const {
+            return is_hazard(pointer);
+        } // end bool is_protected(const T* pointer) const
+        //--------------------------
         size_t retire_size(void) const {
-            return retired_nodes().size();
+            return retired_count();
         } // end size_t retire_size(void) const
         //--------------------------
+        size_t deferred_size(void) const {
+            return retired_record().deferred.size();
+        } // end size_t deferred_size(void) const
+        //--------------------------
         size_t hazard_size(void) const {
             return m_hazard_pointers.size();
         } // end size_t hazard_size(void) const
@@ -131,21 +266,33 @@ class HazardPointerManager {
         size_t hazard_capacity(void) const {
             return m_hazard_pointers.capacity();
         } // end size_t hazard_capacity(void) const
+        //--------------------------
+        size_t record_size(void) const {
+            return record_count();
+        } // end size_t record_size(void) const
         //--------------------------------------------------------------
     protected:
         //--------------------------------------------------------------
         template <size_t N = HAZARD_POINTERS, std::enable_if_t< (N > 0), int> = 0>
-        HazardPointerManager(const size_t& retired_size) : m_retired_threshold(retired_size * 8UL),
-                                                          m_hazard_pointers(),
-                                                          m_registry(hazard_limiter(m_hazard_pointers.capacity())) {
+        HazardPointerManager(   const size_t& retired_size,
+                                const MemoryPolicy& policy) :   m_retired_threshold(retired_size * 8UL),
+                                                                m_hazard_pointers(table_for(policy)),
+                                                                m_registry(hazard_limiter(m_hazard_pointers.capacity()), policy),
+                                                                m_help(std::make_unique<HelpRequest[]>(m_hazard_pointers.capacity())),
+                                                                m_ranges(std::make_unique<RangeSlot[]>(m_hazard_pointers.capacity())),
+                                                                m_releases(std::make_unique<std::atomic<uint64_t>[]>(m_hazard_pointers.capacity())) {
             //--------------------------
         } // end HazardPointerManager(void)
         //--------------------------
         template <size_t N = HAZARD_POINTERS, std::enable_if_t< (N == 0), int> = 0>
         HazardPointerManager(   const size_t& hazards_size,
-                                const size_t& retired_size) :   m_retired_threshold(retired_size * 8UL),
-                                                                m_hazard_pointers(hazard_limiter(hazards_size)),
-                                                                m_registry(hazard_limiter(m_hazard_pointers.capacity())){
+                                const size_t& retired_size,
+                                const MemoryPolicy& policy) :   m_retired_threshold(retired_size * 8UL),
+                                                                m_hazard_pointers(hazard_limiter(hazards_size), policy),
+                                                                m_registry(hazard_limiter(m_hazard_pointers.capacity()), policy),
+                                                                m_help(std::make_unique<HelpRequest[]>(m_hazard_pointers.capacity())),
+                                                                m_ranges(std::make_unique<RangeSlot[]>(m_hazard_pointers.capacity())),
+                                                                m_releases(std::make_unique<std::atomic<uint64_t>[]>(m_hazard_pointers.capacity())) {
             //--------------------------
         } // end HazardPointerManager(void)
         //--------------------------
@@ -154,7 +301,9 @@ class HazardPointerManager {
         HazardPointerManager(HazardPointerManager&&)                    = delete;
         HazardPointerManager& operator=(HazardPointerManager&&)         = delete;
         //--------------------------
-        ~HazardPointerManager(void) = default;
+        ~HazardPointerManager(void) {
+            destroy_records();
+        } // end ~HazardPointerManager(void)
         //--------------------------------------------------------------
         ProtectedPointer<T> protect_data(T* data) {
             //--------------------------
@@ -256,6 +405,7 @@ class HazardPointerManager {
             }// end if (!it_opt)
             //--------------------------
             T* protected_obj = nullptr;
+            Backoff _backoff;
             //--------------------------
             for (size_t attempt = 0; attempt < max_retries; ++attempt) {
                 protected_obj = a_data.load(std::memory_order_acquire);
@@ -277,6 +427,8 @@ class HazardPointerManager {
                 // Drop our hazard before retrying
                 it_opt.value()->store(nullptr, std::memory_order_release);
                 m_registry.remove(protected_obj);
+                notify_release();
+                _backoff.pause();
             }// end for (size_t attempt = 0; attempt < max_retries; ++attempt)
             //--------------------------
             release_data_iterator(it_opt.value());
@@ -292,6 +444,7 @@ class HazardPointerManager {
             }// end if (!it_opt)
             //--------------------------
             std::shared_ptr<T> protected_obj;
+            Backoff _backoff;
             //--------------------------
             for (size_t attempt = 0; attempt < max_retries; ++attempt) {
                 protected_obj = a_sp_data.load(std::memory_order_acquire);
@@ -314,6 +467,8 @@ class HazardPointerManager {
                 // Drop our hazard before retrying
                 it_opt.value()->store(nullptr, std::memory_order_release);
                 m_registry.remove(protected_obj.get());
+                notify_release();
+                _backoff.pause();
             }// end for (size_t attempt = 0; attempt < max_retries; ++attempt)
             //--------------------------
             release_data_iterator(it_opt.value());
@@ -321,10 +476,230 @@ class HazardPointerManager {
             //--------------------------
         }// end ProtectedPointer<T> try_protect(const std::atomic<std::shared_ptr<T>>& a_sp_data, const size_t& max_retries)
         //--------------------------
+        ProtectedPointer<T> protect_wait_free_data(const std::atomic<T*>& a_data) {
+            //--------------------------
+            static_assert(alignof(T) >= 4UL, "wait_free_protect tags requests in the low pointer bit");
+            //--------------------------
+            auto it_opt = acquire_data_iterator();
+            if (!it_opt) {
+                return ProtectedPointer<T>();
+            }// end if (!it_opt)
+            auto _it = it_opt.value();
+            //--------------------------
+            for (size_t attempt = 0; attempt < C_WAIT_FREE_ATTEMPTS; ++attempt) {
+                T* _value = a_data.load(std::memory_order_acquire);
+                if (!_value) {
+                    release_data_iterator(_it);
+                    return ProtectedPointer<T>();
+                }// end if (!_value)
+                //--------------------------
+                if (m_registry.try_add(_value)) {
+                    _it->store_safe(_value);
+                    if (a_data.load(std::memory_order_seq_cst) == _value) {
+                        return create_protected_pointer(_it, _value);
+                    }// end if (a_data.load(std::memory_order_seq_cst) == _value)
+                    _it->store(nullptr, std::memory_order_release);
+                    m_registry.remove(_value);
+                }// end if (m_registry.try_add(_value))
+            }// end for (size_t attempt = 0; attempt < C_WAIT_FREE_ATTEMPTS; ++attempt)
+            //--------------------------
+            // Slow path. The request entry belongs to our slot, so nobody else posts
+            // to it; the sequence keeps a stale helper from completing a later one.
+            HelpRequest& _request   = m_help[static_cast<size_t>(std::distance(m_hazard_pointers.begin(), _it))];
+            const uintptr_t _tag    = (_request.sequence.fetch_add(1UL, std::memory_order_relaxed) << 1U) | 1U;
+            _request.source.store(&a_data, std::memory_order_relaxed);
+            m_help_pending.fetch_add(1UL, std::memory_order_seq_cst);
+            _request.state.store(_tag, std::memory_order_seq_cst);
+            //--------------------------
+            // One pass: help_request always completes a request that carries tag.
+            help_request(_request, _tag);
+            //--------------------------
+            // The completed state protects the value (see request_holds) and stays
+            // until release_data_iterator() clears it. The hazard slot itself
+            // stays empty, which tells the release there is no registry entry.
+            const uintptr_t _result = _request.state.load(std::memory_order_acquire);
+            if (_result == C_NULL_RESULT) {
+                release_data_iterator(_it);
+                return ProtectedPointer<T>();
+            }// end if (_result == C_NULL_RESULT)
+            return create_protected_pointer(_it, reinterpret_cast<T*>(_result));
+            //--------------------------
+        }// end ProtectedPointer<T> protect_wait_free_data(const std::atomic<T*>& a_data)
+        //--------------------------
+        // Completes request if it still carries tag, with one CAS and no registry
+        // add (helpers are unbounded, the registry is not). The value read from
+        // the source needs no validation: every reclaimer helps pending requests
+        // before checking a node, and a completed state counts as a hazard, so
+        // whichever value wins the CAS was either visible to that check or read
+        // before the node was unlinked.
+        void help_request(HelpRequest& request, const uintptr_t& tag) {
+            //--------------------------
+            const std::atomic<T*>* _source = request.source.load(std::memory_order_acquire);
+            if (!_source or request.state.load(std::memory_order_seq_cst) != tag) {
+                return;
+            }// end if (!_source or request.state.load(std::memory_order_seq_cst) != tag)
+            //--------------------------
+            T* _value               = _source->load(std::memory_order_seq_cst);
+            uintptr_t _expected     = tag;
+            const uintptr_t _result = _value ? reinterpret_cast<uintptr_t>(_value) : C_NULL_RESULT;
+            request.state.compare_exchange_strong(_expected, _result, std::memory_order_seq_cst, std::memory_order_acquire);
+            //--------------------------
+        }// end void help_request(HelpRequest& request, const uintptr_t& tag)
+        //--------------------------
+        // True while a completed request carries node, i.e. until its slot is
+        // released.
+        bool request_holds(const T* node) const {
+            //--------------------------
+            const uintptr_t _node  = reinterpret_cast<uintptr_t>(node);
+            const size_t _capacity = m_hazard_pointers.capacity();
+            for (size_t i = 0; i < _capacity; ++i) {
+                if (m_help[i].state.load(std::memory_order_seq_cst) == _node) {
+                    return true;
+                }// end if (m_help[i].state.load(std::memory_order_seq_cst) == _node)
+            }// end for (size_t i = 0; i < _capacity; ++i)
+            //--------------------------
+            return false;
+            //--------------------------
+        }// end bool request_holds(const T* node) const
+        //--------------------------
+        void help_pending(void) {
+            //--------------------------
+            const size_t _capacity = m_hazard_pointers.capacity();
+            for (size_t i = 0; i < _capacity; ++i) {
+                const uintptr_t _state = m_help[i].state.load(std::memory_order_seq_cst);
+                if (_state & 1U) {
+                    help_request(m_help[i], _state);
+                }// end if (_state & 1U)
+            }// end for (size_t i = 0; i < _capacity; ++i)
+            //--------------------------
+        }// end void help_pending(void)
+        //--------------------------
+        ProtectedRange protect_range_data(const void* begin, const size_t& size) {
+            //--------------------------
+            if (!begin or !size) {
+                return ProtectedRange();
+            }// end if (!begin or !size)
+            //--------------------------
+            auto it_opt = acquire_data_iterator();
+            if (!it_opt) {
+                return ProtectedRange();
+            }// end if (!it_opt)
+            //--------------------------
+            const auto* _begin = static_cast<const std::byte*>(begin);
+            publish_range(it_opt.value(), _begin, size);
+            return create_protected_range(it_opt.value(), _begin, size);
+            //--------------------------
+        }// end ProtectedRange protect_range_data(const void* begin, const size_t& size)
+        //--------------------------
+        ProtectedRange protect_range_data(const std::atomic<T*>& a_data, const size_t& offset, const size_t& length) {
+            //--------------------------
+            if (!length) {
+                return ProtectedRange();
+            }// end if (!length)
+            //--------------------------
+            auto it_opt = acquire_data_iterator();
+            if (!it_opt) {
+                return ProtectedRange();
+            }// end if (!it_opt)
+            //--------------------------
+            auto _it = it_opt.value();
+            T* _node = a_data.load(std::memory_order_acquire);
+            if (!_node or !m_registry.add(_node)) {
+                release_data_iterator(_it);
+                return ProtectedRange();
+            }// end if (!_node or !m_registry.add(_node))
+            _it->store_safe(_node);
+            //--------------------------
+            // The registry entry keeps the node alive while its extent is read
+            // (hazard_extent() dereferences it) and stays until the guard is
+            // released: a scan that copied the ranges before this one was
+            // published still finds the node in the registry.
+            if (a_data.load(std::memory_order_seq_cst) != _node) {
+                release_data_iterator(_it);
+                return ProtectedRange();
+            }// end if (a_data.load(std::memory_order_seq_cst) != _node)
+            //--------------------------
+            const std::span<const std::byte> _extent = node_extent(_node);
+            if (offset > _extent.size() or length > _extent.size() - offset) {
+                release_data_iterator(_it);
+                return ProtectedRange();
+            }// end if (offset > _extent.size() or length > _extent.size() - offset)
+            //--------------------------
+            const std::byte* _begin = _extent.data() + offset;
+            publish_range(_it, _begin, length);
+            return create_protected_range(_it, _begin, length);
+            //--------------------------
+        }// end ProtectedRange protect_range_data(const std::atomic<T*>& a_data, const size_t& offset, const size_t& length)
+        //--------------------------
+        // The count goes up before the range is visible, so a scan that reads 0
+        // started before any range it could have missed was published.
+        void publish_range(typename BitmaskType::iterator it, const std::byte* begin, const size_t& size) {
+            //--------------------------
+            RangeSlot& _slot        = m_ranges[slot_index(it)];
+            const uintptr_t _begin  = reinterpret_cast<uintptr_t>(begin);
+            m_range_count.fetch_add(1UL, std::memory_order_seq_cst);
+            _slot.end.store(_begin + size, std::memory_order_seq_cst);
+            _slot.begin.store(_begin, std::memory_order_seq_cst);
+            //--------------------------
+        }// end void publish_range(typename BitmaskType::iterator it, const std::byte* begin, const size_t& size)
+        //--------------------------
+        bool release_range_iterator(typename BitmaskType::iterator it) {
+            //--------------------------
+            RangeSlot& _slot = m_ranges[slot_index(it)];
+            _slot.begin.store(0U, std::memory_order_seq_cst);
+            _slot.end.store(0U, std::memory_order_release);
+            m_range_count.fetch_sub(1UL, std::memory_order_release);
+            //--------------------------
+            // Also drops the node's registry entry if the source form took one.
+            return release_data_iterator(it);
+            //--------------------------
+        }// end bool release_range_iterator(typename BitmaskType::iterator it)
+        //--------------------------
+        ProtectedRange create_protected_range(typename BitmaskType::iterator it, const std::byte* begin, const size_t& size) {
+            return ProtectedRange(begin, size, [this, it]() { return release_range_iterator(it); });
+        }// end ProtectedRange create_protected_range(...)
+        //--------------------------
+        size_t slot_index(typename BitmaskType::iterator it) {
+            return static_cast<size_t>(it - m_hazard_pointers.begin());
+        }// end size_t slot_index(typename BitmaskType::iterator it)
+        //--------------------------
+        static std::span<const std::byte> node_extent(const T* node) {
+            if constexpr (ExtentRetirable<T>) {
+                return node->hazard_extent();
+            } else {
+                return std::span<const std::byte>(reinterpret_cast<const std::byte*>(node), sizeof(T));
+            }// end if constexpr (ExtentRetirable<T>)
+        }// end static std::span<const std::byte> node_extent(const T* node)
+        //--------------------------
+        // Linear check of every published range; the reclaim scan uses the
+        // sorted snapshot in range_hazard() instead.
+        bool in_published_range(const T* node) const {
+            //--------------------------
+            const std::span<const std::byte> _extent = node_extent(node);
+            const uintptr_t _low  = reinterpret_cast<uintptr_t>(_extent.data());
+            const uintptr_t _high = _low + _extent.size();
+            //--------------------------
+            const size_t _capacity = m_hazard_pointers.capacity();
+            for (size_t i = 0; i < _capacity; ++i) {
+                const uintptr_t _begin = m_ranges[i].begin.load(std::memory_order_seq_cst);
+                if (!_begin) {
+                    continue;
+                }// end if (!_begin)
+                const uintptr_t _end = m_ranges[i].end.load(std::memory_order_seq_cst);
+                if (_begin < _end and _begin < _high and _low < _end) {
+                    return true;
+                }// end if (_begin < _end and _begin < _high and _low < _end)
+            }// end for (size_t i = 0; i < _capacity; ++i)
+            //--------------------------
+            return false;
+            //--------------------------
+        }// end bool in_published_range(const T* node) const
+        //--------------------------
         ProtectedPointer<T> create_protected_pointer(typename BitmaskType::iterator it, 
                                                     T* protected_obj,
                                                     std::shared_ptr<T> owner = nullptr) {
-            return ProtectedPointer<T>(protected_obj, std::bind(&HazardPointerManager::release_data_iterator, this, std::move(it)), std::move(owner));
+            // Two words, so std::function keeps it inline instead of allocating.
+            return ProtectedPointer<T>(protected_obj, [this, it]() { return release_data_iterator(it); }, std::move(owner));
         }// end ProtectedPointer<T> create_protected_pointer(...)
         //--------------------------
         ProtectedPointer<T> protect_with_owner(T* ptr, std::shared_ptr<T> owner) {
@@ -351,11 +726,15 @@ class HazardPointerManager {
         //--------------------------
         std::optional<typename BitmaskType::iterator> acquire_data_iterator(void) {
             //--------------------------
-            HazardThreadManager::instance();
-            //--------------------------
-            // Best effort: make sure the calling thread is registered, but never fail slot acquisition on registration issues.
-            auto& registry = ThreadRegistry::instance();
-            static_cast<void>(registry.register_id());
+            // Warmed-up threads registered in warm_up(); skipping the lookup keeps them
+            // off a ThreadRegistry slot another thread may be inserting into.
+            if (!warmed_thread()) {
+                HazardThreadManager::instance();
+                //--------------------------
+                // Best effort: make sure the calling thread is registered, but never fail slot acquisition on registration issues.
+                auto& registry = ThreadRegistry::instance();
+                static_cast<void>(registry.register_id());
+            }// end if (!warmed_thread())
             //--------------------------
             return m_hazard_pointers.acquire_iterator();
             //--------------------------
@@ -363,16 +742,31 @@ class HazardPointerManager {
         //--------------------------
         bool release_data_iterator(typename BitmaskType::iterator it) {
             //--------------------------        
+            const size_t _index = slot_index(it);
             T* ptr = it->load(std::memory_order_acquire);
             // Clear the hazard slot first, then drop from registry.
             const bool cleared = m_hazard_pointers.set(it, nullptr);
             if (ptr) {
                 m_registry.remove(ptr);
-            }
+            } else {
+                release_request(m_help[_index]);
+            }// end if (ptr)
+            m_releases[_index].fetch_add(1U, std::memory_order_release);
+            notify_release();
             return cleared;
             //--------------------------
         } // end bool release_data(const std::pair<std::optional<IndexType>, std::shared_ptr<HazardPointer<T>>>& hp)
         //--------------------------
+        // Drops a wait_free_protect result (or an empty one) held by the slot.
+        void release_request(HelpRequest& request) {
+            //--------------------------
+            if (request.state.load(std::memory_order_relaxed) != 0U) {
+                request.state.store(0U, std::memory_order_seq_cst);
+                m_help_pending.fetch_sub(1UL, std::memory_order_seq_cst);
+            }// end if (request.state.load(std::memory_order_relaxed) != 0U)
+            //--------------------------
+        }// end void release_request(HelpRequest& request)
+        //--------------------------
         bool retire_node(T* node, std::function<void(T*)> deleter) {
             //--------------------------
             if (!node) {
@@ -387,9 +781,28 @@ class HazardPointerManager {
             if (!node) {
                 return false;
             }
-            return retired_nodes().retire(node);
+            if constexpr (IntrusiveRetirable<T>) {
+                return retired_record().intrusive.retire(node);
+            } else {
+                return retired_nodes().retire(node);
+            }// end if constexpr (IntrusiveRetirable<T>)
         }// end bool retire_node(T* node)
         //--------------------------
+        template<typename U = T> requires IntrusiveRetirable<U>
+        bool retire_intrusive(T* node, typename hazard_obj_base<U>::reclaim_fn reclaim) {
+            if (!node) {
+                return false;
+            }
+            return retired_record().intrusive.retire(node, reclaim);
+        }// end bool retire_intrusive(T* node, typename hazard_obj_base<U>::reclaim_fn reclaim)
+        //--------------------------
+        bool retire_node(T* node, std::pmr::memory_resource* resource) {
+            if (!node) {
+                return false;
+            }
+            return retired_nodes().retire(node, resource);
+        }// end bool retire_node(T* node, std::pmr::memory_resource* resource)
+        //--------------------------
         bool retire_node(std::shared_ptr<T> node) {
             if (!node) {
                 return false;
@@ -397,50 +810,426 @@ class HazardPointerManager {
             return retired_nodes().retire(std::move(node));
         }// end bool retire_node(std::shared_ptr<T> node)
         //--------------------------
+        template <typename Pointers>
+        bool defer_data(const Pointers& pointers, std::function<void(void)>&& callback) {
+            return retired_record().deferred.defer(pointers, std::move(callback));
+        }// end bool defer_data(const Pointers& pointers, std::function<void(void)>&& callback)
+        //--------------------------
         bool is_hazard(const T* node) const {
             //--------------------------
             if (!node) {
                 return false;
             }// end if (!node)
             //--------------------------
-            return m_registry.contains(node);
+            if (is_pointer_hazard(node)) {
+                return true;
+            }// end if (is_pointer_hazard(node))
+            return m_range_count.load(std::memory_order_seq_cst) and in_published_range(node);
+            //--------------------------
         } // end bool is_hazard(const T* node)
         //--------------------------
+        bool is_pointer_hazard(const T* node) const {
+            //--------------------------
+            // A completed request stands in for a registry entry, so requests are
+            // helped and checked as well as the registry.
+            if (m_help_pending.load(std::memory_order_seq_cst)) {
+                const_cast<HazardPointerManager*>(this)->help_pending();
+                if (request_holds(node)) {
+                    return true;
+                }// end if (request_holds(node))
+            }// end if (m_help_pending.load(std::memory_order_seq_cst))
+            return m_registry.contains(node);
+            //--------------------------
+        } // end bool is_pointer_hazard(const T* node) const
+        //--------------------------
         void scan_and_reclaim(void) {
-            retired_nodes().reclaim_with([this](const T* ptr) {
-                return m_registry.contains(ptr);
-            });
+            reclaim_record(retired_record());
         } // end void scan_and_reclaim(void)
         //--------------------------
+        bool warm_up_data(void) {
+            //--------------------------
+            static_cast<void>(HazardThreadManager::instance());
+            static_cast<void>(ThreadRegistry::instance().register_id());
+            warmed_thread() = true;
+            Backoff::set_spin_only(true);
+            retired_record().ranges.reserve(m_hazard_pointers.capacity());
+            //--------------------------
+            return retired_record().retired.reserve(std::max(m_retired_threshold, 2UL * m_hazard_pointers.capacity()));
+            //--------------------------
+        } // end bool warm_up_data(void)
+        //--------------------------
+        static bool& warmed_thread(void) {
+            static thread_local bool tls_warm = false;
+            return tls_warm;
+        } // end static bool& warmed_thread(void)
+        //--------------------------
         void scan_and_reclaim_all(void) {
-            retired_nodes().clear();
+            //--------------------------
+            clear_record(retired_record());
+            // An exited thread's leftovers otherwise wait for the next thread to
+            // adopt its record. Claiming the record keeps a new thread out of it.
+            for (RetireRecord* _record = m_records.load(std::memory_order_acquire); _record; _record = _record->next) {
+                if (_record->active.load(std::memory_order_relaxed) or
+                    _record->active.exchange(true, std::memory_order_acq_rel)) {
+                    continue;
+                }// end if (_record->active ...)
+                try {
+                    clear_record(*_record);
+                } catch (...) {
+                    _record->active.store(false, std::memory_order_release);
+                    throw;
+                }// end try
+                _record->active.store(false, std::memory_order_release);
+            }// end for (RetireRecord* _record = ...)
+            //--------------------------
         } // end void scan_and_reclaim_all(void)
         //--------------------------
         void clear_data(void) {
             m_hazard_pointers.clear();
             m_registry.clear();
-            retired_nodes().clear();
+            for (size_t i = 0; i < m_hazard_pointers.capacity(); ++i) {
+                m_ranges[i].begin.store(0U, std::memory_order_relaxed);
+                m_ranges[i].end.store(0U, std::memory_order_relaxed);
+                m_help[i].state.store(0U, std::memory_order_relaxed);
+                m_releases[i].fetch_add(1U, std::memory_order_release);
+            }// end for (size_t i = 0; i < m_hazard_pointers.capacity(); ++i)
+            m_range_count.store(0UL, std::memory_order_release);
+            m_help_pending.store(0UL, std::memory_order_release);
+            notify_release();
+            clear_record(retired_record());
         } // end void clear_data(void)
         //--------------------------
+        // Called after a hazard is dropped. The fence pairs with the waiter count
+        // increment in wait_release(): either the releaser sees the waiter and bumps
+        // the generation, or the waiter sees the cleared hazard. With nobody waiting
+        // the release path pays a fence and a load, never a shared write.
+        void notify_release(void) {
+            //--------------------------
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (m_release_waiters.load(std::memory_order_relaxed) > 0U) {
+                m_release_generation.fetch_add(1U, std::memory_order_release);
+                m_release_generation.notify_all();
+            }// end if (m_release_waiters.load(std::memory_order_relaxed) > 0U)
+            //--------------------------
+        } // end void notify_release(void)
+        //--------------------------
+        template <typename Released>
+        void wait_release(Released&& released) {
+            //--------------------------
+            m_release_waiters.fetch_add(1U, std::memory_order_seq_cst);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            //--------------------------
+            Backoff _backoff;
+            uint32_t _generation = m_release_generation.load(std::memory_order_acquire);
+            while (!released()) {
+                _generation = _backoff.wait_while(m_release_generation, _generation);
+            }// end while (!released())
+            //--------------------------
+            m_release_waiters.fetch_sub(1U, std::memory_order_release);
+            //--------------------------
+        } // end void wait_release(Released&& released)
+        //--------------------------
+        void wait_unprotected_data(const T* pointer) {
+            //--------------------------
+            if (!pointer) {
+                return;
+            }// end if (!pointer)
+            //--------------------------
+            wait_release([this, pointer] { return !is_hazard(pointer); });
+            //--------------------------
+        } // end void wait_unprotected_data(const T* pointer)
+        //--------------------------
+        void synchronize_data(void) {
+            //--------------------------
+            // A slot counts as done once it has been released since entry, not once
+            // it holds something else: a reader that keeps re-protecting the same
+            // pointer gets the same slot back and would look held forever. A
+            // generation that moves while the slot is read means the hazard held
+            // at entry is already gone. A wait_free_protect request counts as held
+            // from posting to release: the completed state is the hazard, and a
+            // helper may have read the source before the caller's unlink and
+            // complete the request with it afterwards. Helping first settles
+            // whatever can be settled now.
+            if (m_help_pending.load(std::memory_order_seq_cst)) {
+                help_pending();
+            }// end if (m_help_pending.load(std::memory_order_seq_cst))
+            std::vector<std::pair<size_t, uint64_t>> _held;
+            const size_t _capacity = m_hazard_pointers.capacity();
+            for (size_t i = 0; i < _capacity; ++i) {
+                const uint64_t _generation  = m_releases[i].load(std::memory_order_seq_cst);
+                const bool _published       = m_help[i].state.load(std::memory_order_seq_cst) != 0U or
+                                              m_hazard_pointers.at(static_cast<IndexType>(i)) != nullptr or
+                                              m_ranges[i].begin.load(std::memory_order_seq_cst) != 0U;
+                if (_published and m_releases[i].load(std::memory_order_seq_cst) == _generation) {
+                    _held.emplace_back(i, _generation);
+                }// end if (_published and ...)
+            }// end for (size_t i = 0; i < _capacity; ++i)
+            //--------------------------
+            wait_release([this, &_held] {
+                std::erase_if(_held, [this](const std::pair<size_t, uint64_t>& entry) {
+                    return m_releases[entry.first].load(std::memory_order_acquire) != entry.second;
+                });
+                return _held.empty();
+            });
+            //--------------------------
+        } // end void synchronize_data(void)
+        //--------------------------
+        // Fixed tables up to the array limit live inside the manager; only the
+        // vector-backed ones above it take the policy.
+        static BitmaskType table_for(const MemoryPolicy& policy) {
+            if constexpr (std::is_constructible_v<BitmaskType, const MemoryPolicy&>) {
+                return BitmaskType(policy);
+            } else {
+                static_cast<void>(policy);
+                return BitmaskType();
+            }// end if constexpr (std::is_constructible_v<BitmaskType, const MemoryPolicy&>)
+        }// end static BitmaskType table_for(const MemoryPolicy& policy)
+        //--------------------------
         constexpr size_t hazard_limiter(size_t size) const {
             constexpr size_t c_min_limit = 1UL;
             return std::max(c_min_limit, size);
         }// end constexpr size_t retired_limiter(size_t size) const
         //--------------------------
         RetireMap<T>& retired_nodes(void) const {
+            return retired_record().retired;
+        }// end RetireMap<T>& retired_nodes(void)
+        //--------------------------
+        size_t retired_count(void) const {
             //--------------------------
-            static thread_local RetireMap<T> tls_retired(   m_retired_threshold,
-                                                            std::bind(&HazardPointerManager::is_hazard, this, std::placeholders::_1));
-            //--------------------------
-            return tls_retired;
+            const auto& _record = retired_record();
+            if constexpr (IntrusiveRetirable<T>) {
+                return _record.retired.size() + _record.intrusive.size();
+            } else {
+                return _record.retired.size();
+            }// end if constexpr (IntrusiveRetirable<T>)
             //--------------------------
-        }// end RetireMap<T>& retired_nodes(void)
+        }// end size_t retired_count(void) const
         //--------------------------------------------------------------
     private:
         //--------------------------------------------------------------
+        // Stand-in for RetireList when T has no intrusive hook.
+        struct NoRetireList {
+            NoRetireList(const size_t&, const std::function<bool(const T*)>&) {
+                //--------------------------
+            }// end NoRetireList(const size_t&, const std::function<bool(const T*)>&)
+        };// end struct NoRetireList
+        //--------------------------
+        using IntrusiveList = std::conditional_t<IntrusiveRetirable<T>, RetireList<T>, NoRetireList>;
+        //--------------------------------------------------------------
+        // Per-thread retire state. Records live in an append-only list owned by the
+        // manager and are handed back on thread exit, so short-lived threads reuse
+        // an already-reserved RetireMap instead of building and tearing one down.
+        struct RetireRecord {
+            //--------------------------
+            RetireRecord(   const size_t& threshold,
+                            const std::function<bool(const T*)>& hazard) :  active(true),
+                                                                            next(nullptr),
+                                                                            retired(threshold, hazard),
+                                                                            intrusive(threshold, hazard),
+                                                                            deferred(threshold, hazard) {
+                //--------------------------
+            }// end RetireRecord(const size_t& threshold, const std::function<bool(const T*)>& hazard)
+            //--------------------------
+            std::atomic<bool> active;
+            RetireRecord* next;
+            RetireMap<T> retired;
+            [[no_unique_address]] IntrusiveList intrusive;
+            DeferredQueue<T> deferred;
+            // Sorted, merged copy of the published ranges, rebuilt by each scan.
+            std::vector<std::pair<uintptr_t, uintptr_t>> ranges;
+            //--------------------------
+        };// end struct RetireRecord
+        //--------------------------------------------------------------
+        class RecordHandle {
+            public:
+                //--------------------------
+                explicit RecordHandle(HazardPointerManager* manager) :  m_manager(manager),
+                                                                        m_record(manager->acquire_record()) {
+                    //--------------------------
+                }// end explicit RecordHandle(HazardPointerManager* manager)
+                //--------------------------
+                RecordHandle(const RecordHandle&)               = delete;
+                RecordHandle& operator=(const RecordHandle&)    = delete;
+                //--------------------------
+                ~RecordHandle(void) {
+                    m_manager->release_record(m_record);
+                }// end ~RecordHandle(void)
+                //--------------------------
+                RetireRecord* record(void) const {
+                    return m_record;
+                }// end RetireRecord* record(void) const
+                //--------------------------
+            private:
+                //--------------------------
+                HazardPointerManager* m_manager;
+                RetireRecord* m_record;
+                //--------------------------
+        };// end class RecordHandle
+        //--------------------------------------------------------------
+        RetireRecord& retired_record(void) const {
+            //--------------------------
+            static thread_local RecordHandle tls_record(const_cast<HazardPointerManager*>(this));
+            //--------------------------
+            return *tls_record.record();
+            //--------------------------
+        }// end RetireRecord& retired_record(void) const
+        //--------------------------
+        void reclaim_record(RetireRecord& record) {
+            //--------------------------
+            if (!m_range_count.load(std::memory_order_seq_cst)) {
+                reclaim_record_with(record, [this](const T* ptr) {
+                    return is_hazard(ptr);
+                });
+                return;
+            }// end if (!m_range_count.load(std::memory_order_seq_cst))
+            //--------------------------
+            // One pass over the range slots per scan, then a binary search per node.
+            snapshot_ranges(record.ranges);
+            reclaim_record_with(record, [this, &record](const T* ptr) {
+                return ptr and (is_pointer_hazard(ptr) or range_hazard(record.ranges, ptr));
+            });
+            //--------------------------
+        }// end void reclaim_record(RetireRecord& record)
+        //--------------------------
+        template <typename Hazard>
+        void reclaim_record_with(RetireRecord& record, const Hazard& hazard) {
+            //--------------------------
+            record.deferred.reclaim_with(hazard);
+            record.retired.reclaim_with(hazard);
+            if constexpr (IntrusiveRetirable<T>) {
+                record.intrusive.reclaim_with(hazard);
+            }// end if constexpr (IntrusiveRetirable<T>)
+            //--------------------------
+        }// end void reclaim_record_with(RetireRecord& record, const Hazard& hazard)
+        //--------------------------
+        // Collects the published ranges, sorts them by begin and merges overlaps,
+        // so the ends come out sorted too. A slot caught between a release and
+        // the next publish can read as end <= begin; it is skipped, since its old
+        // range is gone and the new one is validated after it is visible.
+        void snapshot_ranges(std::vector<std::pair<uintptr_t, uintptr_t>>& ranges) const {
+            //--------------------------
+            ranges.clear();
+            const size_t _capacity = m_hazard_pointers.capacity();
+            for (size_t i = 0; i < _capacity; ++i) {
+                const uintptr_t _begin = m_ranges[i].begin.load(std::memory_order_seq_cst);
+                if (!_begin) {
+                    continue;
+                }// end if (!_begin)
+                const uintptr_t _end = m_ranges[i].end.load(std::memory_order_seq_cst);
+                if (_begin < _end) {
+                    ranges.emplace_back(_begin, _end);
+                }// end if (_begin < _end)
+            }// end for (size_t i = 0; i < _capacity; ++i)
+            //--------------------------
+            std::sort(ranges.begin(), ranges.end());
+            size_t _merged = 0;
+            for (size_t i = 1; i < ranges.size(); ++i) {
+                if (ranges[i].first <= ranges[_merged].second) {
+                    ranges[_merged].second = std::max(ranges[_merged].second, ranges[i].second);
+                } else {
+                    ranges[++_merged] = ranges[i];
+                }// end if (ranges[i].first <= ranges[_merged].second)
+            }// end for (size_t i = 1; i < ranges.size(); ++i)
+            ranges.resize(ranges.empty() ? 0UL : _merged + 1UL);
+            //--------------------------
+        }// end void snapshot_ranges(std::vector<std::pair<uintptr_t, uintptr_t>>& ranges) const
+        //--------------------------
+        static bool range_hazard(const std::vector<std::pair<uintptr_t, uintptr_t>>& ranges, const T* node) {
+            //--------------------------
+            const std::span<const std::byte> _extent = node_extent(node);
+            const uintptr_t _low  = reinterpret_cast<uintptr_t>(_extent.data());
+            const uintptr_t _high = _low + _extent.size();
+            // First range ending past the node's start; it overlaps if it starts before the node's end.
+            const auto _it = std::upper_bound(ranges.begin(), ranges.end(), _low,
+                                              [](const uintptr_t& value, const std::pair<uintptr_t, uintptr_t>& range) {
+                                                  return value < range.second;
+                                              });
+            return _it != ranges.end() and _it->first < _high;
+            //--------------------------
+        }// end static bool range_hazard(...)
+        //--------------------------
+        void clear_record(RetireRecord& record) {
+            //--------------------------
+            record.deferred.clear();
+            record.retired.clear();
+            if constexpr (IntrusiveRetirable<T>) {
+                record.intrusive.clear();
+            }// end if constexpr (IntrusiveRetirable<T>)
+            //--------------------------
+        }// end void clear_record(RetireRecord& record)
+        //--------------------------
+        RetireRecord* acquire_record(void) {
+            //--------------------------
+            for (RetireRecord* _record = m_records.load(std::memory_order_acquire); _record; _record = _record->next) {
+                if (!_record->active.load(std::memory_order_relaxed) and
+                    !_record->active.exchange(true, std::memory_order_acq_rel)) {
+                    return _record;
+                }// end if (!_record->active ...)
+            }// end for (RetireRecord* _record = ...)
+            //--------------------------
+            auto* _record = new RetireRecord(m_retired_threshold, std::bind(&HazardPointerManager::is_hazard, this, std::placeholders::_1));
+            RetireRecord* _head = m_records.load(std::memory_order_relaxed);
+            do {
+                _record->next = _head;
+            } while (!m_records.compare_exchange_weak(_head, _record, std::memory_order_release, std::memory_order_relaxed));
+            //--------------------------
+            return _record;
+            //--------------------------
+        }// end RetireRecord* acquire_record(void)
+        //--------------------------
+        void release_record(RetireRecord* record) {
+            //--------------------------
+            if (!record) {
+                return;
+            }// end if (!record)
+            //--------------------------
+            // Whatever is still protected stays in the record for the next owner.
+            // This runs at thread exit, so a deferred callback's exception stops
+            // here; the entries it did not reach stay queued for that owner too.
+            try {
+                reclaim_record(*record);
+            } catch (...) {
+            }// end try
+            record->active.store(false, std::memory_order_release);
+            //--------------------------
+        }// end void release_record(RetireRecord* record)
+        //--------------------------
+        size_t record_count(void) const {
+            //--------------------------
+            size_t _count = 0;
+            for (RetireRecord* _record = m_records.load(std::memory_order_acquire); _record; _record = _record->next) {
+                ++_count;
+            }// end for (RetireRecord* _record = ...)
+            //--------------------------
+            return _count;
+            //--------------------------
+        }// end size_t record_count(void) const
+        //--------------------------
+        void destroy_records(void) {
+            //--------------------------
+            RetireRecord* _record = m_records.exchange(nullptr, std::memory_order_acq_rel);
+            while (_record) {
+                RetireRecord* _next = _record->next;
+                delete _record;
+                _record = _next;
+            }// end while (_record)
+            //--------------------------
+        }// end void destroy_records(void)
+        //--------------------------------------------------------------
+        static constexpr size_t C_WAIT_FREE_ATTEMPTS = 4UL;
+        static constexpr uintptr_t C_NULL_RESULT     = 2U;
+        //--------------------------
         const size_t m_retired_threshold;
         BitmaskType m_hazard_pointers;
         HazardRegistry<T> m_registry;
+        std::unique_ptr<HelpRequest[]> m_help;
+        std::atomic<size_t> m_help_pending{0UL};
+        std::unique_ptr<RangeSlot[]> m_ranges;
+        std::atomic<size_t> m_range_count{0UL};
+        std::unique_ptr<std::atomic<uint64_t>[]> m_releases;
+        std::atomic<RetireRecord*> m_records{nullptr};
+        std::atomic<uint32_t> m_release_generation{0U};
+        std::atomic<uint32_t> m_release_waiters{0U};
         //--------------------------------------------------------------
     }; // end class HazardPointerManager
 //--------------------------------------------------------------
@@ -10,6 +10,11 @@
 #include <vector>
 #include <cstdint>
 //--------------------------------------------------------------
+// User Defined Headers
+//--------------------------------------------------------------
+#include "Backoff.hpp"
+#include "MemoryPolicy.hpp"
+//--------------------------------------------------------------
 namespace HazardSystem {
 //--------------------------------------------------------------
     // Lock-free open addressing registry for hazard addresses (no mutex)
@@ -22,24 +27,33 @@ namespace HazardSystem {
             HazardRegistry(void)                             = delete;
             ~HazardRegistry(void)                            = default;
             //--------------------------
-	            explicit HazardRegistry(const size_t& capacity = 0) : m_capacity(capacity_size(capacity)),
-	                                                                  m_mask(m_capacity - 1U),
-	                                                                  m_slots(std::make_unique<std::atomic<T*>[]>(m_capacity)),
-	                                                                  m_counts(std::make_unique<std::atomic<uint32_t>[]>(m_capacity)) {
+	            explicit HazardRegistry(const size_t& capacity = 0,
+	                                    const MemoryPolicy& policy = MemoryPolicy{}) :  m_capacity(capacity_size(capacity)),
+	                                                                                    m_mask(m_capacity - 1U),
+	                                                                                    m_slots(m_capacity, PolicyAllocator<std::atomic<T*>>(policy)),
+	                                                                                    m_counts(m_capacity, PolicyAllocator<std::atomic<uint32_t>>(policy)) {
 	              //--------------------------
 	              initialize_slots();
 	              //--------------------------
-	            }// end explicit HazardRegistry(const size_t& capacity = 0)
+	            }// end explicit HazardRegistry(const size_t& capacity, const MemoryPolicy& policy)
             //--------------------------
             HazardRegistry(const HazardRegistry&)            = delete;
             HazardRegistry& operator=(const HazardRegistry&) = delete;
-            HazardRegistry(HazardRegistry&&) noexcept        = default;
-            HazardRegistry& operator=(HazardRegistry&&)      = default;
+            HazardRegistry(HazardRegistry&&)                 = delete;
+            HazardRegistry& operator=(HazardRegistry&&)      = delete;
             //--------------------------
             bool add(T* ptr) {
               return add_local(ptr);
             }// end bool add(T* ptr)
             //--------------------------
+            // Bounded add: one pass over the probe sequence, at most
+            // C_TRY_ATTEMPTS failed CASes in all, and no waiting on an entry
+            // another thread is installing or tearing down. False on contention
+            // as well as when full.
+            bool try_add(T* ptr) {
+              return try_add_local(ptr);
+            }// end bool try_add(T* ptr)
+            //--------------------------
             bool remove(T* ptr) {
               return remove_local(ptr);
             }// end bool remove(T* ptr)
@@ -60,25 +74,25 @@ namespace HazardSystem {
             //--------------------------------------------------------------
 	            bool add_local(T* ptr) {
 	              //--------------------------
-	              if (!ptr or !m_slots or !m_counts) {
+	              if (!ptr or m_slots.empty() or m_counts.empty()) {
 	                return false;
-	              }// end if (!ptr or !m_slots)
+	              }// end if (!ptr or m_slots.empty() or m_counts.empty())
 	              //--------------------------
 	              const T* _tomb     = tombstone();
 	              const size_t _hash = hash(ptr);
 	              //--------------------------
-	              for (size_t i = 0; i < m_capacity; ++i) {
+	              Backoff _backoff;
+	              for (size_t i = 0; i < m_capacity;) {
 	                //--------------------------
 	                const size_t _idx = (_hash + i) & m_mask;
 	                T* _current       = m_slots[_idx].load(std::memory_order_acquire);
 	                //--------------------------
 	                if (_current == ptr) {
-	                  m_counts[_idx].fetch_add(1, std::memory_order_acq_rel);
-	                  // If a concurrent remove replaced the slot, undo and retry.
-	                  if (m_slots[_idx].load(std::memory_order_acquire) == ptr) {
+	                  if (join(_idx)) {
 	                    return true;
 	                  }
-	                  m_counts[_idx].fetch_sub(1, std::memory_order_acq_rel);
+	                  // Being installed or torn down; look at this slot again once settled.
+	                  wait_settled(_idx, ptr, _backoff);
 	                  continue;
 	                }// end if (_current == ptr)
 	                //--------------------------
@@ -86,28 +100,117 @@ namespace HazardSystem {
 	                  //--------------------------
 	                  T* _expected   = _current;
 	                  if (m_slots[_idx].compare_exchange_weak(_expected, ptr, std::memory_order_acq_rel, std::memory_order_acquire)) {
-	                    m_counts[_idx].fetch_add(1, std::memory_order_acq_rel);
+	                    m_counts[_idx].fetch_add(1, std::memory_order_seq_cst);
+	                    notify_settled();
 	                    return true;
 	                  }
-	                  if (_expected == ptr) {
-	                    m_counts[_idx].fetch_add(1, std::memory_order_acq_rel);
-	                    if (m_slots[_idx].load(std::memory_order_acquire) == ptr) {
-	                      return true;
-	                    }
-	                    m_counts[_idx].fetch_sub(1, std::memory_order_acq_rel);
-	                  }
+	                  // Lost the slot or spurious failure; look at it again.
+	                  continue;
 	                }// end if (!_current or _current == _tomb)
-	              }// end for (size_t i = 0; i < m_capacity; ++i)
+	                ++i;
+	              }// end for (size_t i = 0; i < m_capacity;)
 	              //--------------------------
 	              return false;
 	              //--------------------------
             }// end bool add_local(T* ptr)
+            //--------------------------
+            bool try_add_local(T* ptr) {
+              //--------------------------
+              if (!ptr or m_slots.empty() or m_counts.empty()) {
+                return false;
+              }// end if (!ptr or m_slots.empty() or m_counts.empty())
+              //--------------------------
+              const T* _tomb     = tombstone();
+              const size_t _hash = hash(ptr);
+              size_t _failures   = 0;
+              //--------------------------
+              for (size_t i = 0; i < m_capacity and _failures < C_TRY_ATTEMPTS;) {
+                //--------------------------
+                const size_t _idx = (_hash + i) & m_mask;
+                T* _current       = m_slots[_idx].load(std::memory_order_acquire);
+                //--------------------------
+                if (_current == ptr) {
+                  return try_join(_idx, C_TRY_ATTEMPTS - _failures);
+                }// end if (_current == ptr)
+                //--------------------------
+                if (!_current or _current == _tomb) {
+                  T* _expected = _current;
+                  if (m_slots[_idx].compare_exchange_strong(_expected, ptr, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                    m_counts[_idx].fetch_add(1, std::memory_order_seq_cst);
+                    notify_settled();
+                    return true;
+                  }// end if (m_slots[_idx].compare_exchange_strong(...))
+                  ++_failures;
+                  continue;
+                }// end if (!_current or _current == _tomb)
+                ++i;
+              }// end for (size_t i = 0; i < m_capacity and _failures < C_TRY_ATTEMPTS;)
+              //--------------------------
+              return false;
+              //--------------------------
+            }// end bool try_add_local(T* ptr)
+            //--------------------------
+            // Joins a live entry. A zero count means the slot is between install and
+            // its first count, or a remove has taken the last count and is about to
+            // tombstone it; bumping it then would be lost with the tombstone.
+            bool join(const size_t& index) {
+              //--------------------------
+              uint32_t _count = m_counts[index].load(std::memory_order_acquire);
+              while (_count > 0) {
+                if (m_counts[index].compare_exchange_weak(_count, _count + 1, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                  return true;
+                }// end if (m_counts[index].compare_exchange_weak(...))
+              }// end while (_count > 0)
+              return false;
+              //--------------------------
+            }// end bool join(const size_t& index)
+            //--------------------------
+            // join() with at most attempts CASes; an unsettled slot fails at once.
+            bool try_join(const size_t& index, const size_t& attempts) {
+              //--------------------------
+              uint32_t _count = m_counts[index].load(std::memory_order_acquire);
+              for (size_t i = 0; i < attempts and _count > 0; ++i) {
+                if (m_counts[index].compare_exchange_strong(_count, _count + 1, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                  return true;
+                }// end if (m_counts[index].compare_exchange_strong(...))
+              }// end for (size_t i = 0; i < attempts and _count > 0; ++i)
+              return false;
+              //--------------------------
+            }// end bool try_join(const size_t& index, const size_t& attempts)
+            //--------------------------
+            // Waits out a slot that holds ptr with a zero count. The add or remove
+            // that left it so may be preempted, so after spinning and yielding the
+            // waiter parks until notify_settled(). All seq_cst: either the waiter
+            // sees the slot settle or the settling thread sees the waiter. A
+            // spin-only (warmed) thread never parks; see Backoff.
+            void wait_settled(const size_t& index, const T* ptr, Backoff& backoff) {
+              //--------------------------
+              m_settle_waiters.fetch_add(1U, std::memory_order_seq_cst);
+              uint32_t _generation = m_settle_generation.load(std::memory_order_seq_cst);
+              while (m_slots[index].load(std::memory_order_seq_cst) == ptr and
+                     m_counts[index].load(std::memory_order_seq_cst) == 0U) {
+                _generation = backoff.wait_while(m_settle_generation, _generation, std::memory_order_seq_cst);
+              }// end while (slot index still holds ptr with no count)
+              m_settle_waiters.fetch_sub(1U, std::memory_order_release);
+              //--------------------------
+            }// end void wait_settled(const size_t& index, const T* ptr, Backoff& backoff)
+            //--------------------------
+            // Called after an install's first count or a remove's tombstone. Only
+            // enters the kernel while some thread is parked in wait_settled().
+            void notify_settled(void) {
+              //--------------------------
+              if (m_settle_waiters.load(std::memory_order_seq_cst) > 0U) {
+                m_settle_generation.fetch_add(1U, std::memory_order_seq_cst);
+                m_settle_generation.notify_all();
+              }// end if (m_settle_waiters.load(std::memory_order_seq_cst) > 0U)
+              //--------------------------
+            }// end void notify_settled(void)
             //--------------------------
 	            bool remove_local(T* ptr) {
 	              //--------------------------
-	              if (!ptr or !m_slots or !m_counts) {
+	              if (!ptr or m_slots.empty() or m_counts.empty()) {
 	                return false;
-	              }// end if (!ptr or !m_slots)
+	              }// end if (!ptr or m_slots.empty() or m_counts.empty())
 	              //--------------------------
 	              const T* _tomb      = tombstone();
 	              const size_t _hash  = hash(ptr);
@@ -119,15 +222,16 @@ namespace HazardSystem {
 	                //--------------------------
 	                if (_current == ptr) {
 	                  // Decrement refcount. If this was the last hazard, tombstone the slot.
-	                  uint32_t count = m_counts[_idx].load(std::memory_order_acquire);
-	                  while (count > 0 &&
-	                         !m_counts[_idx].compare_exchange_weak(
-	                             count, count - 1,
-	                             std::memory_order_acq_rel,
-	                             std::memory_order_acquire)) {
-	                    /* retry */ ;
+	                  // The caller holds one of the counts, so one fetch_sub cannot
+	                  // take it below zero and no retry loop is needed. A zero count
+	                  // means ptr was never added or the registry was cleared; the
+	                  // decrement is undone and nothing is removed.
+	                  if (m_counts[_idx].load(std::memory_order_acquire) == 0) {
+	                    return false;
 	                  }
+	                  const uint32_t count = m_counts[_idx].fetch_sub(1, std::memory_order_acq_rel);
 	                  if (count == 0) {
+	                    m_counts[_idx].fetch_add(1, std::memory_order_acq_rel);
 	                    return false;
 	                  }
 	                  if (count > 1) {
@@ -137,8 +241,9 @@ namespace HazardSystem {
 	                  T* _expected = ptr;
 	                  (void)m_slots[_idx].compare_exchange_strong(
 	                      _expected, const_cast<T*>(_tomb),
-	                      std::memory_order_acq_rel,
+	                      std::memory_order_seq_cst,
 	                      std::memory_order_acquire);
+	                  notify_settled();
 	                  return true;
 	                }// end if (_current == ptr)
 	                //--------------------------
@@ -154,9 +259,9 @@ namespace HazardSystem {
             //--------------------------
             bool contains_local(const T* ptr) const {
               //--------------------------
-              if (!ptr or !m_slots) {
+              if (!ptr or m_slots.empty()) {
                 return false;
-              }// end if (!ptr or !m_slots)
+              }// end if (!ptr or m_slots.empty())
               //--------------------------
               const size_t _hash = hash(ptr);
               //--------------------------
@@ -181,9 +286,9 @@ namespace HazardSystem {
             //--------------------------
             bool clear_local(void) {
               //--------------------------
-              if (!m_slots) {
+              if (m_slots.empty()) {
                 return false;
-              }// end if (!m_slots)
+              }// end if (m_slots.empty())
               //--------------------------
               initialize_slots();
               //--------------------------
@@ -240,10 +345,14 @@ namespace HazardSystem {
 	            }// end size_t hash(const T* ptr) const
 	            //--------------------------------------------------------------
 	          private:
+	            static constexpr size_t C_TRY_ATTEMPTS = 4UL;
+	            //--------------------------
 	            size_t m_capacity;
 	            size_t m_mask;
-	            std::unique_ptr<std::atomic<T*>[]> m_slots;
-	            std::unique_ptr<std::atomic<uint32_t>[]> m_counts;
+	            std::vector<std::atomic<T*>, PolicyAllocator<std::atomic<T*>>> m_slots;
+	            std::vector<std::atomic<uint32_t>, PolicyAllocator<std::atomic<uint32_t>>> m_counts;
+	            std::atomic<uint32_t> m_settle_generation{0U};
+	            std::atomic<uint32_t> m_settle_waiters{0U};
 	        //--------------------------------------------------------------
 	    }; // class HazardRegistry
     //--------------------------------------------------------------
@@ -0,0 +1,331 @@
+#pragma once
+//--------------------------------------------------------------
+// Standard C++ library
+//--------------------------------------------------------------
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <new>
+#include <type_traits>
+//--------------------------------------------------------------
+// Platform headers
+//--------------------------------------------------------------
+#if defined(__linux__)
+#include <linux/mempolicy.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+//--------------------------------------------------------------
+namespace HazardSystem {
+    //--------------------------------------------------------------
+    // Placement policy for the large slot arrays scanned on every reclaim
+    // (BitmaskTable slots and masks, HazardRegistry tables).
+    //
+    // HugePages backs an array with the system's default huge page size (read
+    // from /proc/meminfo, 2MB on most x86-64 hosts): MAP_HUGETLB first, then a
+    // normal mapping with MADV_HUGEPAGE so transparent huge pages can step in. NUMA
+    // Interleave spreads the pages over every online node; Bind keeps them on
+    // one node (node < 0 means the node the constructing thread runs on).
+    // Anything the platform does not offer quietly degrades to ordinary pages.
+    //--------------------------------------------------------------
+    enum class PagePolicy : uint8_t {
+        Default = 0,
+        HugePages
+    };// end enum class PagePolicy
+    //--------------------------
+    enum class NumaPolicy : uint8_t {
+        Default = 0,
+        Interleave,
+        Bind
+    };// end enum class NumaPolicy
+    //--------------------------------------------------------------
+    struct MemoryPolicy {
+        PagePolicy pages{PagePolicy::Default};
+        NumaPolicy numa{NumaPolicy::Default};
+        int node{-1};
+        //--------------------------
+        static constexpr MemoryPolicy huge_pages(void) {
+            return MemoryPolicy{PagePolicy::HugePages, NumaPolicy::Default, -1};
+        }// end static constexpr MemoryPolicy huge_pages(void)
+        //--------------------------
+        static constexpr MemoryPolicy interleave(const PagePolicy& pages = PagePolicy::Default) {
+            return MemoryPolicy{pages, NumaPolicy::Interleave, -1};
+        }// end static constexpr MemoryPolicy interleave(const PagePolicy& pages)
+        //--------------------------
+        static constexpr MemoryPolicy bind(const int& node = -1, const PagePolicy& pages = PagePolicy::Default) {
+            return MemoryPolicy{pages, NumaPolicy::Bind, node};
+        }// end static constexpr MemoryPolicy bind(const int& node, const PagePolicy& pages)
+        //--------------------------
+        constexpr bool is_default(void) const {
+            return pages == PagePolicy::Default and numa == NumaPolicy::Default;
+        }// end constexpr bool is_default(void) const
+        //--------------------------
+        friend constexpr bool operator==(const MemoryPolicy&, const MemoryPolicy&) = default;
+    };// end struct MemoryPolicy
+    //--------------------------------------------------------------
+    // NUMA topology queries shared by PolicyAllocator and ObjectPool. Both
+    // degrade to a single node 0 where the platform cannot tell.
+    //--------------------------------------------------------------
+    namespace Numa {
+        //--------------------------
+        inline constexpr size_t C_MAX_NODES = sizeof(unsigned long) * 8UL;
+        //--------------------------
+        // Bit n set for every online node n; at least node 0.
+        inline unsigned long online_nodes(void) {
+            //--------------------------
+            // /sys/devices/system/node/online reads like "0-3,6".
+            unsigned long _mask = 0UL;
+            std::FILE* _file    = std::fopen("/sys/devices/system/node/online", "r");
+            if (_file) {
+                unsigned _first = 0U, _last = 0U;
+                int _read       = 0;
+                while ((_read = std::fscanf(_file, "%u", &_first)) == 1) {
+                    _last = _first;
+                    int _next = std::fgetc(_file);
+                    if (_next == '-') {
+                        if (std::fscanf(_file, "%u", &_last) != 1) {
+                            break;
+                        }// end if (std::fscanf(_file, "%u", &_last) != 1)
+                        _next = std::fgetc(_file);
+                    }// end if (_next == '-')
+                    for (unsigned n = _first; n <= _last and n < C_MAX_NODES; ++n) {
+                        _mask |= 1UL << n;
+                    }// end for (unsigned n = _first; n <= _last and n < C_MAX_NODES; ++n)
+                    if (_next != ',') {
+                        break;
+                    }// end if (_next != ',')
+                }// end while (... == 1)
+                std::fclose(_file);
+            }// end if (_file)
+            //--------------------------
+            return _mask ? _mask : 1UL;
+            //--------------------------
+        }// end inline unsigned long online_nodes(void)
+        //--------------------------
+        // Node the calling thread runs on right now, or -1 when unknown.
+        inline int current_node(void) {
+#if defined(__linux__) && defined(SYS_getcpu)
+            unsigned _cpu = 0U, _node = 0U;
+            if (::syscall(SYS_getcpu, &_cpu, &_node, nullptr) == 0) {
+                return static_cast<int>(_node);
+            }// end if (::syscall(SYS_getcpu, &_cpu, &_node, nullptr) == 0)
+#endif
+            return -1;
+        }// end inline int current_node(void)
+        //--------------------------
+    }// end namespace Numa
+    //--------------------------------------------------------------
+    // Page sizes as the running system reports them, read once per process.
+    //--------------------------------------------------------------
+    namespace Pages {
+        //--------------------------
+        // Base page size; 4KB where the platform cannot tell.
+        inline size_t page_size(void) {
+            //--------------------------
+            static const size_t _size = [] {
+#if defined(__linux__)
+                const long _value = ::sysconf(_SC_PAGESIZE);
+                if (_value > 0L) {
+                    return static_cast<size_t>(_value);
+                }// end if (_value > 0L)
+#endif
+                return 4096UL;
+            }();
+            return _size;
+            //--------------------------
+        }// end inline size_t page_size(void)
+        //--------------------------
+        // Default huge page size, or 0 when the system reports none or one that is
+        // not a power-of-two multiple of the base page; HugePages then maps
+        // ordinary pages.
+        inline size_t huge_page_size(void) {
+            //--------------------------
+            static const size_t _size = [] {
+                size_t _bytes = 0UL;
+#if defined(__linux__)
+                // /proc/meminfo has a line like "Hugepagesize:    2048 kB".
+                std::FILE* _file = std::fopen("/proc/meminfo", "r");
+                if (_file) {
+                    char _line[128];
+                    unsigned long _kb = 0UL;
+                    while (std::fgets(_line, sizeof(_line), _file)) {
+                        if (std::sscanf(_line, "Hugepagesize: %lu kB", &_kb) == 1) {
+                            _bytes = static_cast<size_t>(_kb) * 1024UL;
+                            break;
+                        }// end if (std::sscanf(_line, "Hugepagesize: %lu kB", &_kb) == 1)
+                    }// end while (std::fgets(_line, sizeof(_line), _file))
+                    std::fclose(_file);
+                }// end if (_file)
+#endif
+                const bool _usable = _bytes > page_size() and (_bytes & (_bytes - 1UL)) == 0UL;
+                return _usable ? _bytes : 0UL;
+            }();
+            return _size;
+            //--------------------------
+        }// end inline size_t huge_page_size(void)
+        //--------------------------
+    }// end namespace Pages
+    //--------------------------------------------------------------
+    // Standard allocator that places its storage according to a MemoryPolicy.
+    // The default policy is plain std::allocator, so containers that never ask
+    // for a policy pay nothing. Whether a block was mapped is decided from the
+    // policy and size alone, so deallocate() never needs a side table.
+    //--------------------------------------------------------------
+    template<typename V>
+    class PolicyAllocator {
+        //--------------------------------------------------------------
+        public:
+            //--------------------------------------------------------------
+            using value_type                             = V;
+            using propagate_on_container_move_assignment = std::true_type;
+            using propagate_on_container_swap            = std::true_type;
+            //--------------------------------------------------------------
+            PolicyAllocator(void) noexcept = default;
+            //--------------------------
+            explicit PolicyAllocator(const MemoryPolicy& policy) noexcept : m_policy(policy) {
+                //--------------------------
+            }// end explicit PolicyAllocator(const MemoryPolicy& policy) noexcept
+            //--------------------------
+            template<typename U>
+            PolicyAllocator(const PolicyAllocator<U>& other) noexcept : m_policy(other.policy()) {
+                //--------------------------
+            }// end PolicyAllocator(const PolicyAllocator<U>& other) noexcept
+            //--------------------------
+            V* allocate(const size_t& count) {
+                return static_cast<V*>(allocate_data(count * sizeof(V)));
+            }// end V* allocate(const size_t& count)
+            //--------------------------
+            void deallocate(V* ptr, const size_t& count) noexcept {
+                deallocate_data(ptr, count * sizeof(V));
+            }// end void deallocate(V* ptr, const size_t& count) noexcept
+            //--------------------------
+            const MemoryPolicy& policy(void) const noexcept {
+                return m_policy;
+            }// end const MemoryPolicy& policy(void) const noexcept
+            //--------------------------
+            template<typename U>
+            bool operator==(const PolicyAllocator<U>& other) const noexcept {
+                return m_policy == other.policy();
+            }// end bool operator==(const PolicyAllocator<U>& other) const noexcept
+            //--------------------------------------------------------------
+        protected:
+            //--------------------------------------------------------------
+            bool mapped(const size_t& bytes) const {
+#if defined(__linux__)
+                // Page placement is meaningless for anything smaller than a page.
+                return !m_policy.is_default() and bytes >= Pages::page_size();
+#else
+                static_cast<void>(bytes);
+                return false;
+#endif
+            }// end bool mapped(const size_t& bytes) const
+            //--------------------------
+            size_t mapping_length(const size_t& bytes) const {
+                //--------------------------
+                const size_t _align  = huge_mapping(bytes) ? Pages::huge_page_size() : Pages::page_size();
+                return (bytes + _align - 1UL) & ~(_align - 1UL);
+                //--------------------------
+            }// end size_t mapping_length(const size_t& bytes) const
+            //--------------------------
+            // Arrays well short of a huge page are not worth rounding up to one, and
+            // without a usable huge page size HugePages maps ordinary pages.
+            bool huge_mapping(const size_t& bytes) const {
+                //--------------------------
+                const size_t _huge = Pages::huge_page_size();
+                return m_policy.pages == PagePolicy::HugePages and _huge > 0UL and bytes >= _huge / 4UL;
+                //--------------------------
+            }// end bool huge_mapping(const size_t& bytes) const
+            //--------------------------
+            void* allocate_data(const size_t& bytes) {
+                //--------------------------
+                if (!mapped(bytes)) {
+                    return std::allocator<V>().allocate(bytes / sizeof(V));
+                }// end if (!mapped(bytes))
+                //--------------------------
+#if defined(__linux__)
+                const size_t _length = mapping_length(bytes);
+                void* _ptr           = MAP_FAILED;
+                //--------------------------
+                if (huge_mapping(bytes)) {
+                    _ptr = ::mmap(nullptr, _length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+                    if (_ptr == MAP_FAILED) {
+                        // No reserved hugetlb pages: fall back to THP on a normal mapping.
+                        _ptr = ::mmap(nullptr, _length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                        if (_ptr != MAP_FAILED) {
+                            static_cast<void>(::madvise(_ptr, _length, MADV_HUGEPAGE));
+                        }// end if (_ptr != MAP_FAILED)
+                    }// end if (_ptr == MAP_FAILED)
+                } else {
+                    _ptr = ::mmap(nullptr, _length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                }// end if (huge_mapping(bytes))
+                //--------------------------
+                if (_ptr == MAP_FAILED) {
+                    throw std::bad_alloc();
+                }// end if (_ptr == MAP_FAILED)
+                //--------------------------
+                // Pages are untouched until the container constructs into them, so
+                // the NUMA policy decides where they land on first touch.
+                apply_numa(_ptr, _length);
+                return _ptr;
+#else
+                return nullptr;
+#endif
+                //--------------------------
+            }// end void* allocate_data(const size_t& bytes)
+            //--------------------------
+            void deallocate_data(void* ptr, const size_t& bytes) noexcept {
+                //--------------------------
+                if (!ptr) {
+                    return;
+                }// end if (!ptr)
+                //--------------------------
+                if (!mapped(bytes)) {
+                    std::allocator<V>().deallocate(static_cast<V*>(ptr), bytes / sizeof(V));
+                    return;
+                }// end if (!mapped(bytes))
+                //--------------------------
+#if defined(__linux__)
+                static_cast<void>(::munmap(ptr, mapping_length(bytes)));
+#endif
+                //--------------------------
+            }// end void deallocate_data(void* ptr, const size_t& bytes) noexcept
+            //--------------------------
+            void apply_numa(void* ptr, const size_t& length) const {
+#if defined(__linux__) && defined(SYS_mbind)
+                //--------------------------
+                if (m_policy.numa == NumaPolicy::Default) {
+                    return;
+                }// end if (m_policy.numa == NumaPolicy::Default)
+                //--------------------------
+                unsigned long _mask = 0UL;
+                int _mode           = MPOL_INTERLEAVE;
+                if (m_policy.numa == NumaPolicy::Interleave) {
+                    _mask = Numa::online_nodes();
+                } else {
+                    const int _node = m_policy.node >= 0 ? m_policy.node : Numa::current_node();
+                    if (_node < 0 or _node >= static_cast<int>(Numa::C_MAX_NODES)) {
+                        return;
+                    }// end if (_node < 0 or _node >= static_cast<int>(Numa::C_MAX_NODES))
+                    _mask = 1UL << static_cast<unsigned>(_node);
+                    _mode = MPOL_BIND;
+                }// end if (m_policy.numa == NumaPolicy::Interleave)
+                //--------------------------
+                // Best effort: a kernel without NUMA support just keeps the default.
+                static_cast<void>(::syscall(SYS_mbind, ptr, length, _mode, &_mask, Numa::C_MAX_NODES + 1UL, 0U));
+                //--------------------------
+#else
+                static_cast<void>(ptr);
+                static_cast<void>(length);
+#endif
+            }// end void apply_numa(void* ptr, const size_t& length) const
+            //--------------------------------------------------------------
+        private:
+            //--------------------------------------------------------------
+            MemoryPolicy m_policy{};
+        //--------------------------------------------------------------
+    };// end class PolicyAllocator
+    //--------------------------------------------------------------
+}// end namespace HazardSystem
+//--------------------------------------------------------------
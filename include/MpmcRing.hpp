@@ -0,0 +1,485 @@
+#pragma once
+//--------------------------------------------------------------
+// Standard C++ library
+//--------------------------------------------------------------
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <algorithm>
+#include <bit>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+//--------------------------------------------------------------
+// User Defined Headers
+//--------------------------------------------------------------
+#include "Backoff.hpp"
+#include "HazardPointerManager.hpp"
+//--------------------------------------------------------------
+namespace HazardSystem {
+    //--------------------------------------------------------------
+    // Bounded many-producer, many-consumer ring (Vyukov) that can grow while
+    // it is in use.
+    //
+    // Each cell carries a sequence number: cell i is free for the producer of
+    // position p when it reads p, and full for the consumer when it reads
+    // p + 1. A producer claims a position with one CAS on the enqueue counter
+    // and a consumer with one CAS on the dequeue counter; neither allocates.
+    //
+    // grow() links a larger segment behind the current one and sets the
+    // CLOSED bit in the old segment's enqueue counter, so no further position
+    // can be claimed there. Producers then move on to the new segment.
+    // Consumers finish the old segment first, which keeps FIFO order, then
+    // advance the head. The consumer that advances the head retires the old
+    // segment through HazardPointerManager<Segment>. Every operation protects
+    // the segment it works in, so the segment is freed only after the last
+    // straggler has left it.
+    //
+    // Batch calls claim a run of positions with a single CAS. A cell in the
+    // run can still be held by a thread that claimed it a lap earlier; the
+    // batch waits for that thread to finish with it.
+    //--------------------------------------------------------------
+    template<typename T>
+    class MpmcRing {
+        //--------------------------------------------------------------
+        static_assert(std::is_nothrow_move_constructible_v<T>, "MpmcRing moves items in and out of its cells and requires a nothrow move");
+        //--------------------------------------------------------------
+        public:
+            //--------------------------------------------------------------
+            struct Segment {
+                //--------------------------
+                struct Cell {
+                    std::atomic<size_t> sequence;
+                    alignas(T) std::byte storage[sizeof(T)];
+                    //--------------------------
+                    T* item(void) {
+                        return std::launder(reinterpret_cast<T*>(storage));
+                    }// end T* item(void)
+                };// end struct Cell
+                //--------------------------
+                explicit Segment(const size_t& capacity_) : capacity(capacity_),
+                                                            mask(capacity_ - 1UL),
+                                                            cells(std::make_unique<Cell[]>(capacity_)),
+                                                            enqueue(0UL),
+                                                            dequeue(0UL),
+                                                            next(nullptr) {
+                    //--------------------------
+                    for (size_t i = 0; i < capacity; ++i) {
+                        cells[i].sequence.store(i, std::memory_order_relaxed);
+                    }// end for (size_t i = 0; i < capacity; ++i)
+                    //--------------------------
+                }// end explicit Segment(const size_t& capacity_)
+                //--------------------------
+                Cell& cell(const size_t& position) {
+                    return cells[position & mask];
+                }// end Cell& cell(const size_t& position)
+                //--------------------------
+                const size_t capacity;
+                const size_t mask;
+                std::unique_ptr<Cell[]> cells;
+                alignas(64) std::atomic<size_t> enqueue;
+                alignas(64) std::atomic<size_t> dequeue;
+                // Set once, before the segment is closed.
+                alignas(64) std::atomic<Segment*> next;
+                //--------------------------
+            };// end struct Segment
+            //--------------------------------------------------------------
+            using Manager = HazardPointerManager<Segment, 0>;
+            //--------------------------------------------------------------
+            // threads sizes the segment manager shared by every ring of this T, on
+            // first use only; each call holds one hazard. A call that finds no
+            // free hazard slot reports full or empty.
+            explicit MpmcRing(  const size_t& capacity = 1024UL,
+                                const size_t& threads = C_DEFAULT_THREADS) :  m_manager(Manager::instance(std::max<size_t>(1UL, threads))),
+                                                                              m_head(nullptr),
+                                                                              m_tail(nullptr) {
+                //--------------------------
+                auto* _segment = new Segment(capacity_size(capacity));
+                m_head.store(_segment, std::memory_order_relaxed);
+                m_tail.store(_segment, std::memory_order_relaxed);
+                //--------------------------
+            }// end explicit MpmcRing(const size_t& capacity, const size_t& threads)
+            //--------------------------
+            MpmcRing(const MpmcRing&)               = delete;
+            MpmcRing& operator=(const MpmcRing&)    = delete;
+            MpmcRing(MpmcRing&&)                    = delete;
+            MpmcRing& operator=(MpmcRing&&)         = delete;
+            //--------------------------
+            // No other thread may still be using the ring; segments already
+            // retired stay with the manager.
+            ~MpmcRing(void) {
+                //--------------------------
+                Segment* _segment = m_head.load(std::memory_order_acquire);
+                while (_segment) {
+                    const size_t _end = _segment->enqueue.load(std::memory_order_relaxed) & ~C_CLOSED;
+                    for (size_t i = _segment->dequeue.load(std::memory_order_relaxed); i < _end; ++i) {
+                        std::destroy_at(_segment->cell(i).item());
+                    }// end for (size_t i = ...; i < _end; ++i)
+                    Segment* _next = _segment->next.load(std::memory_order_relaxed);
+                    delete _segment;
+                    _segment = _next;
+                }// end while (_segment)
+                //--------------------------
+            }// end ~MpmcRing(void)
+            //--------------------------
+            // False when the ring is full.
+            bool try_push(T value) {
+                return push_data(std::move(value));
+            }// end bool try_push(T value)
+            //--------------------------
+            std::optional<T> try_pop(void) {
+                return pop_data();
+            }// end std::optional<T> try_pop(void)
+            //--------------------------
+            // Moves items from [first, last) in until the ring is full; returns how
+            // many went in.
+            template<typename Iterator>
+            size_t push_batch(Iterator first, Iterator last) {
+                return push_batch_data(first, last);
+            }// end size_t push_batch(Iterator first, Iterator last)
+            //--------------------------
+            // Appends up to count items to out, oldest first.
+            size_t pop_batch(std::vector<T>& out, const size_t& count) {
+                return pop_batch_data(out, count);
+            }// end size_t pop_batch(std::vector<T>& out, const size_t& count)
+            //--------------------------
+            // Publishes a segment of at least capacity cells (rounded up to a power
+            // of two) behind the current one. False if that is no larger than the
+            // current segment or another grow got there first.
+            bool grow(const size_t& capacity) {
+                return grow_data(capacity_size(capacity));
+            }// end bool grow(const size_t& capacity)
+            //--------------------------
+            // Capacity of the segment producers are filling.
+            size_t capacity(void) const {
+                //--------------------------
+                auto _segment = m_manager.protect(m_tail);
+                return _segment ? _segment->capacity : 0UL;
+                //--------------------------
+            }// end size_t capacity(void) const
+            //--------------------------
+            // Approximate while other threads are running; counts the head and tail
+            // segments only, which are all there is outside of back-to-back grows.
+            size_t size(void) const {
+                //--------------------------
+                auto _head = m_manager.protect(m_head);
+                if (!_head) {
+                    return 0UL;
+                }// end if (!_head)
+                size_t _size = occupied(*_head);
+                auto _tail   = m_manager.protect(m_tail);
+                if (_tail and _tail.get() != _head.get()) {
+                    _size += occupied(*_tail);
+                }// end if (_tail and _tail.get() != _head.get())
+                return _size;
+                //--------------------------
+            }// end size_t size(void) const
+            //--------------------------
+            bool empty(void) const {
+                return size() == 0UL;
+            }// end bool empty(void) const
+            //--------------------------------------------------------------
+        protected:
+            //--------------------------------------------------------------
+            enum class Claim : uint8_t {
+                Claimed = 0,
+                Full,
+                Empty,
+                // Producers only: the segment was closed by a grow.
+                Closed
+            };// end enum class Claim
+            //--------------------------
+            static size_t occupied(const Segment& segment) {
+                //--------------------------
+                const size_t _dequeue = segment.dequeue.load(std::memory_order_relaxed);
+                const size_t _enqueue = segment.enqueue.load(std::memory_order_relaxed) & ~C_CLOSED;
+                return _enqueue > _dequeue ? _enqueue - _dequeue : 0UL;
+                //--------------------------
+            }// end static size_t occupied(const Segment& segment)
+            //--------------------------
+            // Vyukov: the cell's sequence says whether position is ours to fill.
+            static Claim claim_push(Segment& segment, size_t& position) {
+                //--------------------------
+                position = segment.enqueue.load(std::memory_order_relaxed);
+                while (true) {
+                    if (position & C_CLOSED) {
+                        return Claim::Closed;
+                    }// end if (position & C_CLOSED)
+                    const size_t _sequence  = segment.cell(position).sequence.load(std::memory_order_acquire);
+                    const intptr_t _lag     = static_cast<intptr_t>(_sequence) - static_cast<intptr_t>(position);
+                    if (_lag == 0) {
+                        if (segment.enqueue.compare_exchange_weak(position, position + 1UL, std::memory_order_relaxed, std::memory_order_relaxed)) {
+                            return Claim::Claimed;
+                        }// end if (segment.enqueue.compare_exchange_weak(...))
+                    } else if (_lag < 0) {
+                        return Claim::Full;
+                    } else {
+                        position = segment.enqueue.load(std::memory_order_relaxed);
+                    }// end if (_lag == 0)
+                }// end while (true)
+                //--------------------------
+            }// end static Claim claim_push(Segment& segment, size_t& position)
+            //--------------------------
+            static Claim claim_pop(Segment& segment, size_t& position) {
+                //--------------------------
+                position = segment.dequeue.load(std::memory_order_relaxed);
+                while (true) {
+                    const size_t _sequence  = segment.cell(position).sequence.load(std::memory_order_acquire);
+                    const intptr_t _lag     = static_cast<intptr_t>(_sequence) - static_cast<intptr_t>(position + 1UL);
+                    if (_lag == 0) {
+                        if (segment.dequeue.compare_exchange_weak(position, position + 1UL, std::memory_order_relaxed, std::memory_order_relaxed)) {
+                            return Claim::Claimed;
+                        }// end if (segment.dequeue.compare_exchange_weak(...))
+                    } else if (_lag < 0) {
+                        return Claim::Empty;
+                    } else {
+                        position = segment.dequeue.load(std::memory_order_relaxed);
+                    }// end if (_lag == 0)
+                }// end while (true)
+                //--------------------------
+            }// end static Claim claim_pop(Segment& segment, size_t& position)
+            //--------------------------
+            // Claims up to count positions below the free space the dequeue counter
+            // leaves; 0 when full or closed.
+            static size_t claim_push_run(Segment& segment, const size_t& count, size_t& first, bool& closed) {
+                //--------------------------
+                first = segment.enqueue.load(std::memory_order_relaxed);
+                while (true) {
+                    if (first & C_CLOSED) {
+                        closed = true;
+                        return 0UL;
+                    }// end if (first & C_CLOSED)
+                    const size_t _dequeue = segment.dequeue.load(std::memory_order_acquire);
+                    if (_dequeue > first) {
+                        // Stale counter: consumers have moved past it.
+                        first = segment.enqueue.load(std::memory_order_relaxed);
+                        continue;
+                    }// end if (_dequeue > first)
+                    const size_t _run = std::min(count, segment.capacity - (first - _dequeue));
+                    if (_run == 0UL) {
+                        return 0UL;
+                    }// end if (_run == 0UL)
+                    if (segment.enqueue.compare_exchange_weak(first, first + _run, std::memory_order_relaxed, std::memory_order_relaxed)) {
+                        return _run;
+                    }// end if (segment.enqueue.compare_exchange_weak(...))
+                }// end while (true)
+                //--------------------------
+            }// end static size_t claim_push_run(Segment& segment, const size_t& count, size_t& first, bool& closed)
+            //--------------------------
+            // Claims up to count positions that producers have already claimed.
+            static size_t claim_pop_run(Segment& segment, const size_t& count, size_t& first) {
+                //--------------------------
+                first = segment.dequeue.load(std::memory_order_relaxed);
+                while (true) {
+                    const size_t _enqueue = segment.enqueue.load(std::memory_order_acquire) & ~C_CLOSED;
+                    const size_t _run     = std::min(count, _enqueue > first ? _enqueue - first : 0UL);
+                    if (_run == 0UL) {
+                        return 0UL;
+                    }// end if (_run == 0UL)
+                    if (segment.dequeue.compare_exchange_weak(first, first + _run, std::memory_order_relaxed, std::memory_order_relaxed)) {
+                        return _run;
+                    }// end if (segment.dequeue.compare_exchange_weak(...))
+                }// end while (true)
+                //--------------------------
+            }// end static size_t claim_pop_run(Segment& segment, const size_t& count, size_t& first)
+            //--------------------------
+            static void fill(Segment& segment, const size_t& position, T&& value) {
+                auto& _cell = segment.cell(position);
+                std::construct_at(_cell.item(), std::move(value));
+                _cell.sequence.store(position + 1UL, std::memory_order_release);
+            }// end static void fill(Segment& segment, const size_t& position, T&& value)
+            //--------------------------
+            static T drain(Segment& segment, const size_t& position) {
+                //--------------------------
+                auto& _cell = segment.cell(position);
+                T _value(std::move(*_cell.item()));
+                std::destroy_at(_cell.item());
+                // Free for the producer one lap ahead.
+                _cell.sequence.store(position + segment.capacity, std::memory_order_release);
+                return _value;
+                //--------------------------
+            }// end static T drain(Segment& segment, const size_t& position)
+            //--------------------------
+            static void wait_for(const typename Segment::Cell& cell, const size_t& sequence) {
+                //--------------------------
+                Backoff _backoff;
+                while (cell.sequence.load(std::memory_order_acquire) != sequence) {
+                    _backoff.pause();
+                }// end while (cell.sequence.load(std::memory_order_acquire) != sequence)
+                //--------------------------
+            }// end static void wait_for(const typename Segment::Cell& cell, const size_t& sequence)
+            //--------------------------
+            bool push_data(T&& value) {
+                //--------------------------
+                while (true) {
+                    //--------------------------
+                    auto _segment = m_manager.protect(m_tail);
+                    if (!_segment) {
+                        return false;
+                    }// end if (!_segment)
+                    //--------------------------
+                    size_t _position   = 0UL;
+                    const Claim _claim = claim_push(*_segment, _position);
+                    if (_claim == Claim::Claimed) {
+                        fill(*_segment, _position, std::move(value));
+                        return true;
+                    }// end if (_claim == Claim::Claimed)
+                    if (_claim == Claim::Full) {
+                        return false;
+                    }// end if (_claim == Claim::Full)
+                    advance_tail(_segment.get());
+                    //--------------------------
+                }// end while (true)
+                //--------------------------
+            }// end bool push_data(T&& value)
+            //--------------------------
+            std::optional<T> pop_data(void) {
+                //--------------------------
+                while (true) {
+                    //--------------------------
+                    auto _segment = m_manager.protect(m_head);
+                    if (!_segment) {
+                        return std::nullopt;
+                    }// end if (!_segment)
+                    //--------------------------
+                    size_t _position = 0UL;
+                    if (claim_pop(*_segment, _position) == Claim::Claimed) {
+                        return drain(*_segment, _position);
+                    }// end if (claim_pop(*_segment, _position) == Claim::Claimed)
+                    if (!advance_head(_segment.get())) {
+                        return std::nullopt;
+                    }// end if (!advance_head(_segment.get()))
+                    //--------------------------
+                }// end while (true)
+                //--------------------------
+            }// end std::optional<T> pop_data(void)
+            //--------------------------
+            template<typename Iterator>
+            size_t push_batch_data(Iterator first, Iterator last) {
+                //--------------------------
+                size_t _pushed = 0UL;
+                while (first != last) {
+                    //--------------------------
+                    auto _segment = m_manager.protect(m_tail);
+                    if (!_segment) {
+                        break;
+                    }// end if (!_segment)
+                    //--------------------------
+                    size_t _position = 0UL;
+                    bool _closed     = false;
+                    const size_t _run = claim_push_run(*_segment, static_cast<size_t>(std::distance(first, last)), _position, _closed);
+                    if (_closed) {
+                        advance_tail(_segment.get());
+                        continue;
+                    }// end if (_closed)
+                    if (_run == 0UL) {
+                        break;
+                    }// end if (_run == 0UL)
+                    //--------------------------
+                    for (size_t i = 0; i < _run; ++i, ++first) {
+                        wait_for(_segment->cell(_position + i), _position + i);
+                        fill(*_segment, _position + i, std::move(*first));
+                    }// end for (size_t i = 0; i < _run; ++i, ++first)
+                    _pushed += _run;
+                    //--------------------------
+                }// end while (first != last)
+                return _pushed;
+                //--------------------------
+            }// end size_t push_batch_data(Iterator first, Iterator last)
+            //--------------------------
+            size_t pop_batch_data(std::vector<T>& out, const size_t& count) {
+                //--------------------------
+                while (count) {
+                    //--------------------------
+                    auto _segment = m_manager.protect(m_head);
+                    if (!_segment) {
+                        return 0UL;
+                    }// end if (!_segment)
+                    //--------------------------
+                    size_t _position  = 0UL;
+                    const size_t _run = claim_pop_run(*_segment, count, _position);
+                    if (_run) {
+                        out.reserve(out.size() + _run);
+                        for (size_t i = 0; i < _run; ++i) {
+                            wait_for(_segment->cell(_position + i), _position + i + 1UL);
+                            out.push_back(drain(*_segment, _position + i));
+                        }// end for (size_t i = 0; i < _run; ++i)
+                        return _run;
+                    }// end if (_run)
+                    if (!advance_head(_segment.get())) {
+                        return 0UL;
+                    }// end if (!advance_head(_segment.get()))
+                    //--------------------------
+                }// end while (count)
+                return 0UL;
+                //--------------------------
+            }// end size_t pop_batch_data(std::vector<T>& out, const size_t& count)
+            //--------------------------
+            bool grow_data(const size_t& capacity) {
+                //--------------------------
+                auto _segment = m_manager.protect(m_tail);
+                if (!_segment or capacity <= _segment->capacity) {
+                    return false;
+                }// end if (!_segment or capacity <= _segment->capacity)
+                //--------------------------
+                auto* _fresh         = new Segment(capacity);
+                Segment* _expected   = nullptr;
+                if (!_segment->next.compare_exchange_strong(_expected, _fresh, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                    delete _fresh;
+                    return false;
+                }// end if (!_segment->next.compare_exchange_strong(...))
+                //--------------------------
+                // From here no position can be claimed in the old segment.
+                _segment->enqueue.fetch_or(C_CLOSED, std::memory_order_acq_rel);
+                advance_tail(_segment.get());
+                return true;
+                //--------------------------
+            }// end bool grow_data(const size_t& capacity)
+            //--------------------------
+            void advance_tail(Segment* segment) {
+                //--------------------------
+                Segment* _expected = segment;
+                m_tail.compare_exchange_strong(_expected, segment->next.load(std::memory_order_acquire), std::memory_order_acq_rel, std::memory_order_relaxed);
+                //--------------------------
+            }// end void advance_tail(Segment* segment)
+            //--------------------------
+            // Moves the head past segment once it is closed and drained; false if
+            // it is merely empty for now.
+            bool advance_head(Segment* segment) {
+                //--------------------------
+                const size_t _enqueue = segment->enqueue.load(std::memory_order_acquire);
+                if (!(_enqueue & C_CLOSED) or segment->dequeue.load(std::memory_order_acquire) != (_enqueue & ~C_CLOSED)) {
+                    return false;
+                }// end if (not closed and drained)
+                //--------------------------
+                // The tail must be off the segment before anyone can retire it.
+                advance_tail(segment);
+                Segment* _expected = segment;
+                if (m_head.compare_exchange_strong(_expected, segment->next.load(std::memory_order_acquire), std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                    m_manager.retire(segment);
+                }// end if (m_head.compare_exchange_strong(...))
+                return true;
+                //--------------------------
+            }// end bool advance_head(Segment* segment)
+            //--------------------------
+            static size_t capacity_size(const size_t& requested) {
+                return std::bit_ceil(std::max<size_t>(2UL, requested));
+            }// end static size_t capacity_size(const size_t& requested)
+            //--------------------------------------------------------------
+        private:
+            //--------------------------------------------------------------
+            static constexpr size_t C_CLOSED          = size_t{1} << (sizeof(size_t) * 8UL - 1UL);
+            static constexpr size_t C_DEFAULT_THREADS = 64UL;
+            //--------------------------
+            Manager& m_manager;
+            alignas(64) std::atomic<Segment*> m_head;
+            alignas(64) std::atomic<Segment*> m_tail;
+        //--------------------------------------------------------------
+    };// end class MpmcRing
+    //--------------------------------------------------------------
+}// end namespace HazardSystem
+//--------------------------------------------------------------
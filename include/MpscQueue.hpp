@@ -0,0 +1,189 @@
+#pragma once
+//--------------------------------------------------------------
+// Standard C++ library
+//--------------------------------------------------------------
+#include <cstddef>
+#include <atomic>
+#include <concepts>
+#include <vector>
+#include <thread>
+//--------------------------------------------------------------
+namespace HazardSystem {
+    //--------------------------------------------------------------
+    template<typename T>
+    class MpscQueue;
+    //--------------------------------------------------------------
+    // Intrusive link for MpscQueue. A message type publicly derives from
+    // mpsc_hook and can sit in one queue at a time. It can also derive from
+    // hazard_obj_base<T>: the two links are never in use together, so the
+    // consumer may retire a popped message without allocating.
+    //
+    //     struct Message : HazardSystem::mpsc_hook { ... };
+    //--------------------------------------------------------------
+    class mpsc_hook {
+        //--------------------------------------------------------------
+        protected:
+            //--------------------------------------------------------------
+            mpsc_hook(void) noexcept : m_mpsc_next(nullptr) {
+                //--------------------------
+            }// end mpsc_hook(void)
+            //--------------------------
+            // Copies are fresh objects; they are never linked into a queue.
+            mpsc_hook(const mpsc_hook&) noexcept : mpsc_hook() {
+                //--------------------------
+            }// end mpsc_hook(const mpsc_hook&)
+            //--------------------------
+            mpsc_hook& operator=(const mpsc_hook&) noexcept {
+                return *this;
+            }// end mpsc_hook& operator=(const mpsc_hook&)
+            //--------------------------
+            ~mpsc_hook(void) = default;
+            //--------------------------------------------------------------
+        private:
+            //--------------------------------------------------------------
+            template<typename T>
+            friend class MpscQueue;
+            //--------------------------
+            std::atomic<mpsc_hook*> m_mpsc_next;
+        //--------------------------------------------------------------
+    };// end class mpsc_hook
+    //--------------------------------------------------------------
+    // Intrusive many-producer, single-consumer queue (Vyukov). push() is one
+    // exchange on the tail plus one store, and never waits. Only the consumer
+    // thread reads the list, and a message leaves the queue only after the
+    // producer after it has finished linking. So the consumer owns a popped
+    // message outright: it needs no hazard protection, and it may reuse the
+    // message, delete it, or retire it through HazardPointerManager<T> if
+    // other readers can still hold it.
+    //
+    // The queue never owns messages; whatever is still queued when it is
+    // destroyed is the caller's to drain first.
+    //--------------------------------------------------------------
+    template<typename T>
+    class MpscQueue {
+        //--------------------------------------------------------------
+        static_assert(std::derived_from<T, mpsc_hook>, "MpscQueue requires T to derive from mpsc_hook");
+        //--------------------------------------------------------------
+        public:
+            //--------------------------------------------------------------
+            MpscQueue(void) :   m_head(&m_stub),
+                                m_tail(&m_stub),
+                                m_stub() {
+                //--------------------------
+            }// end MpscQueue(void)
+            //--------------------------
+            MpscQueue(const MpscQueue&)             = delete;
+            MpscQueue& operator=(const MpscQueue&)  = delete;
+            MpscQueue(MpscQueue&&)                  = delete;
+            MpscQueue& operator=(MpscQueue&&)       = delete;
+            //--------------------------
+            ~MpscQueue(void) = default;
+            //--------------------------
+            // Any thread. message must not already be queued.
+            void push(T* message) {
+                push_data(static_cast<mpsc_hook*>(message));
+            }// end void push(T* message)
+            //--------------------------
+            // Consumer only. nullptr when empty, or when the next producer has
+            // swung the tail but not yet linked its message; try again later.
+            T* pop(void) {
+                return static_cast<T*>(pop_data());
+            }// end T* pop(void)
+            //--------------------------
+            // Consumer only. Waits out an in-flight push instead of returning
+            // early, so nullptr means nothing was queued.
+            T* pop_wait(void) {
+                //--------------------------
+                while (true) {
+                    mpsc_hook* _message = pop_data();
+                    if (_message or empty()) {
+                        return static_cast<T*>(_message);
+                    }// end if (_message or empty())
+                    std::this_thread::yield();
+                }// end while (true)
+                //--------------------------
+            }// end T* pop_wait(void)
+            //--------------------------
+            // Consumer only. Appends up to count messages in push order; returns how many.
+            size_t pop_batch(std::vector<T*>& out, const size_t& count) {
+                //--------------------------
+                size_t _taken = 0UL;
+                for (; _taken < count; ++_taken) {
+                    mpsc_hook* _message = pop_data();
+                    if (!_message) {
+                        break;
+                    }// end if (!_message)
+                    out.push_back(static_cast<T*>(_message));
+                }// end for (; _taken < count; ++_taken)
+                return _taken;
+                //--------------------------
+            }// end size_t pop_batch(std::vector<T*>& out, const size_t& count)
+            //--------------------------
+            // Consumer only; a racing push may make it stale at once.
+            bool empty(void) const {
+                return m_head == &m_stub and m_tail.load(std::memory_order_acquire) == &m_stub;
+            }// end bool empty(void) const
+            //--------------------------------------------------------------
+        protected:
+            //--------------------------------------------------------------
+            void push_data(mpsc_hook* node) {
+                //--------------------------
+                node->m_mpsc_next.store(nullptr, std::memory_order_relaxed);
+                mpsc_hook* _previous = m_tail.exchange(node, std::memory_order_acq_rel);
+                // Between these two lines the consumer sees a gap and waits for it.
+                _previous->m_mpsc_next.store(node, std::memory_order_release);
+                //--------------------------
+            }// end void push_data(mpsc_hook* node)
+            //--------------------------
+            mpsc_hook* pop_data(void) {
+                //--------------------------
+                mpsc_hook* _head = m_head;
+                mpsc_hook* _next = _head->m_mpsc_next.load(std::memory_order_acquire);
+                //--------------------------
+                if (_head == &m_stub) {
+                    if (!_next) {
+                        return nullptr;
+                    }// end if (!_next)
+                    m_head = _next;
+                    _head  = _next;
+                    _next  = _next->m_mpsc_next.load(std::memory_order_acquire);
+                }// end if (_head == &m_stub)
+                //--------------------------
+                if (_next) {
+                    m_head = _next;
+                    return _head;
+                }// end if (_next)
+                //--------------------------
+                // _head looks like the last message. If a producer is mid-push it
+                // is not, and its link will appear shortly.
+                if (_head != m_tail.load(std::memory_order_acquire)) {
+                    return nullptr;
+                }// end if (_head != m_tail.load(std::memory_order_acquire))
+                //--------------------------
+                // Requeue the stub behind the last message so it can leave too.
+                push_data(&m_stub);
+                _next = _head->m_mpsc_next.load(std::memory_order_acquire);
+                if (_next) {
+                    m_head = _next;
+                    return _head;
+                }// end if (_next)
+                //--------------------------
+                return nullptr;
+                //--------------------------
+            }// end mpsc_hook* pop_data(void)
+            //--------------------------------------------------------------
+        private:
+            //--------------------------------------------------------------
+            class Stub : public mpsc_hook {
+            };// end class Stub
+            //--------------------------
+            // Consumer side.
+            alignas(64) mpsc_hook* m_head;
+            // Producer side.
+            alignas(64) std::atomic<mpsc_hook*> m_tail;
+            Stub m_stub;
+        //--------------------------------------------------------------
+    };// end class MpscQueue
+    //--------------------------------------------------------------
+}// end namespace HazardSystem
+//--------------------------------------------------------------
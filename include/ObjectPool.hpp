@@ -0,0 +1,438 @@
+#pragma once
+//--------------------------------------------------------------
+// Standard C++ library
+//--------------------------------------------------------------
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <array>
+#include <bit>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <utility>
+#include <vector>
+#include <algorithm>
+//--------------------------------------------------------------
+// User Defined Headers
+//--------------------------------------------------------------
+#include "MemoryPolicy.hpp"
+//--------------------------------------------------------------
+namespace HazardSystem {
+    //--------------------------------------------------------------
+    // Fixed-size pool for T, built as a std::pmr::memory_resource. Blocks of
+    // T-sized slots are carved from an upstream resource and never returned
+    // to it before the pool dies.
+    //
+    // Each thread caches two magazines of up to MAGAZINE free slots (Bonwick's
+    // magazine layer), so allocate()/deallocate() are an array pop/push with
+    // no atomics. A thread that runs out, or fills both, trades a whole
+    // magazine with a depot. Depots are lock-free stacks, one per NUMA node
+    // by default. A thread uses the depot of the node it first ran on, and
+    // steals full magazines from other nodes before carving new slots. The
+    // stack heads carry a 22-bit tag next to the pointer, so a magazine
+    // popped and pushed back during a CAS cannot be mistaken for the old top
+    // (ABA). When a thread exits, its magazines go back to the depot.
+    //
+    // Because the pool is a memory_resource, HazardPointerManager<T>::retire(
+    // node, &pool) sends reclaimed nodes straight back into the reclaiming
+    // thread's magazine. Objects still live when the pool is destroyed are
+    // not destructed; their storage is simply released.
+    //--------------------------------------------------------------
+    template<typename T, size_t MAGAZINE = 64UL>
+    class ObjectPool : public std::pmr::memory_resource {
+        //--------------------------------------------------------------
+        static_assert(MAGAZINE > 0UL, "ObjectPool needs at least one slot per magazine");
+        static_assert(sizeof(void*) == 8UL, "ObjectPool tags depot pointers and needs 64-bit pointers");
+        //--------------------------------------------------------------
+        public:
+            //--------------------------------------------------------------
+            // depots == 0 means one per online NUMA node.
+            explicit ObjectPool(const size_t& depots = 0UL,
+                                std::pmr::memory_resource* upstream = std::pmr::new_delete_resource()) :   m_id(next_id()),
+                                                                                                            m_core(std::make_shared<Core>(depots ? depots : default_depots(), upstream)),
+                                                                                                            m_upstream(upstream) {
+                //--------------------------
+            }// end explicit ObjectPool(const size_t& depots, std::pmr::memory_resource* upstream)
+            //--------------------------
+            ObjectPool(const ObjectPool&)               = delete;
+            ObjectPool& operator=(const ObjectPool&)    = delete;
+            ObjectPool(ObjectPool&&)                    = delete;
+            ObjectPool& operator=(ObjectPool&&)         = delete;
+            //--------------------------
+            ~ObjectPool(void) override = default;
+            //--------------------------
+            // Uninitialised storage for one T.
+            T* allocate(void) {
+                return static_cast<T*>(allocate_data());
+            }// end T* allocate(void)
+            //--------------------------
+            // Storage from allocate() on any thread of this pool, already destroyed.
+            void deallocate(T* ptr) {
+                deallocate_data(ptr);
+            }// end void deallocate(T* ptr)
+            //--------------------------
+            template<typename... Args>
+            T* create(Args&&... args) {
+                //--------------------------
+                void* _slot = allocate_data();
+                try {
+                    return ::new (_slot) T(std::forward<Args>(args)...);
+                } catch (...) {
+                    deallocate_data(_slot);
+                    throw;
+                }// end try
+                //--------------------------
+            }// end T* create(Args&&... args)
+            //--------------------------
+            void destroy(T* ptr) {
+                //--------------------------
+                if (!ptr) {
+                    return;
+                }// end if (!ptr)
+                std::destroy_at(ptr);
+                deallocate_data(ptr);
+                //--------------------------
+            }// end void destroy(T* ptr)
+            //--------------------------
+            // Slots carved from upstream so far, free or in use.
+            size_t capacity(void) const {
+                return m_core->capacity.load(std::memory_order_relaxed);
+            }// end size_t capacity(void) const
+            //--------------------------
+            size_t depots(void) const {
+                return m_core->depot_count;
+            }// end size_t depots(void) const
+            //--------------------------------------------------------------
+        protected:
+            //--------------------------------------------------------------
+            static constexpr size_t C_SLOT_ALIGN = std::max(alignof(T), alignof(void*));
+            static constexpr size_t C_SLOT_SIZE  = (std::max(sizeof(T), sizeof(void*)) + C_SLOT_ALIGN - 1UL) & ~(C_SLOT_ALIGN - 1UL);
+            //--------------------------
+            struct alignas(64) Magazine {
+                size_t count{0UL};
+                std::atomic<Magazine*> next{nullptr};
+                Magazine* owned{nullptr};
+                std::array<void*, MAGAZINE> slots{};
+            };// end struct Magazine
+            //--------------------------
+            struct Chunk {
+                Chunk* next;
+            };// end struct Chunk
+            //--------------------------
+            // Treiber stack of magazines. Magazines are only freed with the pool, so
+            // reading next from a stale top is safe; the tag catches the ABA case.
+            class MagazineStack {
+                public:
+                    //--------------------------
+                    void push(Magazine* magazine) {
+                        //--------------------------
+                        uint64_t _top = m_top.load(std::memory_order_relaxed);
+                        do {
+                            magazine->next.store(unpack(_top), std::memory_order_relaxed);
+                        } while (!m_top.compare_exchange_weak(_top, pack(magazine, _top), std::memory_order_release, std::memory_order_relaxed));
+                        //--------------------------
+                    }// end void push(Magazine* magazine)
+                    //--------------------------
+                    Magazine* pop(void) {
+                        //--------------------------
+                        uint64_t _top = m_top.load(std::memory_order_acquire);
+                        while (Magazine* _magazine = unpack(_top)) {
+                            if (m_top.compare_exchange_weak(_top, pack(_magazine->next.load(std::memory_order_relaxed), _top), std::memory_order_acquire, std::memory_order_acquire)) {
+                                return _magazine;
+                            }// end if (m_top.compare_exchange_weak(...))
+                        }// end while (Magazine* _magazine = unpack(_top))
+                        return nullptr;
+                        //--------------------------
+                    }// end Magazine* pop(void)
+                    //--------------------------
+                private:
+                    //--------------------------
+                    // Magazines are 64-byte aligned in a 48-bit address space: 42 bits
+                    // of pointer, 22 of tag.
+                    static constexpr uint64_t C_POINTER_BITS = 42ULL;
+                    static constexpr uint64_t C_POINTER_MASK = (1ULL << C_POINTER_BITS) - 1ULL;
+                    //--------------------------
+                    static uint64_t pack(Magazine* magazine, const uint64_t& previous) {
+                        const uint64_t _tag = (previous >> C_POINTER_BITS) + 1ULL;
+                        return (reinterpret_cast<uint64_t>(magazine) >> 6) | (_tag << C_POINTER_BITS);
+                    }// end static uint64_t pack(Magazine* magazine, const uint64_t& previous)
+                    //--------------------------
+                    static Magazine* unpack(const uint64_t& value) {
+                        return reinterpret_cast<Magazine*>((value & C_POINTER_MASK) << 6);
+                    }// end static Magazine* unpack(const uint64_t& value)
+                    //--------------------------
+                    std::atomic<uint64_t> m_top{0ULL};
+                    //--------------------------
+            };// end class MagazineStack
+            //--------------------------
+            struct alignas(64) Depot {
+                MagazineStack full;
+                alignas(64) MagazineStack empty;
+            };// end struct Depot
+            //--------------------------
+            // Everything the slots live in. Shared with the thread caches so a
+            // thread exiting after the pool is gone can tell.
+            struct Core {
+                //--------------------------
+                Core(const size_t& depots_, std::pmr::memory_resource* upstream_) : depot_count(depots_),
+                                                                                    depots(std::make_unique<Depot[]>(depots_)),
+                                                                                    magazines(nullptr),
+                                                                                    chunks(nullptr),
+                                                                                    capacity(0UL),
+                                                                                    upstream(upstream_) {
+                    //--------------------------
+                }// end Core(const size_t& depots_, std::pmr::memory_resource* upstream_)
+                //--------------------------
+                Core(const Core&)               = delete;
+                Core& operator=(const Core&)    = delete;
+                //--------------------------
+                ~Core(void) {
+                    //--------------------------
+                    for (Magazine* _magazine = magazines.load(std::memory_order_acquire); _magazine;) {
+                        Magazine* _owned = _magazine->owned;
+                        delete _magazine;
+                        _magazine = _owned;
+                    }// end for (Magazine* _magazine = magazines.load(...); _magazine;)
+                    //--------------------------
+                    for (Chunk* _chunk = chunks.load(std::memory_order_acquire); _chunk;) {
+                        Chunk* _next = _chunk->next;
+                        upstream->deallocate(_chunk, C_CHUNK_SIZE, C_CHUNK_ALIGN);
+                        _chunk = _next;
+                    }// end for (Chunk* _chunk = chunks.load(...); _chunk;)
+                    //--------------------------
+                }// end ~Core(void)
+                //--------------------------
+                Magazine* new_magazine(void) {
+                    //--------------------------
+                    auto* _magazine = new Magazine();
+                    _magazine->owned = magazines.load(std::memory_order_relaxed);
+                    while (!magazines.compare_exchange_weak(_magazine->owned, _magazine, std::memory_order_release, std::memory_order_relaxed)) {
+                    }// end while (!magazines.compare_exchange_weak(...))
+                    return _magazine;
+                    //--------------------------
+                }// end Magazine* new_magazine(void)
+                //--------------------------
+                // Fills an empty magazine with MAGAZINE fresh slots.
+                void carve(Magazine* magazine) {
+                    //--------------------------
+                    auto* _chunk = static_cast<Chunk*>(upstream->allocate(C_CHUNK_SIZE, C_CHUNK_ALIGN));
+                    _chunk->next = chunks.load(std::memory_order_relaxed);
+                    while (!chunks.compare_exchange_weak(_chunk->next, _chunk, std::memory_order_release, std::memory_order_relaxed)) {
+                    }// end while (!chunks.compare_exchange_weak(...))
+                    //--------------------------
+                    std::byte* _slots = reinterpret_cast<std::byte*>(_chunk) + C_HEADER_SIZE;
+                    for (size_t i = MAGAZINE; i-- > 0UL;) {
+                        magazine->slots[magazine->count++] = _slots + i * C_SLOT_SIZE;
+                    }// end for (size_t i = MAGAZINE; i-- > 0UL;)
+                    capacity.fetch_add(MAGAZINE, std::memory_order_relaxed);
+                    //--------------------------
+                }// end void carve(Magazine* magazine)
+                //--------------------------
+                // Home depot first; another node's free slots beat carving new ones.
+                Magazine* take_full(const size_t& depot) {
+                    //--------------------------
+                    for (size_t i = 0; i < depot_count; ++i) {
+                        if (Magazine* _magazine = depots[(depot + i) % depot_count].full.pop()) {
+                            return _magazine;
+                        }// end if (Magazine* _magazine = ...)
+                    }// end for (size_t i = 0; i < depot_count; ++i)
+                    return nullptr;
+                    //--------------------------
+                }// end Magazine* take_full(const size_t& depot)
+                //--------------------------
+                Magazine* take_empty(const size_t& depot) {
+                    //--------------------------
+                    if (Magazine* _magazine = depots[depot].empty.pop()) {
+                        return _magazine;
+                    }// end if (Magazine* _magazine = depots[depot].empty.pop())
+                    return new_magazine();
+                    //--------------------------
+                }// end Magazine* take_empty(const size_t& depot)
+                //--------------------------
+                void give(const size_t& depot, Magazine* magazine) {
+                    //--------------------------
+                    if (magazine->count > 0UL) {
+                        depots[depot].full.push(magazine);
+                    } else {
+                        depots[depot].empty.push(magazine);
+                    }// end if (magazine->count > 0UL)
+                    //--------------------------
+                }// end void give(const size_t& depot, Magazine* magazine)
+                //--------------------------
+                const size_t depot_count;
+                std::unique_ptr<Depot[]> depots;
+                std::atomic<Magazine*> magazines;
+                std::atomic<Chunk*> chunks;
+                std::atomic<size_t> capacity;
+                std::pmr::memory_resource* upstream;
+                //--------------------------
+            };// end struct Core
+            //--------------------------
+            struct Cache {
+                Magazine* loaded;
+                Magazine* previous;
+                size_t depot;
+            };// end struct Cache
+            //--------------------------
+            // One per thread and T; holds that thread's cache for every live pool.
+            class ThreadCaches {
+                public:
+                    //--------------------------
+                    struct Entry {
+                        uint64_t id;
+                        std::weak_ptr<Core> core;
+                        Cache cache;
+                    };// end struct Entry
+                    //--------------------------
+                    ThreadCaches(void) = default;
+                    ThreadCaches(const ThreadCaches&)               = delete;
+                    ThreadCaches& operator=(const ThreadCaches&)    = delete;
+                    //--------------------------
+                    ~ThreadCaches(void) {
+                        //--------------------------
+                        for (auto& entry : entries) {
+                            if (auto _core = entry->core.lock()) {
+                                _core->give(entry->cache.depot, entry->cache.loaded);
+                                _core->give(entry->cache.depot, entry->cache.previous);
+                            }// end if (auto _core = entry->core.lock())
+                        }// end for (auto& entry : entries)
+                        //--------------------------
+                    }// end ~ThreadCaches(void)
+                    //--------------------------
+                    std::vector<std::unique_ptr<Entry>> entries;
+                    Entry* last{nullptr};
+                    //--------------------------
+            };// end class ThreadCaches
+            //--------------------------
+            Cache& cache(void) {
+                //--------------------------
+                static thread_local ThreadCaches tls_caches;
+                if (tls_caches.last and tls_caches.last->id == m_id) [[likely]] {
+                    return tls_caches.last->cache;
+                }// end if (tls_caches.last and tls_caches.last->id == m_id)
+                return find_cache(tls_caches);
+                //--------------------------
+            }// end Cache& cache(void)
+            //--------------------------
+            Cache& find_cache(ThreadCaches& caches) {
+                //--------------------------
+                for (auto& entry : caches.entries) {
+                    if (entry->id == m_id) {
+                        caches.last = entry.get();
+                        return entry->cache;
+                    }// end if (entry->id == m_id)
+                }// end for (auto& entry : caches.entries)
+                //--------------------------
+                // First use on this thread. Caches of pools that are gone hold nothing to return.
+                std::erase_if(caches.entries, [](const auto& entry) { return entry->core.expired(); });
+                //--------------------------
+                const int _node     = Numa::current_node();
+                const size_t _depot = _node >= 0 ? static_cast<size_t>(_node) % m_core->depot_count : 0UL;
+                caches.entries.push_back(std::make_unique<typename ThreadCaches::Entry>(typename ThreadCaches::Entry{
+                    m_id, m_core, Cache{m_core->take_empty(_depot), m_core->take_empty(_depot), _depot}}));
+                caches.last = caches.entries.back().get();
+                return caches.last->cache;
+                //--------------------------
+            }// end Cache& find_cache(ThreadCaches& caches)
+            //--------------------------
+            void* allocate_data(void) {
+                //--------------------------
+                Cache& _cache = cache();
+                if (_cache.loaded->count == 0UL) [[unlikely]] {
+                    reload(_cache);
+                }// end if (_cache.loaded->count == 0UL)
+                return _cache.loaded->slots[--_cache.loaded->count];
+                //--------------------------
+            }// end void* allocate_data(void)
+            //--------------------------
+            void deallocate_data(void* ptr) {
+                //--------------------------
+                Cache& _cache = cache();
+                if (_cache.loaded->count == MAGAZINE) [[unlikely]] {
+                    unload(_cache);
+                }// end if (_cache.loaded->count == MAGAZINE)
+                _cache.loaded->slots[_cache.loaded->count++] = ptr;
+                //--------------------------
+            }// end void deallocate_data(void* ptr)
+            //--------------------------
+            // loaded is empty: swap in previous, trade with a depot, or carve.
+            void reload(Cache& cache) {
+                //--------------------------
+                if (cache.previous->count > 0UL) {
+                    std::swap(cache.loaded, cache.previous);
+                    return;
+                }// end if (cache.previous->count > 0UL)
+                //--------------------------
+                if (Magazine* _full = m_core->take_full(cache.depot)) {
+                    m_core->give(cache.depot, cache.previous);
+                    cache.previous = cache.loaded;
+                    cache.loaded   = _full;
+                    return;
+                }// end if (Magazine* _full = m_core->take_full(cache.depot))
+                //--------------------------
+                m_core->carve(cache.loaded);
+                //--------------------------
+            }// end void reload(Cache& cache)
+            //--------------------------
+            // loaded is full: swap in previous, or hand previous to the depot.
+            void unload(Cache& cache) {
+                //--------------------------
+                if (cache.previous->count < MAGAZINE) {
+                    std::swap(cache.loaded, cache.previous);
+                    return;
+                }// end if (cache.previous->count < MAGAZINE)
+                //--------------------------
+                m_core->give(cache.depot, cache.previous);
+                cache.previous = cache.loaded;
+                cache.loaded   = m_core->take_empty(cache.depot);
+                //--------------------------
+            }// end void unload(Cache& cache)
+            //--------------------------
+            void* do_allocate(size_t bytes, size_t alignment) override {
+                //--------------------------
+                if (bytes <= C_SLOT_SIZE and alignment <= C_SLOT_ALIGN) {
+                    return allocate_data();
+                }// end if (bytes <= C_SLOT_SIZE and alignment <= C_SLOT_ALIGN)
+                return m_upstream->allocate(bytes, alignment);
+                //--------------------------
+            }// end void* do_allocate(size_t bytes, size_t alignment)
+            //--------------------------
+            void do_deallocate(void* ptr, size_t bytes, size_t alignment) override {
+                //--------------------------
+                if (bytes <= C_SLOT_SIZE and alignment <= C_SLOT_ALIGN) {
+                    deallocate_data(ptr);
+                    return;
+                }// end if (bytes <= C_SLOT_SIZE and alignment <= C_SLOT_ALIGN)
+                m_upstream->deallocate(ptr, bytes, alignment);
+                //--------------------------
+            }// end void do_deallocate(void* ptr, size_t bytes, size_t alignment)
+            //--------------------------
+            bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+                return this == &other;
+            }// end bool do_is_equal(const std::pmr::memory_resource& other) const noexcept
+            //--------------------------
+            static size_t default_depots(void) {
+                return static_cast<size_t>(std::popcount(Numa::online_nodes()));
+            }// end static size_t default_depots(void)
+            //--------------------------
+            static uint64_t next_id(void) {
+                static std::atomic<uint64_t> s_ids{1ULL};
+                return s_ids.fetch_add(1ULL, std::memory_order_relaxed);
+            }// end static uint64_t next_id(void)
+            //--------------------------------------------------------------
+        private:
+            //--------------------------------------------------------------
+            static constexpr size_t C_CHUNK_ALIGN = std::max(alignof(Chunk), C_SLOT_ALIGN);
+            static constexpr size_t C_HEADER_SIZE = (sizeof(Chunk) + C_SLOT_ALIGN - 1UL) & ~(C_SLOT_ALIGN - 1UL);
+            static constexpr size_t C_CHUNK_SIZE  = C_HEADER_SIZE + MAGAZINE * C_SLOT_SIZE;
+            //--------------------------
+            // Never reused, so a thread cache left behind by a dead pool never matches.
+            const uint64_t m_id;
+            std::shared_ptr<Core> m_core;
+            std::pmr::memory_resource* m_upstream;
+        //--------------------------------------------------------------
+    };// end class ObjectPool
+    //--------------------------------------------------------------
+}// end namespace HazardSystem
+//--------------------------------------------------------------
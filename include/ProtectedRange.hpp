@@ -0,0 +1,114 @@
+#pragma once
+//--------------------------------------------------------------
+// Standard C++ library
+//--------------------------------------------------------------
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <utility>
+//--------------------------------------------------------------
+namespace HazardSystem {
+//--------------------------------------------------------------
+    // RAII guard for a protected byte range [data(), data() + size()). Returned by
+    // HazardPointerManager::protect_range; while it is alive no retired node whose
+    // extent overlaps the range is reclaimed.
+    class ProtectedRange {
+        //--------------------------------------------------------------
+        public:
+            //--------------------------------------------------------------
+            ProtectedRange(void) :  m_begin(nullptr),
+                                    m_size(0UL),
+                                    m_release(nullptr) {
+                //--------------------------
+            }// end ProtectedRange(void)
+            //--------------------------
+            ~ProtectedRange(void) noexcept {
+                static_cast<void>(release_data());
+            }// end ~ProtectedRange(void)
+            //--------------------------
+            ProtectedRange( const std::byte* begin,
+                            const size_t& size,
+                            std::function<bool(void)>&& release) :  m_begin(begin),
+                                                                    m_size(size),
+                                                                    m_release(std::move(release)) {
+                //--------------------------
+            }// end ProtectedRange
+            //--------------------------
+            ProtectedRange(ProtectedRange&& other) noexcept :   m_begin(other.m_begin),
+                                                                m_size(other.m_size),
+                                                                m_release(std::move(other.m_release)) {
+                //--------------------------
+                other.m_begin   = nullptr;
+                other.m_size    = 0UL;
+                other.m_release = nullptr;
+                //--------------------------
+            }// end ProtectedRange(ProtectedRange&& other) noexcept
+            //--------------------------
+            ProtectedRange& operator=(ProtectedRange&& other) noexcept {
+                //--------------------------
+                if (this == &other) {
+                    return *this;
+                }// end if (this == &other)
+                //--------------------------
+                static_cast<void>(release_data());
+                //--------------------------
+                m_begin   = other.m_begin;
+                m_size    = other.m_size;
+                m_release = std::move(other.m_release);
+                //--------------------------
+                other.m_begin   = nullptr;
+                other.m_size    = 0UL;
+                other.m_release = nullptr;
+                //--------------------------
+                return *this;
+            }// end ProtectedRange& operator=(ProtectedRange&& other) noexcept
+            //--------------------------
+            ProtectedRange(const ProtectedRange&)                   = delete;
+            ProtectedRange& operator=(const ProtectedRange&)        = delete;
+            //--------------------------
+            const std::byte* data(void) const noexcept {
+                return m_begin;
+            }// end const std::byte* data(void) const noexcept
+            //--------------------------
+            size_t size(void) const noexcept {
+                return m_size;
+            }// end size_t size(void) const noexcept
+            //--------------------------
+            std::span<const std::byte> span(void) const noexcept {
+                return m_begin ? std::span<const std::byte>(m_begin, m_size) : std::span<const std::byte>();
+            }// end std::span<const std::byte> span(void) const noexcept
+            //--------------------------
+            explicit operator bool(void) const noexcept {
+                return m_begin != nullptr;
+            }// end explicit operator bool(void) const noexcept
+            //--------------------------
+            bool reset(void) noexcept {
+                return release_data();
+            }// end bool reset(void) noexcept
+            //--------------------------------------------------------------
+        protected:
+            //--------------------------------------------------------------
+            bool release_data(void) noexcept {
+                //--------------------------
+                if (!m_begin or !m_release) {
+                    return false;
+                }// end if (!m_begin or !m_release)
+                //--------------------------
+                const bool released = m_release();
+                m_begin = nullptr;
+                m_size  = 0UL;
+                //--------------------------
+                return released;
+                //--------------------------
+            }// end bool release_data(void) noexcept
+            //--------------------------------------------------------------
+        private:
+            //--------------------------------------------------------------
+            const std::byte* m_begin;
+            size_t m_size;
+            std::function<bool(void)> m_release;
+        //--------------------------------------------------------------
+    };// end class ProtectedRange
+    //--------------------------------------------------------------
+} // end namespace HazardSystem
+//--------------------------------------------------------------
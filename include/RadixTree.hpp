@@ -0,0 +1,1003 @@
+#pragma once
+//--------------------------------------------------------------
+// Standard C++ library
+//--------------------------------------------------------------
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <array>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <algorithm>
+#include <thread>
+//--------------------------------------------------------------
+// User Defined Headers
+//--------------------------------------------------------------
+#include "Backoff.hpp"
+#include "HazardPointerManager.hpp"
+#include "ProtectedPointer.hpp"
+//--------------------------------------------------------------
+namespace HazardSystem {
+    //--------------------------------------------------------------
+    // Adaptive radix tree (Leis et al.) over byte-string keys, for routing by
+    // prefix: exact find, longest-prefix match and ordered prefix scans.
+    //
+    // Inner nodes come in 4/16/48/256-child sizes and carry the whole
+    // compressed path, plus a terminal slot for a key that ends at that node.
+    // Leaves hold the full key and may sit above their full depth (lazy
+    // expansion). A node is only changed in place by appending a child or by
+    // swapping one atomic slot. Growing, shrinking and splitting a prefix
+    // build a copy, mark the old node obsolete, and retire it (and any
+    // unlinked leaf) through HazardPointerManager<Node>.
+    //
+    // Readers take no locks. They walk hand over hand: protect the child,
+    // check that the parent's slot still holds it and that the parent is not
+    // obsolete, then release the parent. So a lookup holds at most two
+    // hazards, three for longest_prefix(). A failed check restarts from the
+    // root. Writers take turns on a flag, which suits read-mostly tables
+    // (routes, metric names).
+    //
+    // Ordered reads (lower_bound, scan_prefix) keep to three as well: a scan
+    // holds the current leaf and its parent, steps through the parent's
+    // children, and searches again from the root once they run out.
+    //--------------------------------------------------------------
+    template<typename Value>
+    class RadixTree {
+        //--------------------------------------------------------------
+        public:
+            //--------------------------------------------------------------
+            // Shared base so every node kind goes through one manager; deleted
+            // through the base when reclaimed.
+            struct Node {
+                //--------------------------
+                enum class Kind : uint8_t {
+                    Leaf = 0,
+                    Node4,
+                    Node16,
+                    Node48,
+                    Node256
+                };// end enum class Kind
+                //--------------------------
+                explicit Node(const Kind& kind_) : kind(kind_) {
+                    //--------------------------
+                }// end explicit Node(const Kind& kind_)
+                //--------------------------
+                Node(const Node&)               = delete;
+                Node& operator=(const Node&)    = delete;
+                //--------------------------
+                virtual ~Node(void) = default;
+                //--------------------------
+                const Kind kind;
+                //--------------------------
+            };// end struct Node
+            //--------------------------------------------------------------
+            using Manager = HazardPointerManager<Node, 0>;
+            //--------------------------------------------------------------
+            // readers sizes the node manager shared by every tree with this
+            // Value type, on first use only; each reader needs up to three slots.
+            explicit RadixTree(const size_t& readers = C_DEFAULT_READERS) : m_manager(Manager::instance(std::max<size_t>(1UL, readers) * C_HAZARDS_PER_READER)),
+                                                                            m_root(nullptr),
+                                                                            m_size(0UL),
+                                                                            m_writing(false) {
+                //--------------------------
+            }// end explicit RadixTree(const size_t& readers)
+            //--------------------------
+            RadixTree(const RadixTree&)             = delete;
+            RadixTree& operator=(const RadixTree&)  = delete;
+            RadixTree(RadixTree&&)                  = delete;
+            RadixTree& operator=(RadixTree&&)       = delete;
+            //--------------------------
+            // No other thread may still be using the tree.
+            ~RadixTree(void) {
+                destroy(m_root.load(std::memory_order_acquire));
+            }// end ~RadixTree(void)
+            //--------------------------
+            // True if key was new, false if an existing value was replaced.
+            bool insert_or_assign(std::string_view key, Value value) {
+                return insert_data(key, std::move(value));
+            }// end bool insert_or_assign(std::string_view key, Value value)
+            //--------------------------
+            bool erase(std::string_view key) {
+                return erase_data(key);
+            }// end bool erase(std::string_view key)
+            //--------------------------
+            std::optional<Value> find(std::string_view key) const {
+                return find_data(key);
+            }// end std::optional<Value> find(std::string_view key) const
+            //--------------------------
+            bool contains(std::string_view key) const {
+                return find_data(key).has_value();
+            }// end bool contains(std::string_view key) const
+            //--------------------------
+            // The longest stored key that is a prefix of key, with its value.
+            std::optional<std::pair<std::string, Value>> longest_prefix(std::string_view key) const {
+                return longest_prefix_data(key);
+            }// end std::optional<std::pair<std::string, Value>> longest_prefix(std::string_view key) const
+            //--------------------------
+            // The smallest stored key not less than key, with its value.
+            std::optional<std::pair<std::string, Value>> lower_bound(std::string_view key) const {
+                return lower_bound_data(std::string(key));
+            }// end std::optional<std::pair<std::string, Value>> lower_bound(std::string_view key) const
+            //--------------------------
+            // Calls fn(key, value) in key order for up to limit keys starting with
+            // prefix; returns how many it visited. Keys inserted or erased during
+            // the scan may or may not be seen.
+            template<typename Fn>
+            size_t scan_prefix(std::string_view prefix, Fn&& fn, const size_t& limit = std::numeric_limits<size_t>::max()) const {
+                return scan_prefix_data(prefix, std::forward<Fn>(fn), limit);
+            }// end size_t scan_prefix(std::string_view prefix, Fn&& fn, const size_t& limit) const
+            //--------------------------
+            size_t size(void) const {
+                return m_size.load(std::memory_order_relaxed);
+            }// end size_t size(void) const
+            //--------------------------
+            bool empty(void) const {
+                return size() == 0UL;
+            }// end bool empty(void) const
+            //--------------------------------------------------------------
+        protected:
+            //--------------------------------------------------------------
+            using Kind = typename Node::Kind;
+            //--------------------------
+            struct Leaf final : Node {
+                Leaf(std::string_view key_, Value value_) : Node(Kind::Leaf),
+                                                            key(key_),
+                                                            value(std::move(value_)) {
+                    //--------------------------
+                }// end Leaf(std::string_view key_, Value value_)
+                //--------------------------
+                const std::string key;
+                const Value value;
+            };// end struct Leaf
+            //--------------------------
+            struct Inner : Node {
+                Inner(const Kind& kind_, std::string prefix_) : Node(kind_),
+                                                                prefix(std::move(prefix_)),
+                                                                terminal(nullptr),
+                                                                obsolete(false) {
+                    //--------------------------
+                }// end Inner(const Kind& kind_, std::string prefix_)
+                //--------------------------
+                const std::string prefix;
+                // Leaf whose key ends right after prefix.
+                std::atomic<Node*> terminal;
+                // Set before the node is replaced; readers that see it restart.
+                std::atomic<bool> obsolete;
+            };// end struct Inner
+            //--------------------------
+            // Node4 and Node16: unsorted, so a child is appended in place by
+            // writing its slot and then publishing the count.
+            template<size_t N, Kind K>
+            struct NodeSmall final : Inner {
+                explicit NodeSmall(std::string prefix_) : Inner(K, std::move(prefix_)) {
+                    //--------------------------
+                }// end explicit NodeSmall(std::string prefix_)
+                //--------------------------
+                std::atomic<uint8_t> count{0U};
+                std::array<std::atomic<uint8_t>, N> keys{};
+                std::array<std::atomic<Node*>, N> children{};
+            };// end struct NodeSmall
+            //--------------------------
+            using Node4  = NodeSmall<4UL, Kind::Node4>;
+            using Node16 = NodeSmall<16UL, Kind::Node16>;
+            //--------------------------
+            struct Node48 final : Inner {
+                explicit Node48(std::string prefix_) : Inner(Kind::Node48, std::move(prefix_)) {
+                    //--------------------------
+                }// end explicit Node48(std::string prefix_)
+                //--------------------------
+                // 1-based position in children; 0 means no child.
+                std::array<std::atomic<uint8_t>, 256> index{};
+                std::array<std::atomic<Node*>, 48> children{};
+                // Writer only.
+                size_t count{0UL};
+            };// end struct Node48
+            //--------------------------
+            struct Node256 final : Inner {
+                explicit Node256(std::string prefix_) : Inner(Kind::Node256, std::move(prefix_)) {
+                    //--------------------------
+                }// end explicit Node256(std::string prefix_)
+                //--------------------------
+                std::array<std::atomic<Node*>, 256> children{};
+                // Writer only.
+                size_t count{0UL};
+            };// end struct Node256
+            //--------------------------
+            enum class Step : uint8_t {
+                Found = 0,
+                Missing,
+                Restart
+            };// end enum class Step
+            //--------------------------------------------------------------
+            // Node access shared by readers and the writer
+            //--------------------------------------------------------------
+            static std::atomic<Node*>* child_slot(Inner* inner, const uint8_t& byte) {
+                //--------------------------
+                switch (inner->kind) {
+                    case Kind::Node4:
+                        return small_slot(static_cast<Node4*>(inner), byte);
+                    case Kind::Node16:
+                        return small_slot(static_cast<Node16*>(inner), byte);
+                    case Kind::Node48: {
+                        auto* _node            = static_cast<Node48*>(inner);
+                        const uint8_t _index   = _node->index[byte].load(std::memory_order_acquire);
+                        return _index ? &_node->children[_index - 1U] : nullptr;
+                    }
+                    case Kind::Node256: {
+                        auto* _node = static_cast<Node256*>(inner);
+                        return _node->children[byte].load(std::memory_order_acquire) ? &_node->children[byte] : nullptr;
+                    }
+                    default:
+                        return nullptr;
+                }// end switch (inner->kind)
+                //--------------------------
+            }// end static std::atomic<Node*>* child_slot(Inner* inner, const uint8_t& byte)
+            //--------------------------
+            template<typename Small>
+            static std::atomic<Node*>* small_slot(Small* node, const uint8_t& byte) {
+                //--------------------------
+                const uint8_t _count = node->count.load(std::memory_order_acquire);
+                for (uint8_t i = 0; i < _count; ++i) {
+                    if (node->keys[i].load(std::memory_order_relaxed) == byte) {
+                        return &node->children[i];
+                    }// end if (node->keys[i].load(std::memory_order_relaxed) == byte)
+                }// end for (uint8_t i = 0; i < _count; ++i)
+                return nullptr;
+                //--------------------------
+            }// end static std::atomic<Node*>* small_slot(Small* node, const uint8_t& byte)
+            //--------------------------
+            // The child with the smallest byte above after (-1 for the first child).
+            static std::pair<int, std::atomic<Node*>*> next_slot(Inner* inner, const int& after) {
+                //--------------------------
+                switch (inner->kind) {
+                    case Kind::Node4:
+                        return small_next(static_cast<Node4*>(inner), after);
+                    case Kind::Node16:
+                        return small_next(static_cast<Node16*>(inner), after);
+                    case Kind::Node48: {
+                        auto* _node = static_cast<Node48*>(inner);
+                        for (int b = after + 1; b < 256; ++b) {
+                            const uint8_t _index = _node->index[b].load(std::memory_order_acquire);
+                            if (_index) {
+                                return {b, &_node->children[_index - 1U]};
+                            }// end if (_index)
+                        }// end for (int b = after + 1; b < 256; ++b)
+                        return {-1, nullptr};
+                    }
+                    case Kind::Node256: {
+                        auto* _node = static_cast<Node256*>(inner);
+                        for (int b = after + 1; b < 256; ++b) {
+                            if (_node->children[b].load(std::memory_order_acquire)) {
+                                return {b, &_node->children[b]};
+                            }// end if (_node->children[b].load(std::memory_order_acquire))
+                        }// end for (int b = after + 1; b < 256; ++b)
+                        return {-1, nullptr};
+                    }
+                    default:
+                        return {-1, nullptr};
+                }// end switch (inner->kind)
+                //--------------------------
+            }// end static std::pair<int, std::atomic<Node*>*> next_slot(Inner* inner, const int& after)
+            //--------------------------
+            template<typename Small>
+            static std::pair<int, std::atomic<Node*>*> small_next(Small* node, const int& after) {
+                //--------------------------
+                std::pair<int, std::atomic<Node*>*> _best{256, nullptr};
+                const uint8_t _count = node->count.load(std::memory_order_acquire);
+                for (uint8_t i = 0; i < _count; ++i) {
+                    const int _byte = node->keys[i].load(std::memory_order_relaxed);
+                    if (_byte > after and _byte < _best.first) {
+                        _best = {_byte, &node->children[i]};
+                    }// end if (_byte > after and _byte < _best.first)
+                }// end for (uint8_t i = 0; i < _count; ++i)
+                return _best.second ? _best : std::pair<int, std::atomic<Node*>*>{-1, nullptr};
+                //--------------------------
+            }// end static std::pair<int, std::atomic<Node*>*> small_next(Small* node, const int& after)
+            //--------------------------------------------------------------
+            // Readers
+            //--------------------------------------------------------------
+            // Hand-over-hand step: protect what slot holds, then make sure owner
+            // (nullptr for the root) still links it.
+            Step protect_slot(const std::atomic<Node*>& slot, const Inner* owner, ProtectedPointer<Node>& out) const {
+                //--------------------------
+                Node* _node = slot.load(std::memory_order_acquire);
+                if (!_node) {
+                    return Step::Missing;
+                }// end if (!_node)
+                //--------------------------
+                out = m_manager.protect(_node);
+                if (!out) {
+                    std::this_thread::yield();
+                    return Step::Restart;
+                }// end if (!out)
+                //--------------------------
+                if (slot.load(std::memory_order_seq_cst) != _node or (owner and owner->obsolete.load(std::memory_order_seq_cst))) {
+                    out.reset();
+                    return Step::Restart;
+                }// end if (slot changed or owner replaced)
+                //--------------------------
+                return Step::Found;
+                //--------------------------
+            }// end Step protect_slot(const std::atomic<Node*>& slot, const Inner* owner, ProtectedPointer<Node>& out) const
+            //--------------------------
+            std::optional<Value> find_data(std::string_view key) const {
+                //--------------------------
+                while (true) {
+                    //--------------------------
+                    ProtectedPointer<Node> _node;
+                    Step _step = protect_slot(m_root, nullptr, _node);
+                    size_t _depth = 0UL;
+                    //--------------------------
+                    while (_step == Step::Found) {
+                        //--------------------------
+                        if (_node->kind == Kind::Leaf) {
+                            const auto* _leaf = static_cast<const Leaf*>(_node.get());
+                            return _leaf->key == key ? std::optional<Value>(_leaf->value) : std::nullopt;
+                        }// end if (_node->kind == Kind::Leaf)
+                        //--------------------------
+                        auto* _inner = static_cast<Inner*>(_node.get());
+                        if (key.substr(_depth, _inner->prefix.size()) != _inner->prefix) {
+                            return std::nullopt;
+                        }// end if (key.substr(_depth, _inner->prefix.size()) != _inner->prefix)
+                        _depth += _inner->prefix.size();
+                        //--------------------------
+                        ProtectedPointer<Node> _child;
+                        if (_depth == key.size()) {
+                            _step = protect_slot(_inner->terminal, _inner, _child);
+                        } else {
+                            std::atomic<Node*>* _slot = child_slot(_inner, static_cast<uint8_t>(key[_depth++]));
+                            _step = _slot ? protect_slot(*_slot, _inner, _child) : Step::Missing;
+                        }// end if (_depth == key.size())
+                        _node = std::move(_child);
+                        //--------------------------
+                    }// end while (_step == Step::Found)
+                    //--------------------------
+                    if (_step == Step::Missing) {
+                        return std::nullopt;
+                    }// end if (_step == Step::Missing)
+                    //--------------------------
+                }// end while (true)
+                //--------------------------
+            }// end std::optional<Value> find_data(std::string_view key) const
+            //--------------------------
+            std::optional<std::pair<std::string, Value>> longest_prefix_data(std::string_view key) const {
+                //--------------------------
+                while (true) {
+                    //--------------------------
+                    // The third hazard: the best match so far stays protected.
+                    ProtectedPointer<Node> _best;
+                    ProtectedPointer<Node> _node;
+                    Step _step    = protect_slot(m_root, nullptr, _node);
+                    size_t _depth = 0UL;
+                    //--------------------------
+                    while (_step == Step::Found) {
+                        //--------------------------
+                        if (_node->kind == Kind::Leaf) {
+                            if (key.starts_with(static_cast<const Leaf*>(_node.get())->key)) {
+                                _best = std::move(_node);
+                            }// end if (key.starts_with(...))
+                            _step = Step::Missing;
+                            break;
+                        }// end if (_node->kind == Kind::Leaf)
+                        //--------------------------
+                        auto* _inner = static_cast<Inner*>(_node.get());
+                        if (key.substr(_depth, _inner->prefix.size()) != _inner->prefix) {
+                            _step = Step::Missing;
+                            break;
+                        }// end if (key.substr(_depth, _inner->prefix.size()) != _inner->prefix)
+                        _depth += _inner->prefix.size();
+                        //--------------------------
+                        ProtectedPointer<Node> _terminal;
+                        _step = protect_slot(_inner->terminal, _inner, _terminal);
+                        if (_step == Step::Restart) {
+                            break;
+                        }// end if (_step == Step::Restart)
+                        if (_step == Step::Found) {
+                            _best = std::move(_terminal);
+                        }// end if (_step == Step::Found)
+                        //--------------------------
+                        std::atomic<Node*>* _slot = _depth < key.size() ? child_slot(_inner, static_cast<uint8_t>(key[_depth])) : nullptr;
+                        if (!_slot) {
+                            _step = Step::Missing;
+                            break;
+                        }// end if (!_slot)
+                        ++_depth;
+                        //--------------------------
+                        ProtectedPointer<Node> _child;
+                        _step = protect_slot(*_slot, _inner, _child);
+                        _node = std::move(_child);
+                        //--------------------------
+                    }// end while (_step == Step::Found)
+                    //--------------------------
+                    if (_step != Step::Restart) {
+                        if (!_best) {
+                            return std::nullopt;
+                        }// end if (!_best)
+                        const auto* _leaf = static_cast<const Leaf*>(_best.get());
+                        return std::optional<std::pair<std::string, Value>>(std::in_place, _leaf->key, _leaf->value);
+                    }// end if (_step != Step::Restart)
+                    //--------------------------
+                }// end while (true)
+                //--------------------------
+            }// end std::optional<std::pair<std::string, Value>> longest_prefix_data(std::string_view key) const
+            //--------------------------
+            // Where an ordered walk stands: a protected node, the protected inner
+            // node above it (empty at the root), and the byte between them (-1 for
+            // a terminal). Never more than these two plus one being acquired.
+            struct Cursor {
+                ProtectedPointer<Node> parent;
+                ProtectedPointer<Node> node;
+                int byte{-1};
+            };// end struct Cursor
+            //--------------------------
+            // Moves the cursor down through slot of cursor.node.
+            Step descend(Cursor& cursor, const std::atomic<Node*>& slot, const int& byte) const {
+                //--------------------------
+                ProtectedPointer<Node> _child;
+                const Step _step = protect_slot(slot, static_cast<const Inner*>(cursor.node.get()), _child);
+                if (_step == Step::Found) {
+                    cursor.parent = std::move(cursor.node);
+                    cursor.node   = std::move(_child);
+                    cursor.byte   = byte;
+                }// end if (_step == Step::Found)
+                return _step;
+                //--------------------------
+            }// end Step descend(Cursor& cursor, const std::atomic<Node*>& slot, const int& byte) const
+            //--------------------------
+            // Smallest key in the subtree at cursor.node: a terminal beats every child.
+            Step min_leaf(Cursor& cursor) const {
+                //--------------------------
+                while (cursor.node->kind != Kind::Leaf) {
+                    //--------------------------
+                    auto* _inner = static_cast<Inner*>(cursor.node.get());
+                    Step _step   = descend(cursor, _inner->terminal, -1);
+                    if (_step == Step::Missing) {
+                        const auto _next = next_slot(_inner, -1);
+                        // Only an obsolete node can have been emptied.
+                        _step = _next.second ? descend(cursor, *_next.second, _next.first) : Step::Restart;
+                    }// end if (_step == Step::Missing)
+                    if (_step != Step::Found) {
+                        return Step::Restart;
+                    }// end if (_step != Step::Found)
+                    //--------------------------
+                }// end while (cursor.node->kind != Kind::Leaf)
+                //--------------------------
+                return Step::Found;
+                //--------------------------
+            }// end Step min_leaf(Cursor& cursor) const
+            //--------------------------
+            // Successor of the leaf at the cursor, as long as it lies under the same
+            // parent; Missing sends the caller back to the root.
+            Step advance(Cursor& cursor) const {
+                //--------------------------
+                if (!cursor.parent) {
+                    return Step::Missing;
+                }// end if (!cursor.parent)
+                //--------------------------
+                auto* _parent    = static_cast<Inner*>(cursor.parent.get());
+                const auto _next = next_slot(_parent, cursor.byte);
+                if (!_next.second) {
+                    return Step::Missing;
+                }// end if (!_next.second)
+                //--------------------------
+                ProtectedPointer<Node> _child;
+                const Step _step = protect_slot(*_next.second, _parent, _child);
+                if (_step != Step::Found) {
+                    return Step::Restart;
+                }// end if (_step != Step::Found)
+                cursor.node = std::move(_child);
+                cursor.byte = _next.first;
+                return min_leaf(cursor);
+                //--------------------------
+            }// end Step advance(Cursor& cursor) const
+            //--------------------------
+            // Leaves cursor on the smallest leaf not less than target. Follows target
+            // down; the deepest branch with a larger byte is kept as a key to restart
+            // from if target's own path runs out below it.
+            Step lower_bound_data(std::string target, Cursor& cursor) const {
+                //--------------------------
+                while (true) {
+                    //--------------------------
+                    std::optional<std::string> _fallback;
+                    cursor        = Cursor{};
+                    Step _step    = protect_slot(m_root, nullptr, cursor.node);
+                    size_t _depth = 0UL;
+                    bool _subtree = false;
+                    //--------------------------
+                    while (_step == Step::Found) {
+                        //--------------------------
+                        if (cursor.node->kind == Kind::Leaf) {
+                            if (static_cast<const Leaf*>(cursor.node.get())->key < target) {
+                                _step = Step::Missing;
+                            }// end if (... < target)
+                            break;
+                        }// end if (cursor.node->kind == Kind::Leaf)
+                        //--------------------------
+                        auto* _inner                 = static_cast<Inner*>(cursor.node.get());
+                        const std::string_view _rest = std::string_view(target).substr(_depth);
+                        const int _order             = _rest.substr(0, _inner->prefix.size()).compare(_inner->prefix);
+                        if (_order < 0 or (_order == 0 and _rest.size() == _inner->prefix.size())) {
+                            // Every key below is larger, or target ends here and the terminal comes first.
+                            _subtree = true;
+                            break;
+                        }// end if (_order < 0 or ...)
+                        if (_order > 0) {
+                            _step = Step::Missing;
+                            break;
+                        }// end if (_order > 0)
+                        _depth += _inner->prefix.size();
+                        //--------------------------
+                        const auto _byte = static_cast<uint8_t>(target[_depth]);
+                        const auto _next = next_slot(_inner, _byte);
+                        if (_next.second) {
+                            _fallback = target.substr(0, _depth) + static_cast<char>(_next.first);
+                        }// end if (_next.second)
+                        //--------------------------
+                        std::atomic<Node*>* _slot = child_slot(_inner, _byte);
+                        if (!_slot) {
+                            _step = Step::Missing;
+                            break;
+                        }// end if (!_slot)
+                        ++_depth;
+                        _step = descend(cursor, *_slot, _byte);
+                        //--------------------------
+                    }// end while (_step == Step::Found)
+                    //--------------------------
+                    if (_subtree) {
+                        _step = min_leaf(cursor);
+                    }// end if (_subtree)
+                    if (_step == Step::Found) {
+                        return Step::Found;
+                    }// end if (_step == Step::Found)
+                    if (_step == Step::Missing) {
+                        if (!_fallback) {
+                            cursor = Cursor{};
+                            return Step::Missing;
+                        }// end if (!_fallback)
+                        // Nothing stored lies between target and the fallback branch.
+                        target = std::move(*_fallback);
+                    }// end if (_step == Step::Missing)
+                    //--------------------------
+                }// end while (true)
+                //--------------------------
+            }// end Step lower_bound_data(std::string target, Cursor& cursor) const
+            //--------------------------
+            std::optional<std::pair<std::string, Value>> lower_bound_data(std::string target) const {
+                //--------------------------
+                Cursor _cursor;
+                if (lower_bound_data(std::move(target), _cursor) != Step::Found) {
+                    return std::nullopt;
+                }// end if (lower_bound_data(std::move(target), _cursor) != Step::Found)
+                const auto* _leaf = static_cast<const Leaf*>(_cursor.node.get());
+                return std::optional<std::pair<std::string, Value>>(std::in_place, _leaf->key, _leaf->value);
+                //--------------------------
+            }// end std::optional<std::pair<std::string, Value>> lower_bound_data(std::string target) const
+            //--------------------------
+            // Steps through siblings under the leaf's parent and goes back to the
+            // root (with the last key as a strict bound) only when they run out.
+            template<typename Fn>
+            size_t scan_prefix_data(std::string_view prefix, Fn&& fn, const size_t& limit) const {
+                //--------------------------
+                size_t _visited = 0UL;
+                std::string _bound(prefix);
+                Cursor _cursor;
+                Step _step = lower_bound_data(_bound, _cursor);
+                //--------------------------
+                while (_step == Step::Found and _visited < limit) {
+                    //--------------------------
+                    const auto* _leaf = static_cast<const Leaf*>(_cursor.node.get());
+                    if (!std::string_view(_leaf->key).starts_with(prefix)) {
+                        break;
+                    }// end if (!std::string_view(_leaf->key).starts_with(prefix))
+                    fn(_leaf->key, _leaf->value);
+                    ++_visited;
+                    //--------------------------
+                    // The smallest string above a key is the key followed by a zero byte.
+                    _bound.assign(_leaf->key);
+                    _bound.push_back('\0');
+                    _step = advance(_cursor);
+                    if (_step != Step::Found) {
+                        _step = lower_bound_data(_bound, _cursor);
+                    }// end if (_step != Step::Found)
+                    //--------------------------
+                }// end while (_step == Step::Found and _visited < limit)
+                return _visited;
+                //--------------------------
+            }// end size_t scan_prefix_data(std::string_view prefix, Fn&& fn, const size_t& limit) const
+            //--------------------------------------------------------------
+            // Writer (holds m_writing)
+            //--------------------------------------------------------------
+            class WriteGuard {
+                public:
+                    //--------------------------
+                    explicit WriteGuard(std::atomic<bool>& flag) : m_flag(flag) {
+                        //--------------------------
+                        Backoff _backoff;
+                        while (m_flag.exchange(true, std::memory_order_acquire)) {
+                            _backoff.wait_while(m_flag, true, std::memory_order_relaxed);
+                        }// end while (m_flag.exchange(true, std::memory_order_acquire))
+                        //--------------------------
+                    }// end explicit WriteGuard(std::atomic<bool>& flag)
+                    //--------------------------
+                    WriteGuard(const WriteGuard&)               = delete;
+                    WriteGuard& operator=(const WriteGuard&)    = delete;
+                    //--------------------------
+                    ~WriteGuard(void) {
+                        m_flag.store(false, std::memory_order_release);
+                        m_flag.notify_one();
+                    }// end ~WriteGuard(void)
+                    //--------------------------
+                private:
+                    //--------------------------
+                    std::atomic<bool>& m_flag;
+                    //--------------------------
+            };// end class WriteGuard
+            //--------------------------
+            // An inner node on the writer's path and the slot that links it.
+            struct PathEntry {
+                std::atomic<Node*>* slot;
+                Inner* inner;
+                uint8_t byte;
+            };// end struct PathEntry
+            //--------------------------
+            bool insert_data(std::string_view key, Value&& value) {
+                //--------------------------
+                WriteGuard _guard(m_writing);
+                std::atomic<Node*>* _slot = &m_root;
+                size_t _depth             = 0UL;
+                //--------------------------
+                while (true) {
+                    //--------------------------
+                    Node* _node = _slot->load(std::memory_order_relaxed);
+                    if (!_node) {
+                        _slot->store(new Leaf(key, std::move(value)), std::memory_order_release);
+                        m_size.fetch_add(1UL, std::memory_order_relaxed);
+                        return true;
+                    }// end if (!_node)
+                    //--------------------------
+                    if (_node->kind == Kind::Leaf) {
+                        auto* _leaf = static_cast<Leaf*>(_node);
+                        if (_leaf->key == key) {
+                            _slot->store(new Leaf(key, std::move(value)), std::memory_order_seq_cst);
+                            m_manager.retire(_leaf);
+                            return false;
+                        }// end if (_leaf->key == key)
+                        //--------------------------
+                        // Two keys share this slot: split them under a Node4 holding their common part.
+                        const size_t _common = common_prefix(std::string_view(_leaf->key).substr(_depth), key.substr(_depth));
+                        auto* _split         = new Node4(std::string(key.substr(_depth, _common)));
+                        place(_split, _leaf, _leaf->key, _depth + _common);
+                        place(_split, new Leaf(key, std::move(value)), key, _depth + _common);
+                        _slot->store(_split, std::memory_order_release);
+                        m_size.fetch_add(1UL, std::memory_order_relaxed);
+                        return true;
+                    }// end if (_node->kind == Kind::Leaf)
+                    //--------------------------
+                    auto* _inner         = static_cast<Inner*>(_node);
+                    const size_t _common = common_prefix(_inner->prefix, key.substr(_depth));
+                    if (_common < _inner->prefix.size()) {
+                        //--------------------------
+                        // key leaves the compressed path part way: the node keeps the tail.
+                        auto* _split  = new Node4(_inner->prefix.substr(0, _common));
+                        Inner* _tail  = copy_inner(_inner, _inner->prefix.substr(_common + 1UL), child_count(_inner), -1);
+                        append(_split, static_cast<uint8_t>(_inner->prefix[_common]), _tail);
+                        place(_split, new Leaf(key, std::move(value)), key, _depth + _common);
+                        replace(*_slot, _inner, _split);
+                        m_size.fetch_add(1UL, std::memory_order_relaxed);
+                        return true;
+                        //--------------------------
+                    }// end if (_common < _inner->prefix.size())
+                    _depth += _common;
+                    //--------------------------
+                    if (_depth == key.size()) {
+                        Node* _old = _inner->terminal.exchange(new Leaf(key, std::move(value)), std::memory_order_seq_cst);
+                        if (_old) {
+                            m_manager.retire(_old);
+                            return false;
+                        }// end if (_old)
+                        m_size.fetch_add(1UL, std::memory_order_relaxed);
+                        return true;
+                    }// end if (_depth == key.size())
+                    //--------------------------
+                    const auto _byte          = static_cast<uint8_t>(key[_depth]);
+                    std::atomic<Node*>* _next = child_slot(_inner, _byte);
+                    if (_next) {
+                        _slot = _next;
+                        ++_depth;
+                        continue;
+                    }// end if (_next)
+                    //--------------------------
+                    auto* _leaf = new Leaf(key, std::move(value));
+                    if (!append(_inner, _byte, _leaf)) {
+                        Inner* _grown = copy_inner(_inner, _inner->prefix, child_count(_inner) + 1UL, -1);
+                        append(_grown, _byte, _leaf);
+                        replace(*_slot, _inner, _grown);
+                    }// end if (!append(_inner, _byte, _leaf))
+                    m_size.fetch_add(1UL, std::memory_order_relaxed);
+                    return true;
+                    //--------------------------
+                }// end while (true)
+                //--------------------------
+            }// end bool insert_data(std::string_view key, Value&& value)
+            //--------------------------
+            bool erase_data(std::string_view key) {
+                //--------------------------
+                WriteGuard _guard(m_writing);
+                std::vector<PathEntry> _path;
+                std::atomic<Node*>* _slot = &m_root;
+                size_t _depth             = 0UL;
+                //--------------------------
+                while (true) {
+                    //--------------------------
+                    Node* _node = _slot->load(std::memory_order_relaxed);
+                    if (!_node) {
+                        return false;
+                    }// end if (!_node)
+                    //--------------------------
+                    if (_node->kind == Kind::Leaf) {
+                        if (static_cast<Leaf*>(_node)->key != key) {
+                            return false;
+                        }// end if (static_cast<Leaf*>(_node)->key != key)
+                        if (_path.empty()) {
+                            m_root.store(nullptr, std::memory_order_seq_cst);
+                        } else {
+                            remove_child(_path, _path.size() - 1UL);
+                        }// end if (_path.empty())
+                        m_manager.retire(_node);
+                        m_size.fetch_sub(1UL, std::memory_order_relaxed);
+                        return true;
+                    }// end if (_node->kind == Kind::Leaf)
+                    //--------------------------
+                    auto* _inner = static_cast<Inner*>(_node);
+                    if (key.substr(_depth, _inner->prefix.size()) != _inner->prefix) {
+                        return false;
+                    }// end if (key.substr(_depth, _inner->prefix.size()) != _inner->prefix)
+                    _depth += _inner->prefix.size();
+                    //--------------------------
+                    if (_depth == key.size()) {
+                        Node* _old = _inner->terminal.exchange(nullptr, std::memory_order_seq_cst);
+                        if (!_old) {
+                            return false;
+                        }// end if (!_old)
+                        _path.push_back(PathEntry{_slot, _inner, 0U});
+                        collapse(_path, _path.size() - 1UL);
+                        m_manager.retire(_old);
+                        m_size.fetch_sub(1UL, std::memory_order_relaxed);
+                        return true;
+                    }// end if (_depth == key.size())
+                    //--------------------------
+                    const auto _byte = static_cast<uint8_t>(key[_depth++]);
+                    _path.push_back(PathEntry{_slot, _inner, _byte});
+                    _slot = child_slot(_inner, _byte);
+                    if (!_slot) {
+                        return false;
+                    }// end if (!_slot)
+                    //--------------------------
+                }// end while (true)
+                //--------------------------
+            }// end bool erase_data(std::string_view key)
+            //--------------------------
+            // Drops path[index].byte from path[index].inner by replacing the node.
+            void remove_child(std::vector<PathEntry>& path, const size_t& index) {
+                //--------------------------
+                const PathEntry& _entry = path[index];
+                Inner* _inner           = _entry.inner;
+                const size_t _remaining = child_count(_inner) - 1UL;
+                //--------------------------
+                if (_remaining == 0UL and !_inner->terminal.load(std::memory_order_relaxed)) {
+                    unlink(path, index);
+                    return;
+                }// end if (_remaining == 0UL and ...)
+                //--------------------------
+                Inner* _copy = copy_inner(_inner, _inner->prefix, _remaining, _entry.byte);
+                replace(*_entry.slot, _inner, _copy);
+                path[index].inner = _copy;
+                collapse(path, index);
+                //--------------------------
+            }// end void remove_child(std::vector<PathEntry>& path, const size_t& index)
+            //--------------------------
+            // A node left with a single entry is replaced by it, to keep paths compressed.
+            void collapse(std::vector<PathEntry>& path, const size_t& index) {
+                //--------------------------
+                const PathEntry& _entry = path[index];
+                Inner* _inner           = _entry.inner;
+                Node* _terminal         = _inner->terminal.load(std::memory_order_relaxed);
+                const size_t _children  = child_count(_inner);
+                //--------------------------
+                if (_children == 0UL and !_terminal) {
+                    unlink(path, index);
+                    return;
+                }// end if (_children == 0UL and !_terminal)
+                //--------------------------
+                if (_children == 0UL) {
+                    // Leaves carry their whole key, so one may stand in for the node.
+                    replace(*_entry.slot, _inner, _terminal);
+                    return;
+                }// end if (_children == 0UL)
+                //--------------------------
+                if (_children != 1UL or _terminal) {
+                    return;
+                }// end if (_children != 1UL or _terminal)
+                //--------------------------
+                const auto _only = next_slot(_inner, -1);
+                Node* _child     = _only.second->load(std::memory_order_relaxed);
+                if (_child->kind == Kind::Leaf) {
+                    replace(*_entry.slot, _inner, _child);
+                    return;
+                }// end if (_child->kind == Kind::Leaf)
+                //--------------------------
+                auto* _below  = static_cast<Inner*>(_child);
+                Inner* _merged = copy_inner(_below, _inner->prefix + static_cast<char>(_only.first) + _below->prefix, child_count(_below), -1);
+                _below->obsolete.store(true, std::memory_order_seq_cst);
+                replace(*_entry.slot, _inner, _merged);
+                m_manager.retire(_below);
+                //--------------------------
+            }// end void collapse(std::vector<PathEntry>& path, const size_t& index)
+            //--------------------------
+            // path[index].inner has nothing left: remove it from its parent.
+            void unlink(std::vector<PathEntry>& path, const size_t& index) {
+                //--------------------------
+                Inner* _inner = path[index].inner;
+                if (index == 0UL) {
+                    replace(m_root, _inner, nullptr);
+                    return;
+                }// end if (index == 0UL)
+                //--------------------------
+                _inner->obsolete.store(true, std::memory_order_seq_cst);
+                remove_child(path, index - 1UL);
+                m_manager.retire(_inner);
+                //--------------------------
+            }// end void unlink(std::vector<PathEntry>& path, const size_t& index)
+            //--------------------------
+            // Readers holding old restart once they see it obsolete; the children
+            // it shares with its replacement stay.
+            void replace(std::atomic<Node*>& slot, Inner* old, Node* replacement) {
+                //--------------------------
+                old->obsolete.store(true, std::memory_order_seq_cst);
+                slot.store(replacement, std::memory_order_seq_cst);
+                m_manager.retire(old);
+                //--------------------------
+            }// end void replace(std::atomic<Node*>& slot, Inner* old, Node* replacement)
+            //--------------------------
+            // Adds node under split: as its terminal if key ends at depth.
+            static void place(Inner* split, Node* node, std::string_view key, const size_t& depth) {
+                //--------------------------
+                if (key.size() == depth) {
+                    split->terminal.store(node, std::memory_order_relaxed);
+                } else {
+                    append(split, static_cast<uint8_t>(key[depth]), node);
+                }// end if (key.size() == depth)
+                //--------------------------
+            }// end static void place(Inner* split, Node* node, std::string_view key, const size_t& depth)
+            //--------------------------
+            // In place; false when the node is full.
+            static bool append(Inner* inner, const uint8_t& byte, Node* child) {
+                //--------------------------
+                switch (inner->kind) {
+                    case Kind::Node4:
+                        return small_append(static_cast<Node4*>(inner), byte, child);
+                    case Kind::Node16:
+                        return small_append(static_cast<Node16*>(inner), byte, child);
+                    case Kind::Node48: {
+                        auto* _node = static_cast<Node48*>(inner);
+                        if (_node->count == _node->children.size()) {
+                            return false;
+                        }// end if (_node->count == _node->children.size())
+                        _node->children[_node->count].store(child, std::memory_order_relaxed);
+                        _node->index[byte].store(static_cast<uint8_t>(++_node->count), std::memory_order_release);
+                        return true;
+                    }
+                    case Kind::Node256: {
+                        auto* _node = static_cast<Node256*>(inner);
+                        _node->children[byte].store(child, std::memory_order_release);
+                        ++_node->count;
+                        return true;
+                    }
+                    default:
+                        return false;
+                }// end switch (inner->kind)
+                //--------------------------
+            }// end static bool append(Inner* inner, const uint8_t& byte, Node* child)
+            //--------------------------
+            template<typename Small>
+            static bool small_append(Small* node, const uint8_t& byte, Node* child) {
+                //--------------------------
+                const uint8_t _count = node->count.load(std::memory_order_relaxed);
+                if (_count == node->children.size()) {
+                    return false;
+                }// end if (_count == node->children.size())
+                node->keys[_count].store(byte, std::memory_order_relaxed);
+                node->children[_count].store(child, std::memory_order_relaxed);
+                node->count.store(static_cast<uint8_t>(_count + 1U), std::memory_order_release);
+                return true;
+                //--------------------------
+            }// end static bool small_append(Small* node, const uint8_t& byte, Node* child)
+            //--------------------------
+            static size_t child_count(const Inner* inner) {
+                //--------------------------
+                switch (inner->kind) {
+                    case Kind::Node4:
+                        return static_cast<const Node4*>(inner)->count.load(std::memory_order_relaxed);
+                    case Kind::Node16:
+                        return static_cast<const Node16*>(inner)->count.load(std::memory_order_relaxed);
+                    case Kind::Node48:
+                        return static_cast<const Node48*>(inner)->count;
+                    case Kind::Node256:
+                        return static_cast<const Node256*>(inner)->count;
+                    default:
+                        return 0UL;
+                }// end switch (inner->kind)
+                //--------------------------
+            }// end static size_t child_count(const Inner* inner)
+            //--------------------------
+            // Smallest node kind that holds capacity children, filled from from
+            // (minus skip) with the same terminal.
+            static Inner* copy_inner(Inner* from, std::string prefix, const size_t& capacity, const int& skip) {
+                //--------------------------
+                Inner* _copy = nullptr;
+                if (capacity <= 4UL) {
+                    _copy = new Node4(std::move(prefix));
+                } else if (capacity <= 16UL) {
+                    _copy = new Node16(std::move(prefix));
+                } else if (capacity <= 48UL) {
+                    _copy = new Node48(std::move(prefix));
+                } else {
+                    _copy = new Node256(std::move(prefix));
+                }// end if (capacity <= 4UL)
+                //--------------------------
+                _copy->terminal.store(from->terminal.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                for (auto _next = next_slot(from, -1); _next.second; _next = next_slot(from, _next.first)) {
+                    if (_next.first != skip) {
+                        append(_copy, static_cast<uint8_t>(_next.first), _next.second->load(std::memory_order_relaxed));
+                    }// end if (_next.first != skip)
+                }// end for (auto _next = next_slot(from, -1); ...)
+                return _copy;
+                //--------------------------
+            }// end static Inner* copy_inner(Inner* from, std::string prefix, const size_t& capacity, const int& skip)
+            //--------------------------
+            static size_t common_prefix(std::string_view a, std::string_view b) {
+                //--------------------------
+                const size_t _limit = std::min(a.size(), b.size());
+                size_t _length      = 0UL;
+                while (_length < _limit and a[_length] == b[_length]) {
+                    ++_length;
+                }// end while (_length < _limit and a[_length] == b[_length])
+                return _length;
+                //--------------------------
+            }// end static size_t common_prefix(std::string_view a, std::string_view b)
+            //--------------------------
+            static void destroy(Node* node) {
+                //--------------------------
+                if (!node) {
+                    return;
+                }// end if (!node)
+                if (node->kind != Kind::Leaf) {
+                    auto* _inner = static_cast<Inner*>(node);
+                    destroy(_inner->terminal.load(std::memory_order_relaxed));
+                    for (auto _next = next_slot(_inner, -1); _next.second; _next = next_slot(_inner, _next.first)) {
+                        destroy(_next.second->load(std::memory_order_relaxed));
+                    }// end for (auto _next = next_slot(_inner, -1); ...)
+                }// end if (node->kind != Kind::Leaf)
+                delete node;
+                //--------------------------
+            }// end static void destroy(Node* node)
+            //--------------------------------------------------------------
+        private:
+            //--------------------------------------------------------------
+            static constexpr size_t C_DEFAULT_READERS    = 64UL;
+            static constexpr size_t C_HAZARDS_PER_READER = 3UL;
+            //--------------------------
+            Manager& m_manager;
+            std::atomic<Node*> m_root;
+            std::atomic<size_t> m_size;
+            alignas(64) std::atomic<bool> m_writing;
+        //--------------------------------------------------------------
+    };// end class RadixTree
+    //--------------------------------------------------------------
+}// end namespace HazardSystem
+//--------------------------------------------------------------
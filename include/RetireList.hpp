@@ -0,0 +1,192 @@
+#pragma once
+//--------------------------------------------------------------
+// Standard C++ library
+//--------------------------------------------------------------
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <algorithm>
+//--------------------------------------------------------------
+// User Defined Headers
+//--------------------------------------------------------------
+#include "HazardObject.hpp"
+//--------------------------------------------------------------
+namespace HazardSystem {
+    //--------------------------------------------------------------
+    // Thread-local retire list for intrusive types. Nodes are linked through
+    // their hazard_obj_base hook, so retire() and reclaim() never allocate.
+    // Mirrors the RetireMap interface used by HazardPointerManager.
+    //--------------------------------------------------------------
+    template<typename T>
+    class RetireList {
+        //--------------------------------------------------------------
+        static_assert(IntrusiveRetirable<T>, "RetireList requires T to derive from hazard_obj_base<T>");
+        //--------------------------------------------------------------
+        public:
+            //--------------------------------------------------------------
+            using reclaim_fn = typename hazard_obj_base<T>::reclaim_fn;
+            //--------------------------------------------------------------
+            explicit RetireList(const size_t& threshold,
+                                const std::function<bool(const T*)>& is_hazard) :   m_threshold(std::max<size_t>(1UL, threshold)),
+                                                                                    m_next_scan(m_threshold),
+                                                                                    m_hazard(is_hazard),
+                                                                                    m_head(nullptr),
+                                                                                    m_size(0UL) {
+                //--------------------------
+            }// end explicit RetireList(const size_t& threshold, const std::function<bool(const T*)>& is_hazard)
+            //--------------------------
+            RetireList(void)                        = delete;
+            RetireList(const RetireList&)            = delete;
+            RetireList& operator=(const RetireList&) = delete;
+            RetireList(RetireList&&)                 = delete;
+            RetireList& operator=(RetireList&&)      = delete;
+            //--------------------------
+            ~RetireList(void) {
+                clear_data();
+            }// end ~RetireList(void)
+            //--------------------------
+            bool retire(T* ptr) {
+                return retire_data(ptr, &RetireList::default_reclaim);
+            }// end bool retire(T* ptr)
+            //--------------------------
+            bool retire(T* ptr, reclaim_fn reclaim) {
+                return retire_data(ptr, reclaim ? reclaim : &RetireList::default_reclaim);
+            }// end bool retire(T* ptr, reclaim_fn reclaim)
+            //--------------------------
+            std::optional<size_t> reclaim(void) {
+                return scan_and_reclaim(m_hazard);
+            }// end std::optional<size_t> reclaim(void)
+            //--------------------------
+            template<typename Predicate>
+            std::optional<size_t> reclaim_with(Predicate&& hazard_view) {
+                return scan_and_reclaim(std::forward<Predicate>(hazard_view));
+            }// end std::optional<size_t> reclaim_with(Predicate&& hazard_view)
+            //--------------------------
+            size_t size(void) const {
+                return m_size;
+            }// end size_t size(void) const
+            //--------------------------
+            void clear(void) {
+                clear_data();
+            }// end void clear(void)
+            //--------------------------------------------------------------
+        protected:
+            //--------------------------------------------------------------
+            static void default_reclaim(T* ptr) {
+                std::default_delete<T>()(ptr);
+            }// end static void default_reclaim(T* ptr)
+            //--------------------------
+            static hazard_obj_base<T>& hook(T* ptr) {
+                return *static_cast<hazard_obj_base<T>*>(ptr);
+            }// end static hazard_obj_base<T>& hook(T* ptr)
+            //--------------------------
+            bool retire_data(T* ptr, reclaim_fn reclaim) {
+                //--------------------------
+                if (!ptr) {
+                    return false;
+                }// end if (!ptr)
+                //--------------------------
+                // A set reclaim function marks the node as already queued.
+                auto& _hook = hook(ptr);
+                if (_hook.m_hazard_reclaim) {
+                    return false;
+                }// end if (_hook.m_hazard_reclaim)
+                //--------------------------
+                _hook.m_hazard_reclaim  = reclaim;
+                _hook.m_hazard_next     = m_head;
+                m_head                  = ptr;
+                ++m_size;
+                //--------------------------
+                if (m_size >= m_next_scan) {
+                    static_cast<void>(scan_and_reclaim(m_hazard));
+                }// end if (m_size >= m_next_scan)
+                //--------------------------
+                return true;
+                //--------------------------
+            }// end bool retire_data(T* ptr, reclaim_fn reclaim)
+            //--------------------------
+            template<typename Predicate>
+            std::optional<size_t> scan_and_reclaim(Predicate&& hazard_view) {
+                //--------------------------
+                size_t _removed         = 0UL;
+                T* _kept                = nullptr;
+                T* _node                = m_head;
+                m_head                  = nullptr;
+                //--------------------------
+                while (_node) {
+                    auto& _hook = hook(_node);
+                    T* _next    = _hook.m_hazard_next;
+                    if (hazard_view(static_cast<const T*>(_node))) {
+                        _hook.m_hazard_next = _kept;
+                        _kept               = _node;
+                    } else {
+                        const reclaim_fn _reclaim   = _hook.m_hazard_reclaim;
+                        _hook.m_hazard_next         = nullptr;
+                        _hook.m_hazard_reclaim      = nullptr;
+                        --m_size;
+                        ++_removed;
+                        _reclaim(_node);
+                    }// end if (hazard_view(_node))
+                    _node = _next;
+                }// end while (_node)
+                // A reclaim function may retire more nodes (children of the one it
+                // frees); they are on m_head now and go in front of the survivors.
+                splice(_kept);
+                //--------------------------
+                // Survivors are still protected; wait for the list to grow past
+                // them again instead of rescanning on every retire.
+                m_next_scan = std::max(m_threshold, m_size * 2UL);
+                //--------------------------
+                return _removed ? std::optional<size_t>(_removed) : std::nullopt;
+                //--------------------------
+            }// end std::optional<size_t> scan_and_reclaim(Predicate&& hazard_view)
+            //--------------------------
+            void splice(T* list) {
+                //--------------------------
+                if (!m_head) {
+                    m_head = list;
+                    return;
+                }// end if (!m_head)
+                //--------------------------
+                T* _tail = m_head;
+                while (hook(_tail).m_hazard_next) {
+                    _tail = hook(_tail).m_hazard_next;
+                }// end while (hook(_tail).m_hazard_next)
+                hook(_tail).m_hazard_next = list;
+                //--------------------------
+            }// end void splice(T* list)
+            //--------------------------
+            void clear_data(void) {
+                //--------------------------
+                // Repeats until reclaim functions stop retiring further nodes.
+                while (m_head) {
+                    T* _node = m_head;
+                    m_head   = nullptr;
+                    while (_node) {
+                        auto& _hook                 = hook(_node);
+                        T* _next                    = _hook.m_hazard_next;
+                        const reclaim_fn _reclaim   = _hook.m_hazard_reclaim;
+                        _hook.m_hazard_next         = nullptr;
+                        _hook.m_hazard_reclaim      = nullptr;
+                        _reclaim(_node);
+                        _node = _next;
+                    }// end while (_node)
+                }// end while (m_head)
+                m_size      = 0UL;
+                m_next_scan = m_threshold;
+                //--------------------------
+            }// end void clear_data(void)
+            //--------------------------------------------------------------
+        private:
+            //--------------------------------------------------------------
+            const size_t m_threshold;
+            size_t m_next_scan;
+            std::function<bool(const T*)> m_hazard;
+            T* m_head;
+            size_t m_size;
+        //--------------------------------------------------------------
+    };// end class RetireList
+    //--------------------------------------------------------------
+} // namespace HazardSystem
+//--------------------------------------------------------------
@@ -9,17 +9,26 @@
 #include <functional>
 #include <algorithm>
 #include <memory>
+#include <memory_resource>
+#include <vector>
 //--------------------------------------------------------------
 namespace HazardSystem {
     //--------------------------------------------------------------
-    template<typename T>
+    // Allocator is rebound for the map nodes, so an arena (e.g. a
+    // std::pmr::polymorphic_allocator over a monotonic buffer) holds the retire
+    // bookkeeping too.
+    template<typename T, typename Allocator = std::allocator<std::byte>>
     class RetireMap {
         //--------------------------------------------------------------
         public:
+            //--------------------------------------------------------------
+            using allocator_type = Allocator;
             //--------------------------------------------------------------
             explicit RetireMap( const size_t& threshold,
-                                const std::function<bool(const T*)>& is_hazard) :   m_threshold(std::bit_ceil(threshold)),
-                                                                                    m_hazard(is_hazard) {
+                                const std::function<bool(const T*)>& is_hazard,
+                                const Allocator& allocator = Allocator()) : m_threshold(std::bit_ceil(threshold)),
+                                                                            m_hazard(is_hazard),
+                                                                            m_retired(MapAllocator(allocator)) {
                 //--------------------------
                 m_retired.reserve(threshold);
                 //--------------------------
@@ -38,8 +47,10 @@ namespace HazardSystem {
                 if (this != &other) {
                     clear_data();
                     m_threshold = other.m_threshold;
+                    m_fixed     = other.m_fixed;
                     m_hazard    = std::move(other.m_hazard);
                     m_retired   = std::move(other.m_retired);
+                    m_spare     = std::move(other.m_spare);
                 }// end if (this != &other)
                 return *this;
             }
@@ -56,6 +67,16 @@ namespace HazardSystem {
                 return retire_shared(std::move(owner));
             }// end bool retire(std::shared_ptr<T> owner)
             //--------------------------
+            // For objects built in a memory resource: destroy, then hand the storage
+            // back to resource. With a monotonic resource that is a no-op, and the
+            // arena is released in bulk once nothing retired from it is pending.
+            bool retire(T* ptr, std::pmr::memory_resource* resource) {
+                if (!resource) {
+                    return false;
+                }// end if (!resource)
+                return retire_data(ptr, Deleter(resource));
+            }// end bool retire(T* ptr, std::pmr::memory_resource* resource)
+            //--------------------------
             std::optional<size_t> reclaim(void) {
                 return scan_and_reclaim();
             }// end std::optional<size_t> reclaim(void)
@@ -75,6 +96,14 @@ namespace HazardSystem {
             bool resize(const size_t& requested_size) {
                 return resize_retired(requested_size);
             }// end bool resize(const size_t& requested_size)
+            //--------------------------
+            // Preallocates map nodes and buckets for count entries and pins the
+            // threshold there: a full map scans and, if nothing is free, rejects the
+            // retire instead of growing. Reclaimed nodes are kept for reuse, so after
+            // this retire and reclaim do not allocate.
+            bool reserve(const size_t& count) {
+                return reserve_nodes(count);
+            }// end bool reserve(const size_t& count)
             //--------------------------------------------------------------
         protected:
             //--------------------------------------------------------------
@@ -84,13 +113,15 @@ namespace HazardSystem {
                     enum class Kind : uint8_t {
                         Default     = 1 << 0,
                         SharedOwner = 1 << 1,
-                        Custom      = 1 << 2
+                        Custom      = 1 << 2,
+                        Resource    = 1 << 3
                     }; // end enum class Kind : uint8_t
                     //--------------------------------------------------------------
                 public:
                     Deleter(void) : kind(Kind::Default),
                                     owner(nullptr),
-                                    custom(nullptr) {
+                                    custom(nullptr),
+                                    resource(nullptr) {
                         //--------------------------
                     }// end Deleter(void)
                     //--------------------------
@@ -105,6 +136,10 @@ namespace HazardSystem {
                                                                     owner(std::move(owner_ptr)) {
                     }// end explicit Deleter(std::shared_ptr<T> owner_ptr)
                     //--------------------------
+                    explicit Deleter(std::pmr::memory_resource* resource_ptr) : kind(Kind::Resource),
+                                                                                resource(resource_ptr) {
+                    }// end explicit Deleter(std::pmr::memory_resource* resource_ptr)
+                    //--------------------------
                     Deleter(Deleter&&) noexcept            = default;
                     Deleter& operator=(Deleter&&) noexcept = default;
                     Deleter(const Deleter&)                = delete;
@@ -127,6 +162,10 @@ namespace HazardSystem {
                             case Kind::Custom:
                                 custom(ptr);
                                 break;
+                            case Kind::Resource:
+                                std::destroy_at(ptr);
+                                resource->deallocate(ptr, sizeof(T), alignof(T));
+                                break;
                             default:
                                 std::default_delete<T>()(ptr);
                                 break;
@@ -137,8 +176,13 @@ namespace HazardSystem {
                     Kind kind;
                     std::shared_ptr<T> owner;
                     std::function<void(T*)> custom;
+                    std::pmr::memory_resource* resource{nullptr};
             }; // struct Deleter
             //--------------------------
+            using MapAllocator   = typename std::allocator_traits<Allocator>::template rebind_alloc<std::pair<T* const, std::unique_ptr<T, Deleter>>>;
+            using MapType        = std::unordered_map<T*, std::unique_ptr<T, Deleter>, std::hash<T*>, std::equal_to<T*>, MapAllocator>;
+            using NodeType       = typename MapType::node_type;
+            //--------------------------
             bool retire_data(T* ptr, Deleter&& deleter) {
                 //--------------------------
                 if (!ptr) {
@@ -151,7 +195,7 @@ namespace HazardSystem {
                     }
                 }// end if (m_retired.size() >= m_threshold)
                 //--------------------------
-                if (should_resize()) {
+                if (!m_fixed and should_resize()) {
                     constexpr float C_INCREASE_SIZE = 1.2f;
                     if (!resize_retired(static_cast<size_t>(m_retired.size() * C_INCREASE_SIZE))) {
                         return false;
@@ -163,6 +207,13 @@ namespace HazardSystem {
                 }// end if (m_retired.find(ptr) != m_retired.end())
                 //--------------------------
                 std::unique_ptr<T, Deleter> owned(ptr, std::move(deleter));
+                if (!m_spare.empty()) {
+                    NodeType _node = std::move(m_spare.back());
+                    m_spare.pop_back();
+                    _node.key()    = ptr;
+                    _node.mapped() = std::move(owned);
+                    return m_retired.insert(std::move(_node)).inserted;
+                }// end if (!m_spare.empty())
                 return m_retired.emplace(ptr, std::move(owned)).second;
                 //--------------------------
             }// end bool retire_data(std::shared_ptr<T> ptr)
@@ -187,7 +238,7 @@ namespace HazardSystem {
                 //--------------------------
                 for (auto it = m_retired.begin(); it != m_retired.end();) {
                     if (!hazard_view(it->first)) {
-                        it = m_retired.erase(it);
+                        it = erase_node(it);
                     } else {
                         ++it;
                     }
@@ -221,17 +272,69 @@ namespace HazardSystem {
                 //--------------------------
             }// end bool should_resize(void)
             //--------------------------
+            bool reserve_nodes(const size_t& count) {
+                //--------------------------
+                if (count < m_retired.size()) {
+                    return false;
+                }// end if (count < m_retired.size())
+                //--------------------------
+                const size_t _capacity = std::bit_ceil(count);
+                m_retired.reserve(_capacity);
+                m_spare.reserve(_capacity);
+                // Null is never retired, so it can stand in as the key while a node
+                // is built and extracted.
+                while (m_spare.size() + m_retired.size() < _capacity) {
+                    auto _it = m_retired.emplace(nullptr, std::unique_ptr<T, Deleter>()).first;
+                    m_spare.push_back(m_retired.extract(_it));
+                }// end while (m_spare.size() + m_retired.size() < _capacity)
+                m_threshold = _capacity;
+                m_fixed     = true;
+                //--------------------------
+                return true;
+                //--------------------------
+            }// end bool reserve_nodes(const size_t& count)
+            //--------------------------
+            // Destroys the entry; its node goes back to the spare list while that has
+            // reserved room left.
+            typename MapType::iterator erase_node(typename MapType::iterator it) {
+                //--------------------------
+                if (m_spare.size() == m_spare.capacity()) {
+                    return m_retired.erase(it);
+                }// end if (m_spare.size() == m_spare.capacity())
+                //--------------------------
+                auto _next     = std::next(it);
+                NodeType _node = m_retired.extract(it);
+                _node.mapped().reset();
+                m_spare.push_back(std::move(_node));
+                return _next;
+                //--------------------------
+            }// end typename MapType::iterator erase_node(typename MapType::iterator it)
+            //--------------------------
             void clear_data(void) { 
-                m_retired.clear();
+                if (!m_fixed) {
+                    m_retired.clear();
+                    return;
+                }// end if (!m_fixed)
+                for (auto it = m_retired.begin(); it != m_retired.end();) {
+                    it = erase_node(it);
+                }// end for (auto it = m_retired.begin(); it != m_retired.end();)
             }// end void clear_data(void)
             //--------------------------------------------------------------
         private:
             //--------------------------------------------------------------
             size_t m_threshold;
+            bool m_fixed{false};
             std::function<bool(const T*)> m_hazard;
-            std::unordered_map<T*, std::unique_ptr<T, Deleter>> m_retired;
+            MapType m_retired;
+            // Node handles only; the nodes themselves still come from Allocator.
+            std::vector<NodeType> m_spare;
         //--------------------------------------------------------------
     };// end clas class RetireMap
     //--------------------------------------------------------------
+    namespace pmr {
+        template<typename T>
+        using RetireMap = HazardSystem::RetireMap<T, std::pmr::polymorphic_allocator<std::byte>>;
+    }// end namespace pmr
+    //--------------------------------------------------------------
 } // namespace HazardSystem
 //--------------------------------------------------------------
@@ -0,0 +1,529 @@
+#pragma once
+//--------------------------------------------------------------
+// Standard C++ library
+//--------------------------------------------------------------
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <functional>
+#include <optional>
+#include <vector>
+#include <algorithm>
+#include <new>
+#include <utility>
+//--------------------------------------------------------------
+// Platform headers
+//--------------------------------------------------------------
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <cerrno>
+#include <csignal>
+#include <unistd.h>
+#endif
+//--------------------------------------------------------------
+// User Defined Headers
+//--------------------------------------------------------------
+#include "ProtectedPointer.hpp"
+#include "Backoff.hpp"
+//--------------------------------------------------------------
+namespace HazardSystem {
+    //--------------------------------------------------------------
+    // Hazard domain that lives entirely inside a caller-provided shared mapping
+    // (memfd, shm_open, MAP_SHARED|MAP_ANONYMOUS before fork). The slot table
+    // and the retire ring are laid out at the start of the region and refer to
+    // objects by offset from the region base, so processes that map the region
+    // at different addresses agree on what is protected.
+    //
+    // Each slot records the pid of the process holding it. recover() frees slots
+    // whose owner no longer exists, so a crashed worker cannot pin retired
+    // objects forever. A reused pid keeps its slots, which is conservative.
+    //
+    // Nothing process-specific is stored in the region: the reclaimer (usually
+    // the shared allocator's free) is supplied by each process when it attaches,
+    // and any process may reclaim what another one retired.
+    //--------------------------------------------------------------
+    class SharedHazardDomain {
+        //--------------------------------------------------------------
+        public:
+            //--------------------------------------------------------------
+            using Offset    = uint64_t;
+            using Reclaimer = std::function<void(Offset)>;
+            //--------------------------------------------------------------
+            static constexpr Offset C_NULL_OFFSET = 0UL;
+            //--------------------------------------------------------------
+            // Bytes taken from the start of the region by the domain itself. User
+            // objects go after this, inside the same region.
+            static constexpr size_t required_size(const size_t& slots, const size_t& retire_capacity) {
+                return sizeof(Header) + slots * sizeof(Slot) + retire_capacity * sizeof(RetireEntry);
+            }// end static constexpr size_t required_size(const size_t& slots, const size_t& retire_capacity)
+            //--------------------------
+            // Lay out a fresh domain. Call once, before any other process attaches.
+            static std::optional<SharedHazardDomain> create(void* region,
+                                                            const size_t& bytes,
+                                                            const size_t& slots,
+                                                            const size_t& retire_capacity,
+                                                            Reclaimer reclaimer) {
+                return create_data(region, bytes, slots, retire_capacity, std::move(reclaimer));
+            }// end static std::optional<SharedHazardDomain> create(...)
+            //--------------------------
+            // Open a domain another process created. Fails if the region does not
+            // hold a finished domain of this layout version.
+            static std::optional<SharedHazardDomain> attach(void* region, const size_t& bytes, Reclaimer reclaimer) {
+                return attach_data(region, bytes, std::move(reclaimer));
+            }// end static std::optional<SharedHazardDomain> attach(void* region, const size_t& bytes, Reclaimer reclaimer)
+            //--------------------------
+            // Protect the object source currently points to; the offset is re-read
+            // until it is stable, like HazardPointerManager::try_protect.
+            template<typename T>
+            ProtectedPointer<T> protect(const std::atomic<Offset>& source, const size_t& max_retries = 100UL) {
+                return protect_data<T>(source, max_retries);
+            }// end ProtectedPointer<T> protect(const std::atomic<Offset>& source, const size_t& max_retries)
+            //--------------------------
+            template<typename T>
+            ProtectedPointer<T> protect(T* ptr) {
+                return protect_pointer<T>(ptr);
+            }// end ProtectedPointer<T> protect(T* ptr)
+            //--------------------------
+            bool retire(const Offset& offset) {
+                return retire_data(offset);
+            }// end bool retire(const Offset& offset)
+            //--------------------------
+            template<typename T>
+            bool retire(T* ptr) {
+                return retire_data(offset_of(ptr));
+            }// end bool retire(T* ptr)
+            //--------------------------
+            // Hand every retired offset that no slot publishes to the reclaimer.
+            size_t reclaim(void) {
+                return reclaim_data();
+            }// end size_t reclaim(void)
+            //--------------------------
+            // Free slots owned by processes that no longer exist.
+            size_t recover(void) {
+                return recover_data();
+            }// end size_t recover(void)
+            //--------------------------
+            Offset offset_of(const void* ptr) const {
+                return offset_of_data(ptr);
+            }// end Offset offset_of(const void* ptr) const
+            //--------------------------
+            template<typename T>
+            T* at(const Offset& offset) const {
+                return static_cast<T*>(address_of(offset));
+            }// end T* at(const Offset& offset) const
+            //--------------------------
+            size_t hazard_size(void) const {
+                return hazard_count();
+            }// end size_t hazard_size(void) const
+            //--------------------------
+            size_t hazard_capacity(void) const {
+                return m_header->slot_count;
+            }// end size_t hazard_capacity(void) const
+            //--------------------------
+            size_t retire_size(void) const {
+                return static_cast<size_t>(m_header->retired.load(std::memory_order_acquire));
+            }// end size_t retire_size(void) const
+            //--------------------------
+            size_t retire_capacity(void) const {
+                return m_header->retire_capacity;
+            }// end size_t retire_capacity(void) const
+            //--------------------------------------------------------------
+        protected:
+            //--------------------------------------------------------------
+            struct alignas(64) Header {
+                uint64_t magic;
+                uint32_t version;
+                uint32_t slot_count;
+                uint32_t retire_capacity;
+                uint32_t retire_threshold;
+                std::atomic<uint32_t> state;
+                std::atomic<uint32_t> slot_hint;
+                std::atomic<uint32_t> retire_hint;
+                std::atomic<uint64_t> retired;
+            };// end struct Header
+            //--------------------------
+            struct alignas(64) Slot {
+                std::atomic<Offset> offset;
+                std::atomic<int64_t> owner;
+            };// end struct Slot
+            //--------------------------
+            struct RetireEntry {
+                std::atomic<Offset> offset;
+            };// end struct RetireEntry
+            //--------------------------------------------------------------
+            SharedHazardDomain(std::byte* base, const size_t& bytes, Reclaimer&& reclaimer) : m_base(base),
+                                                                                              m_bytes(bytes),
+                                                                                              m_header(std::launder(reinterpret_cast<Header*>(base))),
+                                                                                              m_slots(std::launder(reinterpret_cast<Slot*>(base + sizeof(Header)))),
+                                                                                              m_retired(nullptr),
+                                                                                              m_reclaimer(std::move(reclaimer)) {
+                //--------------------------
+                m_retired = std::launder(reinterpret_cast<RetireEntry*>(base + sizeof(Header) + m_header->slot_count * sizeof(Slot)));
+                //--------------------------
+            }// end SharedHazardDomain(std::byte* base, const size_t& bytes, Reclaimer&& reclaimer)
+            //--------------------------------------------------------------
+            static std::optional<SharedHazardDomain> create_data(   void* region,
+                                                                    const size_t& bytes,
+                                                                    const size_t& slots,
+                                                                    const size_t& retire_capacity,
+                                                                    Reclaimer&& reclaimer) {
+                //--------------------------
+                if (!valid_region(region) or !reclaimer or !slots or !retire_capacity) {
+                    return std::nullopt;
+                }// end if (!valid_region(region) or !reclaimer or !slots or !retire_capacity)
+                //--------------------------
+                if (slots > UINT32_MAX or retire_capacity > UINT32_MAX or bytes < required_size(slots, retire_capacity)) {
+                    return std::nullopt;
+                }// end if (... bytes < required_size(slots, retire_capacity))
+                //--------------------------
+                auto* _base   = static_cast<std::byte*>(region);
+                auto* _header = new (_base) Header{};
+                _header->magic            = C_MAGIC;
+                _header->version          = C_VERSION;
+                _header->slot_count       = static_cast<uint32_t>(slots);
+                _header->retire_capacity  = static_cast<uint32_t>(retire_capacity);
+                _header->retire_threshold = static_cast<uint32_t>(std::max<size_t>(1UL, retire_capacity / 2UL));
+                //--------------------------
+                auto* _slots = _base + sizeof(Header);
+                for (size_t i = 0; i < slots; ++i) {
+                    auto* _slot = new (_slots + i * sizeof(Slot)) Slot{};
+                    _slot->offset.store(C_NULL_OFFSET, std::memory_order_relaxed);
+                    _slot->owner.store(C_NO_OWNER, std::memory_order_relaxed);
+                }// end for (size_t i = 0; i < slots; ++i)
+                //--------------------------
+                auto* _entries = _slots + slots * sizeof(Slot);
+                for (size_t i = 0; i < retire_capacity; ++i) {
+                    auto* _entry = new (_entries + i * sizeof(RetireEntry)) RetireEntry{};
+                    _entry->offset.store(C_NULL_OFFSET, std::memory_order_relaxed);
+                }// end for (size_t i = 0; i < retire_capacity; ++i)
+                //--------------------------
+                _header->state.store(C_READY, std::memory_order_release);
+                return SharedHazardDomain(_base, bytes, std::move(reclaimer));
+                //--------------------------
+            }// end static std::optional<SharedHazardDomain> create_data(...)
+            //--------------------------
+            static std::optional<SharedHazardDomain> attach_data(void* region, const size_t& bytes, Reclaimer&& reclaimer) {
+                //--------------------------
+                if (!valid_region(region) or !reclaimer or bytes < sizeof(Header)) {
+                    return std::nullopt;
+                }// end if (!valid_region(region) or !reclaimer or bytes < sizeof(Header))
+                //--------------------------
+                auto* _base         = static_cast<std::byte*>(region);
+                const auto* _header = std::launder(reinterpret_cast<const Header*>(_base));
+                if (_header->state.load(std::memory_order_acquire) != C_READY or
+                    _header->magic != C_MAGIC or _header->version != C_VERSION) {
+                    return std::nullopt;
+                }// end if (... _header->version != C_VERSION)
+                //--------------------------
+                if (bytes < required_size(_header->slot_count, _header->retire_capacity)) {
+                    return std::nullopt;
+                }// end if (bytes < required_size(...))
+                //--------------------------
+                return SharedHazardDomain(_base, bytes, std::move(reclaimer));
+                //--------------------------
+            }// end static std::optional<SharedHazardDomain> attach_data(void* region, const size_t& bytes, Reclaimer&& reclaimer)
+            //--------------------------
+            template<typename T>
+            ProtectedPointer<T> protect_data(const std::atomic<Offset>& source, const size_t& max_retries) {
+                //--------------------------
+                auto _index = acquire_slot();
+                if (!_index) {
+                    return ProtectedPointer<T>();
+                }// end if (!_index)
+                //--------------------------
+                Slot& _slot = m_slots[_index.value()];
+                Backoff _backoff;
+                for (size_t attempt = 0; attempt < std::max<size_t>(1UL, max_retries); ++attempt) {
+                    const Offset _offset = source.load(std::memory_order_acquire);
+                    if (_offset == C_NULL_OFFSET) {
+                        break;
+                    }// end if (_offset == C_NULL_OFFSET)
+                    //--------------------------
+                    static_cast<void>(_slot.offset.exchange(_offset, std::memory_order_seq_cst));
+                    if (source.load(std::memory_order_seq_cst) == _offset) {
+                        return create_protected_pointer<T>(_index.value(), _offset);
+                    }// end if (source.load(std::memory_order_seq_cst) == _offset)
+                    //--------------------------
+                    _backoff.pause();
+                }// end for (size_t attempt = 0; attempt < max_retries; ++attempt)
+                //--------------------------
+                static_cast<void>(release_slot(_slot));
+                return ProtectedPointer<T>();
+                //--------------------------
+            }// end ProtectedPointer<T> protect_data(const std::atomic<Offset>& source, const size_t& max_retries)
+            //--------------------------
+            template<typename T>
+            ProtectedPointer<T> protect_pointer(T* ptr) {
+                //--------------------------
+                const Offset _offset = offset_of_data(ptr);
+                if (_offset == C_NULL_OFFSET) {
+                    return ProtectedPointer<T>();
+                }// end if (_offset == C_NULL_OFFSET)
+                //--------------------------
+                auto _index = acquire_slot();
+                if (!_index) {
+                    return ProtectedPointer<T>();
+                }// end if (!_index)
+                //--------------------------
+                static_cast<void>(m_slots[_index.value()].offset.exchange(_offset, std::memory_order_seq_cst));
+                return create_protected_pointer<T>(_index.value(), _offset);
+                //--------------------------
+            }// end ProtectedPointer<T> protect_pointer(T* ptr)
+            //--------------------------
+            template<typename T>
+            ProtectedPointer<T> create_protected_pointer(const size_t& index, const Offset& offset) {
+                // Capture the slot, not this: views are cheap values and may move.
+                return ProtectedPointer<T>(at<T>(offset), [slot = &m_slots[index]]() { return release_slot(*slot); });
+            }// end ProtectedPointer<T> create_protected_pointer(const size_t& index, const Offset& offset)
+            //--------------------------
+            std::optional<size_t> acquire_slot(void) {
+                //--------------------------
+                const int64_t _self = current_process();
+                const size_t _count = m_header->slot_count;
+                //--------------------------
+                // Second pass runs after recovering slots left by dead processes.
+                for (int pass = 0; pass < 2; ++pass) {
+                    const size_t _start = m_header->slot_hint.load(std::memory_order_relaxed) % _count;
+                    for (size_t i = 0; i < _count; ++i) {
+                        const size_t _index = (_start + i) % _count;
+                        int64_t _expected   = C_NO_OWNER;
+                        if (m_slots[_index].owner.load(std::memory_order_relaxed) == C_NO_OWNER and
+                            m_slots[_index].owner.compare_exchange_strong(_expected, _self, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                            m_header->slot_hint.store(static_cast<uint32_t>((_index + 1) % _count), std::memory_order_relaxed);
+                            return _index;
+                        }// end if (... compare_exchange_strong(_expected, _self, ...))
+                    }// end for (size_t i = 0; i < _count; ++i)
+                    //--------------------------
+                    if (!recover_data()) {
+                        break;
+                    }// end if (!recover_data())
+                }// end for (int pass = 0; pass < 2; ++pass)
+                //--------------------------
+                return std::nullopt;
+                //--------------------------
+            }// end std::optional<size_t> acquire_slot(void)
+            //--------------------------
+            static bool release_slot(Slot& slot) {
+                //--------------------------
+                slot.offset.store(C_NULL_OFFSET, std::memory_order_release);
+                slot.owner.store(C_NO_OWNER, std::memory_order_release);
+                return true;
+                //--------------------------
+            }// end static bool release_slot(Slot& slot)
+            //--------------------------
+            bool retire_data(const Offset& offset) {
+                //--------------------------
+                if (offset == C_NULL_OFFSET or offset >= m_bytes) {
+                    return false;
+                }// end if (offset == C_NULL_OFFSET or offset >= m_bytes)
+                //--------------------------
+                // A full ring is drained once, then once more after recovering slots.
+                for (int pass = 0; pass < 3; ++pass) {
+                    if (push_retired(offset)) {
+                        if (m_header->retired.load(std::memory_order_relaxed) >= m_header->retire_threshold) {
+                            static_cast<void>(reclaim_data());
+                        }// end if (... >= m_header->retire_threshold)
+                        return true;
+                    }// end if (push_retired(offset))
+                    //--------------------------
+                    if (pass == 1 and !recover_data()) {
+                        break;
+                    }// end if (pass == 1 and !recover_data())
+                    static_cast<void>(reclaim_data());
+                }// end for (int pass = 0; pass < 3; ++pass)
+                //--------------------------
+                return false;
+                //--------------------------
+            }// end bool retire_data(const Offset& offset)
+            //--------------------------
+            bool push_retired(const Offset& offset) {
+                //--------------------------
+                const size_t _count = m_header->retire_capacity;
+                const size_t _start = m_header->retire_hint.fetch_add(1U, std::memory_order_relaxed) % _count;
+                for (size_t i = 0; i < _count; ++i) {
+                    auto& _entry      = m_retired[(_start + i) % _count];
+                    Offset _expected  = C_NULL_OFFSET;
+                    if (_entry.offset.load(std::memory_order_relaxed) == C_NULL_OFFSET and
+                        _entry.offset.compare_exchange_strong(_expected, offset, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                        m_header->retired.fetch_add(1UL, std::memory_order_acq_rel);
+                        return true;
+                    }// end if (... compare_exchange_strong(_expected, offset, ...))
+                }// end for (size_t i = 0; i < _count; ++i)
+                //--------------------------
+                return false;
+                //--------------------------
+            }// end bool push_retired(const Offset& offset)
+            //--------------------------
+            size_t reclaim_data(void) {
+                //--------------------------
+                // Collect candidates before reading the slots: anything retired by now
+                // is already unlinked, so a reader that still holds it published first.
+                std::vector<std::pair<size_t, Offset>> _candidates;
+                for (size_t i = 0; i < m_header->retire_capacity; ++i) {
+                    const Offset _offset = m_retired[i].offset.load(std::memory_order_acquire);
+                    if (_offset != C_NULL_OFFSET) {
+                        _candidates.emplace_back(i, _offset);
+                    }// end if (_offset != C_NULL_OFFSET)
+                }// end for (size_t i = 0; i < m_header->retire_capacity; ++i)
+                //--------------------------
+                if (_candidates.empty()) {
+                    return 0UL;
+                }// end if (_candidates.empty())
+                //--------------------------
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                const std::vector<Offset> _hazards = hazard_snapshot();
+                //--------------------------
+                size_t _reclaimed = 0UL;
+                for (const auto& [index, offset] : _candidates) {
+                    if (std::binary_search(_hazards.begin(), _hazards.end(), offset)) {
+                        continue;
+                    }// end if (std::binary_search(_hazards.begin(), _hazards.end(), offset))
+                    //--------------------------
+                    // Another process may be reclaiming the same entry; one CAS wins.
+                    Offset _expected = offset;
+                    if (m_retired[index].offset.compare_exchange_strong(_expected, C_NULL_OFFSET, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                        m_header->retired.fetch_sub(1UL, std::memory_order_acq_rel);
+                        m_reclaimer(offset);
+                        ++_reclaimed;
+                    }// end if (m_retired[index].offset.compare_exchange_strong(...))
+                }// end for (const auto& [index, offset] : _candidates)
+                //--------------------------
+                return _reclaimed;
+                //--------------------------
+            }// end size_t reclaim_data(void)
+            //--------------------------
+            size_t recover_data(void) {
+                //--------------------------
+                const int64_t _self = current_process();
+                size_t _recovered   = 0UL;
+                for (size_t i = 0; i < m_header->slot_count; ++i) {
+                    Slot& _slot          = m_slots[i];
+                    const int64_t _owner = _slot.owner.load(std::memory_order_acquire);
+                    if (_owner == C_NO_OWNER or _owner == _self or process_alive(_owner)) {
+                        continue;
+                    }// end if (_owner == C_NO_OWNER or _owner == _self or process_alive(_owner))
+                    //--------------------------
+                    // Claim the slot for this process first: only the winner may touch
+                    // offset, and a live owner never passes the dead-pid check, so a
+                    // slot already handed back and retaken keeps its hazard. Should
+                    // this process die here, the slot reads as dead and is recovered
+                    // again.
+                    int64_t _expected = _owner;
+                    if (!_slot.owner.compare_exchange_strong(_expected, _self, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                        continue;
+                    }// end if (!_slot.owner.compare_exchange_strong(_expected, _self, ...))
+                    _slot.offset.store(C_NULL_OFFSET, std::memory_order_release);
+                    _slot.owner.store(C_NO_OWNER, std::memory_order_release);
+                    ++_recovered;
+                }// end for (size_t i = 0; i < m_header->slot_count; ++i)
+                //--------------------------
+                return _recovered;
+                //--------------------------
+            }// end size_t recover_data(void)
+            //--------------------------
+            std::vector<Offset> hazard_snapshot(void) const {
+                //--------------------------
+                std::vector<Offset> _hazards;
+                _hazards.reserve(m_header->slot_count);
+                for (size_t i = 0; i < m_header->slot_count; ++i) {
+                    const Offset _offset = m_slots[i].offset.load(std::memory_order_acquire);
+                    if (_offset != C_NULL_OFFSET) {
+                        _hazards.push_back(_offset);
+                    }// end if (_offset != C_NULL_OFFSET)
+                }// end for (size_t i = 0; i < m_header->slot_count; ++i)
+                //--------------------------
+                std::sort(_hazards.begin(), _hazards.end());
+                return _hazards;
+                //--------------------------
+            }// end std::vector<Offset> hazard_snapshot(void) const
+            //--------------------------
+            size_t hazard_count(void) const {
+                //--------------------------
+                size_t _count = 0UL;
+                for (size_t i = 0; i < m_header->slot_count; ++i) {
+                    if (m_slots[i].offset.load(std::memory_order_acquire) != C_NULL_OFFSET) {
+                        ++_count;
+                    }// end if (... != C_NULL_OFFSET)
+                }// end for (size_t i = 0; i < m_header->slot_count; ++i)
+                //--------------------------
+                return _count;
+                //--------------------------
+            }// end size_t hazard_count(void) const
+            //--------------------------
+            Offset offset_of_data(const void* ptr) const {
+                //--------------------------
+                const auto* _ptr = static_cast<const std::byte*>(ptr);
+                if (!_ptr or _ptr <= m_base or _ptr >= m_base + m_bytes) {
+                    return C_NULL_OFFSET;
+                }// end if (!_ptr or _ptr <= m_base or _ptr >= m_base + m_bytes)
+                //--------------------------
+                return static_cast<Offset>(_ptr - m_base);
+                //--------------------------
+            }// end Offset offset_of_data(const void* ptr) const
+            //--------------------------
+            void* address_of(const Offset& offset) const {
+                //--------------------------
+                if (offset == C_NULL_OFFSET or offset >= m_bytes) {
+                    return nullptr;
+                }// end if (offset == C_NULL_OFFSET or offset >= m_bytes)
+                //--------------------------
+                return m_base + offset;
+                //--------------------------
+            }// end void* address_of(const Offset& offset) const
+            //--------------------------
+            static bool valid_region(const void* region) {
+                return region and (reinterpret_cast<uintptr_t>(region) % alignof(Header)) == 0;
+            }// end static bool valid_region(const void* region)
+            //--------------------------
+            // Read on every acquire rather than cached: a view copied into a forked
+            // child must stamp slots with the child's pid.
+            static int64_t current_process(void) {
+#if defined(_WIN32)
+                return static_cast<int64_t>(::GetCurrentProcessId());
+#else
+                return static_cast<int64_t>(::getpid());
+#endif
+            }// end static int64_t current_process(void)
+            //--------------------------
+            static bool process_alive(const int64_t& pid) {
+#if defined(_WIN32)
+                HANDLE _process = ::OpenProcess(PROCESS_QUERY_LIMITED_INFORMATION, FALSE, static_cast<DWORD>(pid));
+                if (!_process) {
+                    return ::GetLastError() != ERROR_INVALID_PARAMETER;
+                }// end if (!_process)
+                DWORD _code = 0;
+                const bool _alive = ::GetExitCodeProcess(_process, &_code) and _code == STILL_ACTIVE;
+                ::CloseHandle(_process);
+                return _alive;
+#else
+                // EPERM means the process exists but belongs to someone else.
+                return ::kill(static_cast<pid_t>(pid), 0) == 0 or errno != ESRCH;
+#endif
+            }// end static bool process_alive(const int64_t& pid)
+            //--------------------------------------------------------------
+        private:
+            //--------------------------------------------------------------
+            static constexpr uint64_t C_MAGIC   = 0x48415A4152445348ULL; // "HAZARDSH"
+            static constexpr uint32_t C_VERSION = 1U;
+            static constexpr uint32_t C_READY   = 1U;
+            static constexpr int64_t C_NO_OWNER = 0;
+            //--------------------------
+            static_assert(std::atomic<Offset>::is_always_lock_free, "shared slots need address-free atomics");
+            static_assert(std::atomic<int64_t>::is_always_lock_free, "shared slots need address-free atomics");
+            static_assert(std::atomic<uint32_t>::is_always_lock_free, "shared header needs address-free atomics");
+            //--------------------------
+            std::byte* m_base;
+            size_t m_bytes;
+            Header* m_header;
+            Slot* m_slots;
+            RetireEntry* m_retired;
+            Reclaimer m_reclaimer;
+        //--------------------------------------------------------------
+    };// end class SharedHazardDomain
+    //--------------------------------------------------------------
+}// end namespace HazardSystem
+//--------------------------------------------------------------
@@ -0,0 +1,306 @@
+#pragma once
+//--------------------------------------------------------------
+// Standard C++ library
+//--------------------------------------------------------------
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <vector>
+#include <optional>
+#include <utility>
+#include <functional>
+#include <algorithm>
+#include <thread>
+//--------------------------------------------------------------
+// User Defined Headers
+//--------------------------------------------------------------
+#include "HazardPointerManager.hpp"
+#include "ProtectedPointer.hpp"
+#include "atomic_unique_ptr.hpp"
+//--------------------------------------------------------------
+namespace HazardSystem {
+    //--------------------------------------------------------------
+    // Copy-on-write map for read-dominated data (routing tables, feature flags).
+    //
+    // The current contents are an immutable Snapshot, a flat vector sorted by
+    // key, published through atomic_unique_ptr. A reader protects the snapshot
+    // once and then does plain binary searches, so a lookup costs one hazard
+    // publication however large the map is. A writer copies the snapshot,
+    // applies a Batch of updates, and swaps the new version in by CAS. The
+    // replaced version is retired through HazardPointerManager<Snapshot>. A
+    // writer that loses the CAS rebuilds from the winner's version, so group
+    // updates into one Batch rather than committing them one by one.
+    //--------------------------------------------------------------
+    template<typename Key, typename Value, typename Compare = std::less<Key>>
+    class SnapshotMap {
+        public:
+            //--------------------------------------------------------------
+            using value_type = std::pair<Key, Value>;
+            //--------------------------------------------------------------
+            class Snapshot {
+                public:
+                    //--------------------------
+                    using const_iterator = typename std::vector<value_type>::const_iterator;
+                    //--------------------------
+                    const Value* find(const Key& key) const {
+                        //--------------------------
+                        const auto _it = lower_bound(key);
+                        if (_it == m_entries.end() or Compare{}(key, _it->first)) {
+                            return nullptr;
+                        }// end if (_it == m_entries.end() or Compare{}(key, _it->first))
+                        return &_it->second;
+                        //--------------------------
+                    }// end const Value* find(const Key& key) const
+                    //--------------------------
+                    bool contains(const Key& key) const {
+                        return find(key) != nullptr;
+                    }// end bool contains(const Key& key) const
+                    //--------------------------
+                    size_t size(void) const {
+                        return m_entries.size();
+                    }// end size_t size(void) const
+                    //--------------------------
+                    bool empty(void) const {
+                        return m_entries.empty();
+                    }// end bool empty(void) const
+                    //--------------------------
+                    // Bumped by every commit; lets readers tell two snapshots apart.
+                    uint64_t version(void) const {
+                        return m_version;
+                    }// end uint64_t version(void) const
+                    //--------------------------
+                    const_iterator begin(void) const {
+                        return m_entries.begin();
+                    }// end const_iterator begin(void) const
+                    //--------------------------
+                    const_iterator end(void) const {
+                        return m_entries.end();
+                    }// end const_iterator end(void) const
+                    //--------------------------
+                private:
+                    //--------------------------
+                    friend class SnapshotMap;
+                    //--------------------------
+                    Snapshot(std::vector<value_type> entries, const uint64_t& version) :    m_entries(std::move(entries)),
+                                                                                            m_version(version) {
+                        //--------------------------
+                    }// end Snapshot(std::vector<value_type> entries, const uint64_t& version)
+                    //--------------------------
+                    const_iterator lower_bound(const Key& key) const {
+                        return std::lower_bound(m_entries.begin(), m_entries.end(), key,
+                                                [](const value_type& entry, const Key& k) { return Compare{}(entry.first, k); });
+                    }// end const_iterator lower_bound(const Key& key) const
+                    //--------------------------
+                    const std::vector<value_type> m_entries;
+                    const uint64_t m_version;
+                    //--------------------------
+            };// end class Snapshot
+            //--------------------------------------------------------------
+            // Updates applied together by commit(); for a repeated key the last one wins.
+            class Batch {
+                public:
+                    //--------------------------
+                    void insert_or_assign(const Key& key, Value value) {
+                        m_operations.emplace_back(key, std::move(value));
+                    }// end void insert_or_assign(const Key& key, Value value)
+                    //--------------------------
+                    void erase(const Key& key) {
+                        m_operations.emplace_back(key, std::nullopt);
+                    }// end void erase(const Key& key)
+                    //--------------------------
+                    size_t size(void) const {
+                        return m_operations.size();
+                    }// end size_t size(void) const
+                    //--------------------------
+                    bool empty(void) const {
+                        return m_operations.empty();
+                    }// end bool empty(void) const
+                    //--------------------------
+                    void clear(void) {
+                        m_operations.clear();
+                    }// end void clear(void)
+                    //--------------------------
+                private:
+                    //--------------------------
+                    friend class SnapshotMap;
+                    //--------------------------
+                    std::vector<std::pair<Key, std::optional<Value>>> m_operations;
+                    //--------------------------
+            };// end class Batch
+            //--------------------------------------------------------------
+            using Manager = HazardPointerManager<Snapshot>;
+            //--------------------------------------------------------------
+            // readers sizes the snapshot manager shared by every map of these
+            // types, on first use only; writers count as readers while they copy.
+            explicit SnapshotMap(const size_t& readers = C_DEFAULT_READERS) : SnapshotMap(std::vector<value_type>{}, readers) {
+                //--------------------------
+            }// end explicit SnapshotMap(const size_t& readers)
+            //--------------------------
+            explicit SnapshotMap(   std::vector<value_type> entries,
+                                    const size_t& readers = C_DEFAULT_READERS) :    m_manager(Manager::instance(std::max<size_t>(1UL, readers))),
+                                                                                    m_current(new Snapshot(sorted(std::move(entries)), 0UL)) {
+                //--------------------------
+            }// end explicit SnapshotMap(std::vector<value_type> entries, const size_t& readers)
+            //--------------------------
+            SnapshotMap(const SnapshotMap&)             = delete;
+            SnapshotMap& operator=(const SnapshotMap&)  = delete;
+            SnapshotMap(SnapshotMap&&)                  = delete;
+            SnapshotMap& operator=(SnapshotMap&&)       = delete;
+            //--------------------------
+            ~SnapshotMap(void) = default;
+            //--------------------------
+            // The current version, held until the returned pointer is dropped.
+            // Empty only when no hazard slot is free: a racing commit cannot make
+            // it give up.
+            ProtectedPointer<Snapshot> snapshot(void) const {
+                return m_current.wait_free_protect();
+            }// end ProtectedPointer<Snapshot> snapshot(void) const
+            //--------------------------
+            std::optional<Value> get(const Key& key) const {
+                return get_data(key);
+            }// end std::optional<Value> get(const Key& key) const
+            //--------------------------
+            bool contains(const Key& key) const {
+                auto _snapshot = snapshot();
+                return _snapshot and _snapshot->contains(key);
+            }// end bool contains(const Key& key) const
+            //--------------------------
+            // Single-update commits; each one copies the whole map.
+            uint64_t insert_or_assign(const Key& key, Value value) {
+                Batch _batch;
+                _batch.insert_or_assign(key, std::move(value));
+                return commit_data(_batch);
+            }// end uint64_t insert_or_assign(const Key& key, Value value)
+            //--------------------------
+            uint64_t erase(const Key& key) {
+                Batch _batch;
+                _batch.erase(key);
+                return commit_data(_batch);
+            }// end uint64_t erase(const Key& key)
+            //--------------------------
+            // Publishes one new version with every update in batch; returns its version.
+            uint64_t commit(const Batch& batch) {
+                return commit_data(batch);
+            }// end uint64_t commit(const Batch& batch)
+            //--------------------------
+            size_t size(void) const {
+                auto _snapshot = snapshot();
+                return _snapshot ? _snapshot->size() : 0UL;
+            }// end size_t size(void) const
+            //--------------------------
+            uint64_t version(void) const {
+                auto _snapshot = snapshot();
+                return _snapshot ? _snapshot->version() : 0UL;
+            }// end uint64_t version(void) const
+            //--------------------------------------------------------------
+        protected:
+            //--------------------------------------------------------------
+            std::optional<Value> get_data(const Key& key) const {
+                //--------------------------
+                auto _snapshot = snapshot();
+                if (!_snapshot) {
+                    return std::nullopt;
+                }// end if (!_snapshot)
+                //--------------------------
+                const Value* _value = _snapshot->find(key);
+                return _value ? std::optional<Value>(*_value) : std::nullopt;
+                //--------------------------
+            }// end std::optional<Value> get_data(const Key& key) const
+            //--------------------------
+            uint64_t commit_data(const Batch& batch) {
+                //--------------------------
+                const std::vector<std::pair<Key, std::optional<Value>>> _operations = last_per_key(batch);
+                //--------------------------
+                while (true) {
+                    //--------------------------
+                    // Protected: a racing writer may retire this version while we copy it.
+                    auto _current = snapshot();
+                    if (!_current) {
+                        std::this_thread::yield();
+                        continue;
+                    }// end if (!_current)
+                    //--------------------------
+                    auto* _next         = new Snapshot(merge(_current->m_entries, _operations), _current->version() + 1UL);
+                    Snapshot* _expected = _current.get();
+                    //--------------------------
+                    if (m_current.compare_exchange_strong(_expected, _next)) {
+                        m_manager.retire(_current.get());
+                        return _next->version();
+                    }// end if (m_current.compare_exchange_strong(_expected, _next))
+                    //--------------------------
+                    delete _next;
+                    //--------------------------
+                }// end while (true)
+                //--------------------------
+            }// end uint64_t commit_data(const Batch& batch)
+            //--------------------------
+            // Sorted by key, one operation per key (the last one issued).
+            static std::vector<std::pair<Key, std::optional<Value>>> last_per_key(const Batch& batch) {
+                //--------------------------
+                std::vector<std::pair<Key, std::optional<Value>>> _operations = batch.m_operations;
+                std::stable_sort(_operations.begin(), _operations.end(),
+                                 [](const auto& a, const auto& b) { return Compare{}(a.first, b.first); });
+                //--------------------------
+                std::vector<std::pair<Key, std::optional<Value>>> _last;
+                _last.reserve(_operations.size());
+                for (auto& operation : _operations) {
+                    if (!_last.empty() and !Compare{}(_last.back().first, operation.first)) {
+                        _last.back() = std::move(operation);
+                    } else {
+                        _last.push_back(std::move(operation));
+                    }// end if (!_last.empty() and !Compare{}(_last.back().first, operation.first))
+                }// end for (auto& operation : _operations)
+                return _last;
+                //--------------------------
+            }// end static std::vector<std::pair<Key, std::optional<Value>>> last_per_key(const Batch& batch)
+            //--------------------------
+            static std::vector<value_type> merge(const std::vector<value_type>& entries, const std::vector<std::pair<Key, std::optional<Value>>>& operations) {
+                //--------------------------
+                std::vector<value_type> _merged;
+                _merged.reserve(entries.size() + operations.size());
+                //--------------------------
+                auto _entry     = entries.begin();
+                auto _operation = operations.begin();
+                while (_entry != entries.end() or _operation != operations.end()) {
+                    //--------------------------
+                    if (_operation == operations.end() or (_entry != entries.end() and Compare{}(_entry->first, _operation->first))) {
+                        _merged.push_back(*_entry++);
+                        continue;
+                    }// end if (keep the existing entry)
+                    //--------------------------
+                    // Equal keys: the operation replaces (or drops) the entry.
+                    if (_entry != entries.end() and !Compare{}(_operation->first, _entry->first)) {
+                        ++_entry;
+                    }// end if (_entry != entries.end() and !Compare{}(_operation->first, _entry->first))
+                    if (_operation->second) {
+                        _merged.emplace_back(_operation->first, _operation->second.value());
+                    }// end if (_operation->second)
+                    ++_operation;
+                    //--------------------------
+                }// end while (_entry != entries.end() or _operation != operations.end())
+                //--------------------------
+                return _merged;
+                //--------------------------
+            }// end static std::vector<value_type> merge(...)
+            //--------------------------
+            static std::vector<value_type> sorted(std::vector<value_type> entries) {
+                //--------------------------
+                Batch _batch;
+                for (auto& entry : entries) {
+                    _batch.insert_or_assign(entry.first, std::move(entry.second));
+                }// end for (auto& entry : entries)
+                return merge({}, last_per_key(_batch));
+                //--------------------------
+            }// end static std::vector<value_type> sorted(std::vector<value_type> entries)
+            //--------------------------------------------------------------
+        private:
+            //--------------------------------------------------------------
+            static constexpr size_t C_DEFAULT_READERS = 64UL;
+            //--------------------------
+            Manager& m_manager;
+            atomic_unique_ptr<Snapshot> m_current;
+        //--------------------------------------------------------------
+    };// end class SnapshotMap
+    //--------------------------------------------------------------
+}// end namespace HazardSystem
+//--------------------------------------------------------------
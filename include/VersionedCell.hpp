@@ -0,0 +1,240 @@
+#pragma once
+//--------------------------------------------------------------
+// Standard cpp library
+//--------------------------------------------------------------
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+//--------------------------------------------------------------
+// User Defined Headers
+//--------------------------------------------------------------
+#include "Backoff.hpp"
+//--------------------------------------------------------------
+namespace HazardSystem {
+    //--------------------------------------------------------------
+    // Seqlock cell for small trivially copyable values (a quote, a counter
+    // snapshot). Readers copy the value between two reads of a sequence counter
+    // and retry if a writer ran in between, so nothing is published, retired or
+    // allocated. Writers take the counter to odd, copy, and take it back to even;
+    // they serialize on that CAS.
+    //
+    // The read and update calls mirror atomic_unique_ptr: protect() returns a
+    // snapshot with -> and *, store()/operator= replace the value. Code written
+    // against one can switch to the other by T's size. Past a few cache lines the
+    // copy (and the retry window) costs more than one hazard publication;
+    // VersionedCell_Benchmark shows where.
+    //
+    // The payload is kept as relaxed atomic words rather than a plain T, so the
+    // concurrent copy is not a data race.
+    //--------------------------------------------------------------
+    template <typename T>
+    requires std::is_trivially_copyable_v<T> and std::is_default_constructible_v<T>
+    class VersionedCell {
+        private:
+            //--------------------------------------------------------------
+            static constexpr size_t C_WORDS = (sizeof(T) + sizeof(uint64_t) - 1UL) / sizeof(uint64_t);
+            //--------------------------------------------------------------
+        public:
+            //--------------------------------------------------------------
+            // A copy that reads like a ProtectedPointer; it owns its value, so it
+            // stays valid however long it is kept.
+            class Snapshot {
+                public:
+                    //--------------------------
+                    explicit Snapshot(const T& value) : m_value(value) {
+                        //--------------------------
+                    }// end explicit Snapshot(const T& value)
+                    //--------------------------
+                    const T* operator->(void) const noexcept {
+                        return &m_value;
+                    }// end const T* operator->(void) const noexcept
+                    //--------------------------
+                    const T& operator*(void) const noexcept {
+                        return m_value;
+                    }// end const T& operator*(void) const noexcept
+                    //--------------------------
+                    const T* get(void) const noexcept {
+                        return &m_value;
+                    }// end const T* get(void) const noexcept
+                    //--------------------------
+                    explicit operator bool(void) const noexcept {
+                        return true;
+                    }// end explicit operator bool(void) const noexcept
+                    //--------------------------
+                private:
+                    //--------------------------
+                    T m_value;
+                    //--------------------------
+            };// end class Snapshot
+            //--------------------------------------------------------------
+            VersionedCell(void) noexcept : VersionedCell(T{}) {
+                //--------------------------
+            } // end VersionedCell(void) noexcept
+            //--------------------------
+            explicit VersionedCell(const T& value) noexcept : m_sequence(0UL) {
+                //--------------------------
+                write_words(value);
+                //--------------------------
+            } // end explicit VersionedCell(const T& value) noexcept
+            //--------------------------
+            VersionedCell(const VersionedCell&)             = delete;
+            VersionedCell& operator=(const VersionedCell&)  = delete;
+            VersionedCell(VersionedCell&&)                  = delete;
+            VersionedCell& operator=(VersionedCell&&)       = delete;
+            //--------------------------
+            ~VersionedCell(void) = default;
+            //--------------------------
+            VersionedCell& operator=(const T& value) noexcept {
+                store_data(value);
+                return *this;
+            } // end VersionedCell& operator=(const T& value) noexcept
+            //--------------------------
+            // Always true; kept for atomic_unique_ptr's bool store().
+            bool store(const T& value) noexcept {
+                store_data(value);
+                return true;
+            } // end bool store(const T& value) noexcept
+            //--------------------------
+            T load(void) const noexcept {
+                return load_data();
+            } // end T load(void) const noexcept
+            //--------------------------
+            // Single attempt: false if a writer was active, out is then unspecified.
+            bool try_load(T& out) const noexcept {
+                return try_load_data(out);
+            } // end bool try_load(T& out) const noexcept
+            //--------------------------
+            Snapshot protect(void) const noexcept {
+                return Snapshot(load_data());
+            } // end Snapshot protect(void) const noexcept
+            //--------------------------
+            // Read-modify-write under the writer side: fn(T&) edits a copy that is
+            // then published. Returns the new value. If fn throws, the cell keeps
+            // its old value and is unlocked.
+            template <typename Func>
+            T update(Func&& fn) {
+                return update_data(std::forward<Func>(fn));
+            } // end T update(Func&& fn)
+            //--------------------------
+            // Even and bumped by 2 per store.
+            uint64_t version(void) const noexcept {
+                return m_sequence.load(std::memory_order_acquire);
+            } // end uint64_t version(void) const noexcept
+            //--------------------------------------------------------------
+        protected:
+            //--------------------------------------------------------------
+            bool try_load_data(T& out) const noexcept {
+                //--------------------------
+                const uint64_t _before = m_sequence.load(std::memory_order_acquire);
+                if (_before & 1UL) {
+                    return false;
+                }// end if (_before & 1UL)
+                //--------------------------
+                std::array<uint64_t, C_WORDS> _words;
+                for (size_t i = 0; i < C_WORDS; ++i) {
+                    _words[i] = m_words[i].load(std::memory_order_relaxed);
+                }// end for (size_t i = 0; i < C_WORDS; ++i)
+                // Orders the word loads before the second counter read.
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (m_sequence.load(std::memory_order_relaxed) != _before) {
+                    return false;
+                }// end if (m_sequence.load(std::memory_order_relaxed) != _before)
+                //--------------------------
+                std::memcpy(&out, _words.data(), sizeof(T));
+                return true;
+                //--------------------------
+            } // end bool try_load_data(T& out) const noexcept
+            //--------------------------
+            T load_data(void) const noexcept {
+                //--------------------------
+                T _value;
+                Backoff _backoff;
+                while (!try_load_data(_value)) {
+                    _backoff.pause();
+                }// end while (!try_load_data(_value))
+                return _value;
+                //--------------------------
+            } // end T load_data(void) const noexcept
+            //--------------------------
+            void store_data(const T& value) noexcept {
+                //--------------------------
+                const uint64_t _sequence = lock();
+                write_words(value);
+                unlock(_sequence);
+                //--------------------------
+            } // end void store_data(const T& value) noexcept
+            //--------------------------
+            template <typename Func>
+            T update_data(Func&& fn) {
+                //--------------------------
+                // Unlocks however fn leaves: if it throws, nothing has been written
+                // and the counter still goes back to even.
+                struct Unlock {
+                    VersionedCell* cell;
+                    uint64_t sequence;
+                    ~Unlock(void) {
+                        cell->unlock(sequence);
+                    }// end ~Unlock(void)
+                };// end struct Unlock
+                const Unlock _unlock{this, lock()};
+                //--------------------------
+                // The lock excludes other writers, so the words read here are stable.
+                std::array<uint64_t, C_WORDS> _words;
+                for (size_t i = 0; i < C_WORDS; ++i) {
+                    _words[i] = m_words[i].load(std::memory_order_relaxed);
+                }// end for (size_t i = 0; i < C_WORDS; ++i)
+                T _value;
+                std::memcpy(&_value, _words.data(), sizeof(T));
+                fn(_value);
+                write_words(_value);
+                //--------------------------
+                return _value;
+                //--------------------------
+            } // end T update_data(Func&& fn)
+            //--------------------------------------------------------------
+        private:
+            //--------------------------------------------------------------
+            // Takes the counter from even s to s + 1 and returns s.
+            uint64_t lock(void) noexcept {
+                //--------------------------
+                Backoff _backoff;
+                uint64_t _sequence = m_sequence.load(std::memory_order_relaxed);
+                while (true) {
+                    if (!(_sequence & 1UL) and
+                        m_sequence.compare_exchange_weak(_sequence, _sequence + 1UL, std::memory_order_acquire, std::memory_order_relaxed)) {
+                        break;
+                    }// end if (!(_sequence & 1UL) and ...)
+                    _backoff.pause();
+                    _sequence = m_sequence.load(std::memory_order_relaxed);
+                }// end while (true)
+                // Readers that see any of the new words must also see the odd counter.
+                std::atomic_thread_fence(std::memory_order_release);
+                return _sequence;
+                //--------------------------
+            } // end uint64_t lock(void) noexcept
+            //--------------------------
+            void unlock(const uint64_t& sequence) noexcept {
+                m_sequence.store(sequence + 2UL, std::memory_order_release);
+            } // end void unlock(const uint64_t& sequence) noexcept
+            //--------------------------
+            void write_words(const T& value) noexcept {
+                //--------------------------
+                std::array<uint64_t, C_WORDS> _words{};
+                std::memcpy(_words.data(), &value, sizeof(T));
+                for (size_t i = 0; i < C_WORDS; ++i) {
+                    m_words[i].store(_words[i], std::memory_order_relaxed);
+                }// end for (size_t i = 0; i < C_WORDS; ++i)
+                //--------------------------
+            } // end void write_words(const T& value) noexcept
+            //--------------------------
+            std::atomic<uint64_t> m_sequence;
+            std::array<std::atomic<uint64_t>, C_WORDS> m_words;
+        //--------------------------------------------------------------
+    }; // end class VersionedCell
+    //--------------------------------------------------------------
+} // end namespace HazardSystem
+//--------------------------------------------------------------
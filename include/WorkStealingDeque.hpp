@@ -0,0 +1,210 @@
+#pragma once
+//--------------------------------------------------------------
+// Standard C++ library
+//--------------------------------------------------------------
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <algorithm>
+#include <bit>
+//--------------------------------------------------------------
+// User Defined Headers
+//--------------------------------------------------------------
+#include "HazardPointerManager.hpp"
+//--------------------------------------------------------------
+namespace HazardSystem {
+    //--------------------------------------------------------------
+    // Chase-Lev work-stealing deque (the C11 formulation of Le et al.).
+    //
+    // The owner thread pushes and pops at the bottom; any thread may steal from
+    // the top. When the circular buffer fills, the owner copies the live range
+    // into one twice the size and retires the old buffer through
+    // HazardPointerManager. Thieves protect the buffer they read from, so an old
+    // buffer is only freed once every steal that could still index it is done.
+    //
+    // T is copied in and out of atomic cells, so it must be trivially copyable
+    // (task pointers, indices, small handles).
+    //--------------------------------------------------------------
+    template<typename T>
+    class WorkStealingDeque {
+        //--------------------------------------------------------------
+        static_assert(std::is_trivially_copyable_v<T>, "WorkStealingDeque requires a trivially copyable T");
+        //--------------------------------------------------------------
+        public:
+            //--------------------------------------------------------------
+            struct Buffer {
+                //--------------------------
+                explicit Buffer(const int64_t& capacity_) : capacity(capacity_),
+                                                            mask(capacity_ - 1),
+                                                            cells(std::make_unique<std::atomic<T>[]>(static_cast<size_t>(capacity_))) {
+                    //--------------------------
+                }// end explicit Buffer(const int64_t& capacity_)
+                //--------------------------
+                T get(const int64_t& index) const {
+                    return cells[static_cast<size_t>(index & mask)].load(std::memory_order_relaxed);
+                }// end T get(const int64_t& index) const
+                //--------------------------
+                void put(const int64_t& index, const T& value) {
+                    cells[static_cast<size_t>(index & mask)].store(value, std::memory_order_relaxed);
+                }// end void put(const int64_t& index, const T& value)
+                //--------------------------
+                const int64_t capacity;
+                const int64_t mask;
+                std::unique_ptr<std::atomic<T>[]> cells;
+                //--------------------------
+            };// end struct Buffer
+            //--------------------------------------------------------------
+            using Manager = HazardPointerManager<Buffer, 0>;
+            //--------------------------------------------------------------
+            // thieves sizes the buffer manager shared by every deque of this T, on
+            // first use only; a steal that finds no free hazard slot reports empty,
+            // like a lost race.
+            explicit WorkStealingDeque( const size_t& capacity = 64UL,
+                                        const size_t& thieves = C_DEFAULT_THIEVES) :  m_top(0),
+                                                                                      m_bottom(0),
+                                                                                      m_buffer(new Buffer(capacity_size(capacity))),
+                                                                                      m_manager(Manager::instance(std::max<size_t>(1UL, thieves))) {
+                //--------------------------
+            }// end explicit WorkStealingDeque(const size_t& capacity, const size_t& thieves)
+            //--------------------------
+            WorkStealingDeque(const WorkStealingDeque&)             = delete;
+            WorkStealingDeque& operator=(const WorkStealingDeque&)  = delete;
+            WorkStealingDeque(WorkStealingDeque&&)                  = delete;
+            WorkStealingDeque& operator=(WorkStealingDeque&&)       = delete;
+            //--------------------------
+            // No thief may still be running; earlier buffers stay with the manager.
+            ~WorkStealingDeque(void) {
+                delete m_buffer.load(std::memory_order_relaxed);
+            }// end ~WorkStealingDeque(void)
+            //--------------------------
+            // Owner only.
+            void push(const T& value) {
+                push_data(value);
+            }// end void push(const T& value)
+            //--------------------------
+            // Owner only: newest item first.
+            std::optional<T> pop(void) {
+                return pop_data();
+            }// end std::optional<T> pop(void)
+            //--------------------------
+            // Any thread: oldest item first. Empty also on a lost race.
+            std::optional<T> steal(void) {
+                return steal_data();
+            }// end std::optional<T> steal(void)
+            //--------------------------
+            size_t size(void) const {
+                const int64_t _bottom = m_bottom.load(std::memory_order_relaxed);
+                const int64_t _top    = m_top.load(std::memory_order_relaxed);
+                return _bottom > _top ? static_cast<size_t>(_bottom - _top) : 0UL;
+            }// end size_t size(void) const
+            //--------------------------
+            bool empty(void) const {
+                return size() == 0UL;
+            }// end bool empty(void) const
+            //--------------------------
+            size_t capacity(void) const {
+                return static_cast<size_t>(m_buffer.load(std::memory_order_relaxed)->capacity);
+            }// end size_t capacity(void) const
+            //--------------------------------------------------------------
+        protected:
+            //--------------------------------------------------------------
+            void push_data(const T& value) {
+                //--------------------------
+                const int64_t _bottom = m_bottom.load(std::memory_order_relaxed);
+                const int64_t _top    = m_top.load(std::memory_order_acquire);
+                Buffer* _buffer       = m_buffer.load(std::memory_order_relaxed);
+                //--------------------------
+                if (_bottom - _top > _buffer->capacity - 1) {
+                    _buffer = grow(_buffer, _top, _bottom);
+                }// end if (_bottom - _top > _buffer->capacity - 1)
+                //--------------------------
+                _buffer->put(_bottom, value);
+                std::atomic_thread_fence(std::memory_order_release);
+                m_bottom.store(_bottom + 1, std::memory_order_relaxed);
+                //--------------------------
+            }// end void push_data(const T& value)
+            //--------------------------
+            std::optional<T> pop_data(void) {
+                //--------------------------
+                const int64_t _bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+                Buffer* _buffer       = m_buffer.load(std::memory_order_relaxed);
+                m_bottom.store(_bottom, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                int64_t _top          = m_top.load(std::memory_order_relaxed);
+                //--------------------------
+                if (_top > _bottom) {
+                    m_bottom.store(_bottom + 1, std::memory_order_relaxed);
+                    return std::nullopt;
+                }// end if (_top > _bottom)
+                //--------------------------
+                std::optional<T> _value = _buffer->get(_bottom);
+                if (_top == _bottom) {
+                    // Last item: race the thieves for it.
+                    if (!m_top.compare_exchange_strong(_top, _top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                        _value.reset();
+                    }// end if (!m_top.compare_exchange_strong(...))
+                    m_bottom.store(_bottom + 1, std::memory_order_relaxed);
+                }// end if (_top == _bottom)
+                //--------------------------
+                return _value;
+                //--------------------------
+            }// end std::optional<T> pop_data(void)
+            //--------------------------
+            std::optional<T> steal_data(void) {
+                //--------------------------
+                int64_t _top = m_top.load(std::memory_order_acquire);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                const int64_t _bottom = m_bottom.load(std::memory_order_acquire);
+                //--------------------------
+                if (_top >= _bottom) {
+                    return std::nullopt;
+                }// end if (_top >= _bottom)
+                //--------------------------
+                // Holds the buffer against a concurrent grow-and-retire while we read.
+                auto _buffer = m_manager.protect(m_buffer);
+                if (!_buffer) {
+                    return std::nullopt;
+                }// end if (!_buffer)
+                //--------------------------
+                const T _value = _buffer->get(_top);
+                if (!m_top.compare_exchange_strong(_top, _top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                    return std::nullopt;
+                }// end if (!m_top.compare_exchange_strong(...))
+                //--------------------------
+                return _value;
+                //--------------------------
+            }// end std::optional<T> steal_data(void)
+            //--------------------------
+            Buffer* grow(Buffer* old_buffer, const int64_t& top, const int64_t& bottom) {
+                //--------------------------
+                auto* _buffer = new Buffer(old_buffer->capacity * 2);
+                for (int64_t i = top; i < bottom; ++i) {
+                    _buffer->put(i, old_buffer->get(i));
+                }// end for (int64_t i = top; i < bottom; ++i)
+                //--------------------------
+                m_buffer.store(_buffer, std::memory_order_release);
+                m_manager.retire(old_buffer);
+                return _buffer;
+                //--------------------------
+            }// end Buffer* grow(Buffer* old_buffer, const int64_t& top, const int64_t& bottom)
+            //--------------------------
+            static int64_t capacity_size(const size_t& requested) {
+                return static_cast<int64_t>(std::bit_ceil(std::max<size_t>(2UL, requested)));
+            }// end static int64_t capacity_size(const size_t& requested)
+            //--------------------------------------------------------------
+        private:
+            //--------------------------------------------------------------
+            static constexpr size_t C_DEFAULT_THIEVES = 64UL;
+            //--------------------------
+            alignas(64) std::atomic<int64_t> m_top;
+            alignas(64) std::atomic<int64_t> m_bottom;
+            alignas(64) std::atomic<Buffer*> m_buffer;
+            Manager& m_manager;
+        //--------------------------------------------------------------
+    };// end class WorkStealingDeque
+    //--------------------------------------------------------------
+}// end namespace HazardSystem
+//--------------------------------------------------------------
@@ -0,0 +1,163 @@
+#pragma once
+//--------------------------------------------------------------
+// Standard cpp library
+//--------------------------------------------------------------
+#include <atomic>
+#include <memory>
+#include <utility>
+//--------------------------------------------------------------
+// User Defined Headers
+//--------------------------------------------------------------
+#include "Backoff.hpp"
+#include "HazardPointerManager.hpp"
+#include "ProtectedPointer.hpp"
+//--------------------------------------------------------------
+namespace HazardSystem {
+    //--------------------------------------------------------------
+    // Shared-ownership publication point that lets readers borrow the object.
+    //
+    // HazardPointerManager::protect(const std::atomic<std::shared_ptr<T>>&)
+    // loads the shared_ptr twice. Each load bumps the refcount, and libstdc++
+    // also takes the atomic's internal lock. A third copy then sits in the
+    // ProtectedPointer. Here the owning shared_ptr is kept beside a raw mirror
+    // (m_ptr). protect() publishes and validates the raw pointer only, so a
+    // read never touches the control block.
+    //
+    // Writers hand the replaced owner to HazardPointerManager<T>::retire (the
+    // RetireMap SharedOwner deleter). The manager drops that reference once no
+    // hazard publishes the pointer, so a borrowed view stays valid even if it
+    // held the last reference. Writers serialize on a spin flag; they are
+    // expected to be rare next to reads.
+    //--------------------------------------------------------------
+    template <typename T>
+    class atomic_shared_ptr {
+        public:
+            //--------------------------------------------------------------
+            atomic_shared_ptr(void) noexcept :  m_ptr(nullptr),
+                                                m_writing(false),
+                                                m_owner(nullptr) {
+                //--------------------------
+            } // end atomic_shared_ptr(void) noexcept
+            //--------------------------
+            explicit atomic_shared_ptr(std::shared_ptr<T> ptr) noexcept :   m_ptr(ptr.get()),
+                                                                            m_writing(false),
+                                                                            m_owner(std::move(ptr)) {
+                //--------------------------
+            } // end explicit atomic_shared_ptr(std::shared_ptr<T> ptr) noexcept
+            //--------------------------
+            atomic_shared_ptr(const atomic_shared_ptr&)             = delete;
+            atomic_shared_ptr& operator=(const atomic_shared_ptr&)  = delete;
+            atomic_shared_ptr(atomic_shared_ptr&&)                  = delete;
+            atomic_shared_ptr& operator=(atomic_shared_ptr&&)       = delete;
+            //--------------------------
+            ~atomic_shared_ptr(void) {
+                //--------------------------
+                static_cast<void>(store_data(nullptr));
+                //--------------------------
+            } // end ~atomic_shared_ptr(void)
+            //--------------------------
+            explicit operator bool(void) const noexcept {
+                return get_data() != nullptr;
+            } // end explicit operator bool(void) const noexcept
+            //--------------------------
+            atomic_shared_ptr& operator=(std::shared_ptr<T> ptr) {
+                static_cast<void>(store_data(std::move(ptr)));
+                return *this;
+            } // end atomic_shared_ptr& operator=(std::shared_ptr<T> ptr)
+            //--------------------------
+            // Publishes ptr and retires the previous owner; false if there was none.
+            bool store(std::shared_ptr<T> ptr) {
+                return store_data(std::move(ptr));
+            } // end bool store(std::shared_ptr<T> ptr)
+            //--------------------------
+            bool reset(void) {
+                return store_data(nullptr);
+            } // end bool reset(void)
+            //--------------------------
+            // Unprotected raw pointer: fine for comparisons, not for dereferencing.
+            T* get(void) const noexcept {
+                return get_data();
+            } // end T* get(void) const noexcept
+            //--------------------------
+            // An owning copy; takes the writer flag and bumps the refcount.
+            std::shared_ptr<T> load(void) const {
+                return load_data();
+            } // end std::shared_ptr<T> load(void) const
+            //--------------------------
+            // Borrowed view: valid until the ProtectedPointer is released, without
+            // touching the refcount. Its shared_ptr() does not own; use load() to
+            // keep the object beyond the view.
+            ProtectedPointer<T> protect(const size_t max_retries = 100UL) const {
+                return protect_data(max_retries);
+            } // end ProtectedPointer<T> protect(const size_t max_retries) const
+            //--------------------------------------------------------------
+        protected:
+            //--------------------------------------------------------------
+            bool store_data(std::shared_ptr<T> ptr) {
+                //--------------------------
+                lock();
+                std::shared_ptr<T> _old = std::exchange(m_owner, std::move(ptr));
+                m_ptr.store(m_owner.get(), std::memory_order_release);
+                // Same object stored again: m_owner keeps it alive, nothing to defer.
+                const bool _same = _old.get() == m_owner.get();
+                unlock();
+                //--------------------------
+                if (!_old) {
+                    return false;
+                }// end if (!_old)
+                //--------------------------
+                if (!_same) {
+                    hp_manager().retire(std::move(_old));
+                }// end if (!_same)
+                return true;
+                //--------------------------
+            } // end bool store_data(std::shared_ptr<T> ptr)
+            //--------------------------
+            std::shared_ptr<T> load_data(void) const {
+                //--------------------------
+                lock();
+                std::shared_ptr<T> _owner = m_owner;
+                unlock();
+                return _owner;
+                //--------------------------
+            } // end std::shared_ptr<T> load_data(void) const
+            //--------------------------
+            T* get_data(void) const noexcept {
+                return m_ptr.load(std::memory_order_acquire);
+            } // end T* get_data(void) const noexcept
+            //--------------------------
+            void lock(void) const {
+                //--------------------------
+                Backoff _backoff;
+                while (m_writing.exchange(true, std::memory_order_acquire)) {
+                    _backoff.wait_while(m_writing, true, std::memory_order_relaxed);
+                }// end while (m_writing.exchange(true, std::memory_order_acquire))
+                //--------------------------
+            } // end void lock(void) const
+            //--------------------------
+            void unlock(void) const {
+                m_writing.store(false, std::memory_order_release);
+                m_writing.notify_one();
+            } // end void unlock(void) const
+            //--------------------------------------------------------------
+        private:
+            //--------------------------------------------------------------
+            // Cached for the same reason as in atomic_unique_ptr: instance()'s default
+            // argument reads sysfs.
+            HazardPointerManager<T>& hp_manager(void) const {
+                static HazardPointerManager<T>& manager = HazardPointerManager<T>::template instance<>();
+                return manager;
+            }// end HazardPointerManager<T>& hp_manager(void) const
+            //--------------------------
+            ProtectedPointer<T> protect_data(const size_t max_retries) const {
+                return hp_manager().try_protect(m_ptr, max_retries);
+            }// end ProtectedPointer<T> protect_data(const size_t max_retries) const
+            //--------------------------
+            std::atomic<T*> m_ptr;
+            mutable std::atomic<bool> m_writing;
+            std::shared_ptr<T> m_owner;
+        //--------------------------------------------------------------
+    }; // end class atomic_shared_ptr
+    //--------------------------------------------------------------
+} // end namespace HazardSystem
+//--------------------------------------------------------------
@@ -116,6 +116,12 @@ namespace HazardSystem {
                 return protect_data(max_retries);
             } // end ProtectedPointer<T> protect() const
             //--------------------------
+            // Never gives up while a hazard slot is free; see
+            // HazardPointerManager::wait_free_protect. T must be 4-byte aligned.
+            ProtectedPointer<T> wait_free_protect(void) const {
+                return hp_manager().wait_free_protect(m_ptr);
+            } // end ProtectedPointer<T> wait_free_protect(void) const
+            //--------------------------
             std::shared_ptr<T> shared(void) const noexcept {
                 return get_shared();
             } // end std::shared_ptr<T> get_shared(void)
@@ -290,8 +296,11 @@ namespace HazardSystem {
             //--------------------------------------------------------------
         private:
             //--------------------------------------------------------------
+            // Cached: instance()'s default size argument calls hardware_concurrency(),
+            // which reads sysfs and would otherwise cost more than the protect itself.
             HazardPointerManager<T>& hp_manager(void) const {
-                return HazardPointerManager<T>::template instance<>();
+                static HazardPointerManager<T>& manager = HazardPointerManager<T>::template instance<>();
+                return manager;
             }// end HazardPointerManager<T>& hp_manager(void) const
             //--------------------------
             ProtectedPointer<T> protect_data(const size_t max_retries) const {
@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <thread>
+#include <vector>
+#include "BPlusTree.hpp"
+
+using HazardSystem::BPlusTree;
+
+TEST(BPlusTreeTest, InsertFindErase) {
+    BPlusTree<uint64_t, uint64_t> tree;
+    EXPECT_TRUE(tree.empty());
+    EXPECT_FALSE(tree.find(1).has_value());
+    EXPECT_FALSE(tree.begin().valid());
+
+    EXPECT_TRUE(tree.insert_or_assign(5, 50));
+    EXPECT_TRUE(tree.insert_or_assign(1, 10));
+    EXPECT_TRUE(tree.insert_or_assign(3, 30));
+    EXPECT_FALSE(tree.insert_or_assign(3, 33));
+    EXPECT_EQ(tree.size(), 3u);
+
+    EXPECT_EQ(tree.find(1), 10u);
+    EXPECT_EQ(tree.find(3), 33u);
+    EXPECT_FALSE(tree.find(2).has_value());
+
+    EXPECT_TRUE(tree.erase(1));
+    EXPECT_FALSE(tree.erase(1));
+    EXPECT_FALSE(tree.contains(1));
+    EXPECT_EQ(tree.size(), 2u);
+
+    auto it = tree.lower_bound(2);
+    ASSERT_TRUE(it.valid());
+    EXPECT_EQ(it.key(), 3u);
+    ++it;
+    ASSERT_TRUE(it.valid());
+    EXPECT_EQ(it.key(), 5u);
+    EXPECT_EQ(it.value(), 50u);
+    ++it;
+    EXPECT_FALSE(it.valid());
+}
+
+TEST(BPlusTreeTest, MatchesOrderedMapThroughSplitsAndMerges) {
+    BPlusTree<uint64_t, uint64_t> tree;
+    std::map<uint64_t, uint64_t> reference;
+    std::mt19937_64 rng(11);
+
+    // Grow to a few levels, then erase most of it so leaves merge and the
+    // root steps down.
+    for (uint64_t i = 0; i < 50000; ++i) {
+        const uint64_t key = rng() % 200000;
+        EXPECT_EQ(tree.insert_or_assign(key, i), reference.insert_or_assign(key, i).second);
+    }
+    ASSERT_EQ(tree.size(), reference.size());
+
+    size_t seen = 0;
+    auto expected = reference.begin();
+    for (auto it = tree.begin(); it; ++it, ++expected, ++seen) {
+        ASSERT_NE(expected, reference.end());
+        EXPECT_EQ(it.key(), expected->first);
+        EXPECT_EQ(it.value(), expected->second);
+    }
+    EXPECT_EQ(seen, reference.size());
+
+    for (uint64_t key = 0; key < 200000; ++key) {
+        if (key % 97 != 0) {
+            EXPECT_EQ(tree.erase(key), reference.erase(key) == 1u);
+        }
+    }
+    ASSERT_EQ(tree.size(), reference.size());
+    for (const auto& [key, value] : reference) {
+        EXPECT_EQ(tree.find(key), value);
+    }
+
+    std::vector<uint64_t> scanned;
+    EXPECT_EQ(tree.scan(100000, 20, [&](const uint64_t& key, const uint64_t&) { scanned.push_back(key); }), std::min<size_t>(20u, std::distance(reference.lower_bound(100000), reference.end())));
+    auto from = reference.lower_bound(100000);
+    for (uint64_t key : scanned) {
+        EXPECT_EQ(key, (from++)->first);
+    }
+
+    for (const auto& [key, value] : reference) {
+        EXPECT_TRUE(tree.erase(key));
+    }
+    EXPECT_TRUE(tree.empty());
+    EXPECT_FALSE(tree.begin().valid());
+}
+
+TEST(BPlusTreeTest, ConcurrentWritersAndReaders) {
+    BPlusTree<uint64_t, uint64_t> tree;
+    constexpr uint64_t C_STABLE = 20000;
+
+    // Even keys stay put; writers churn odd keys around them, splitting and
+    // merging the leaves the readers are walking.
+    for (uint64_t i = 0; i < C_STABLE; ++i) {
+        tree.insert_or_assign(i * 2, i);
+    }
+
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> errors{0};
+    std::vector<std::thread> threads;
+    for (int w = 0; w < 2; ++w) {
+        threads.emplace_back([&, w] {
+            for (int round = 0; round < 4; ++round) {
+                for (uint64_t i = static_cast<uint64_t>(w); i < C_STABLE; i += 2) {
+                    tree.insert_or_assign(i * 2 + 1, i);
+                }
+                for (uint64_t i = static_cast<uint64_t>(w); i < C_STABLE; i += 2) {
+                    if (!tree.erase(i * 2 + 1)) {
+                        errors.fetch_add(1);
+                    }
+                }
+            }
+        });
+    }
+    for (int r = 0; r < 2; ++r) {
+        threads.emplace_back([&, r] {
+            std::mt19937_64 rng(r);
+            while (!stop.load(std::memory_order_relaxed)) {
+                const uint64_t i = rng() % C_STABLE;
+                if (tree.find(i * 2) != i) {
+                    errors.fetch_add(1);
+                }
+                // Every even key in range shows up once, in order.
+                uint64_t next = i * 2;
+                tree.scan(i * 2, 300, [&](const uint64_t& key, const uint64_t&) {
+                    if (key % 2 == 0) {
+                        if (key != next) {
+                            errors.fetch_add(1);
+                        }
+                        next = key + 2;
+                    }
+                });
+            }
+        });
+    }
+
+    for (int w = 0; w < 2; ++w) {
+        threads[w].join();
+    }
+    stop.store(true);
+    for (size_t t = 2; t < threads.size(); ++t) {
+        threads[t].join();
+    }
+
+    EXPECT_EQ(errors.load(), 0u);
+    EXPECT_EQ(tree.size(), C_STABLE);
+    BPlusTree<uint64_t, uint64_t>::Manager::instance().reclaim_all();
+}
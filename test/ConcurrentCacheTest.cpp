@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ConcurrentCache.hpp"
+
+using HazardSystem::ConcurrentCache;
+
+TEST(ConcurrentCacheTest, PutGetReplaceErase) {
+    ConcurrentCache<int, std::string> cache(8);
+    EXPECT_FALSE(cache.get(1).has_value());
+
+    cache.put(1, "one");
+    cache.put(2, 3, 'x');
+    EXPECT_EQ(cache.get(1).value_or(""), "one");
+    EXPECT_EQ(cache.get(2).value_or(""), "xxx");
+    EXPECT_EQ(cache.size(), 2u);
+
+    cache.put(1, "uno");
+    EXPECT_EQ(cache.get(1).value_or(""), "uno");
+    EXPECT_EQ(cache.size(), 2u);
+
+    EXPECT_TRUE(cache.erase(1));
+    EXPECT_FALSE(cache.erase(1));
+    EXPECT_FALSE(cache.contains(1));
+    EXPECT_TRUE(cache.contains(2));
+    EXPECT_EQ(cache.size(), 1u);
+}
+
+TEST(ConcurrentCacheTest, NeverExceedsCapacity) {
+    ConcurrentCache<int, int> cache(16);
+    for (int i = 0; i < 1000; ++i) {
+        cache.put(i, i);
+    }
+    EXPECT_EQ(cache.size(), 16u);
+
+    int resident = 0;
+    for (int i = 0; i < 1000; ++i) {
+        if (auto value = cache.get(i)) {
+            EXPECT_EQ(*value, i);
+            ++resident;
+        }
+    }
+    EXPECT_EQ(resident, 16);
+    // The most recent insert always survives its own put.
+    EXPECT_TRUE(cache.contains(999));
+}
+
+TEST(ConcurrentCacheTest, ReferencedEntriesSurviveTheClock) {
+    ConcurrentCache<int, int> cache(4);
+    for (int i = 0; i < 4; ++i) {
+        cache.put(i, i);
+    }
+    // The first eviction sweeps every fresh entry's bit clear; from then on the
+    // entry read before each put keeps getting passed over.
+    cache.put(100, 100);
+    const int hot = cache.contains(0) ? 0 : 1;
+    for (int round = 0; round < 20; ++round) {
+        ASSERT_TRUE(cache.get(hot).has_value()) << "round " << round;
+        cache.put(200 + round, round);
+    }
+}
+
+TEST(ConcurrentCacheTest, EvictedEntriesAreReclaimed) {
+    static std::atomic<int> alive{0};
+    struct Tracked {
+        explicit Tracked(int) { ++alive; }
+        Tracked(const Tracked&) { ++alive; }
+        ~Tracked(void) { --alive; }
+    };
+    {
+        ConcurrentCache<int, Tracked> cache(8);
+        for (int i = 0; i < 200; ++i) {
+            cache.put(i, i);
+        }
+    }
+    ConcurrentCache<int, Tracked>::Manager::instance().reclaim_all();
+    EXPECT_EQ(alive.load(), 0);
+}
+
+TEST(ConcurrentCacheTest, ConcurrentReadersAndWriters) {
+    constexpr int C_KEYS    = 512;
+    constexpr int C_THREADS = 6;
+    ConcurrentCache<int, std::string, 256> cache(128, C_THREADS);
+    std::atomic<int> wrong{0};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < C_THREADS; ++t) {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < 20000; ++i) {
+                const int key = (i * 7 + t * 131) % C_KEYS;
+                if (i % 4 == 0) {
+                    cache.put(key, std::to_string(key));
+                } else if (auto value = cache.get(key)) {
+                    wrong += (*value != std::to_string(key));
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(wrong.load(), 0);
+    EXPECT_LE(cache.size(), cache.capacity());
+}
+
+TEST(ConcurrentCacheTest, IndexStaysBoundedUnderEvictionChurn) {
+    constexpr int C_THREADS = 4;
+    constexpr int C_PUTS    = 20000;
+    ConcurrentCache<int, int, 64> cache(32, C_THREADS);
+
+    // Every put is a new key, so every put past the first 32 evicts.
+    std::vector<std::thread> threads;
+    for (int t = 0; t < C_THREADS; ++t) {
+        threads.emplace_back([&cache, t] {
+            for (int i = 0; i < C_PUTS; ++i) {
+                cache.put(t * C_PUTS + i, i);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(cache.size(), cache.capacity());
+    EXPECT_LE(cache.index_size(), cache.capacity());
+}
@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+#include "ConcurrentPriorityQueue.hpp"
+
+using HazardSystem::ConcurrentPriorityQueue;
+
+TEST(ConcurrentPriorityQueueTest, PopsInKeyOrder) {
+    ConcurrentPriorityQueue<int, int> queue;
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.pop().has_value());
+
+    std::vector<int> keys(200);
+    for (int i = 0; i < 200; ++i) {
+        keys[i] = i / 2; // duplicates are kept
+    }
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(7));
+    for (int key : keys) {
+        queue.push(key, key * 10);
+    }
+    EXPECT_FALSE(queue.empty());
+
+    for (int i = 0; i < 200; ++i) {
+        auto entry = queue.pop();
+        ASSERT_TRUE(entry.has_value());
+        EXPECT_EQ(entry->first, i / 2);
+        EXPECT_EQ(entry->second, (i / 2) * 10);
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(ConcurrentPriorityQueueTest, PopBatchTakesSmallestInOrder) {
+    ConcurrentPriorityQueue<int, int, std::greater<int>> queue(4);
+    for (int i = 0; i < 100; ++i) {
+        queue.push(i, i);
+    }
+
+    std::vector<std::pair<int, int>> out;
+    EXPECT_EQ(queue.pop_batch(out, 10), 10u);
+    ASSERT_EQ(out.size(), 10u);
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(out[i].first, 99 - i);
+    }
+
+    EXPECT_EQ(queue.pop_batch(out, 1000), 90u);
+    EXPECT_EQ(out.size(), 100u);
+    EXPECT_EQ(out.back().first, 0);
+    EXPECT_EQ(queue.pop_batch(out, 5), 0u);
+}
+
+TEST(ConcurrentPriorityQueueTest, ConcurrentPushPopLosesAndDuplicatesNothing) {
+    constexpr int C_THREADS = 4;
+    constexpr int C_PER     = 5000;
+    ConcurrentPriorityQueue<int, int> queue(8);
+    std::vector<std::atomic<int>> seen(C_THREADS * C_PER);
+    std::atomic<int> popped{0};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < C_THREADS; ++t) {
+        threads.emplace_back([&, t] {
+            std::vector<std::pair<int, int>> batch;
+            for (int i = 0; i < C_PER; ++i) {
+                const int key = i * C_THREADS + t;
+                queue.push(key, key);
+                if (i % 2) {
+                    if (auto entry = queue.pop()) {
+                        seen[entry->second].fetch_add(1);
+                        popped.fetch_add(1);
+                    }
+                } else {
+                    batch.clear();
+                    popped.fetch_add(static_cast<int>(queue.pop_batch(batch, 2)));
+                    for (const auto& [k, v] : batch) {
+                        seen[v].fetch_add(1);
+                    }
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    while (auto entry = queue.pop()) {
+        seen[entry->second].fetch_add(1);
+        popped.fetch_add(1);
+    }
+    EXPECT_EQ(popped.load(), C_THREADS * C_PER);
+    for (auto& count : seen) {
+        EXPECT_EQ(count.load(), 1);
+    }
+}
+
+TEST(ConcurrentPriorityQueueTest, UnlinkedNodesAreReclaimed) {
+    auto tracker = std::make_shared<int>(0);
+    {
+        ConcurrentPriorityQueue<int, std::shared_ptr<int>> queue(2);
+        for (int i = 0; i < 1000; ++i) {
+            queue.push(i, tracker);
+        }
+        EXPECT_EQ(tracker.use_count(), 1001);
+
+        for (int i = 0; i < 1000; ++i) {
+            ASSERT_TRUE(queue.pop().has_value());
+        }
+        // Popped values were moved out; the prefix was unlinked as it grew and
+        // nothing else was running, so at most the last batch is still parked.
+        EXPECT_EQ(tracker.use_count(), 1);
+        EXPECT_LT(queue.parked(), 8u);
+
+        for (int i = 0; i < 10; ++i) {
+            queue.push(i, tracker);
+        }
+    }
+    EXPECT_EQ(tracker.use_count(), 1);
+}
+
+TEST(ConcurrentPriorityQueueTest, ParkedIsSafeDuringPops) {
+    ConcurrentPriorityQueue<int, int> queue(2);
+    for (int i = 0; i < 20000; ++i) {
+        queue.push(i, i);
+    }
+
+    std::atomic<bool> done{false};
+    std::thread observer([&] {
+        size_t max_parked = 0;
+        while (!done.load(std::memory_order_acquire)) {
+            max_parked = std::max(max_parked, queue.parked());
+            std::this_thread::yield();
+        }
+        EXPECT_LE(max_parked, 20000u);
+    });
+    for (int i = 0; i < 20000; ++i) {
+        ASSERT_TRUE(queue.pop().has_value());
+        if (i % 64 == 0) {
+            std::this_thread::yield();
+        }
+    }
+    done.store(true, std::memory_order_release);
+    observer.join();
+    EXPECT_LT(queue.parked(), 8u);
+}
+
+TEST(ConcurrentPriorityQueueTest, MoreThreadsThanSlotsWaitTheirTurn) {
+    // First use of these types: one hazard slot for four threads, so most
+    // operations find it taken and must wait in enter() rather than fail.
+    constexpr int C_THREADS = 4;
+    constexpr int C_PER     = 2000;
+    ConcurrentPriorityQueue<int, long> queue(4, 1);
+    std::atomic<int> popped{0};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < C_THREADS; ++t) {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < C_PER; ++i) {
+                queue.push(i * C_THREADS + t, i);
+                popped += queue.pop().has_value();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    while (queue.pop()) {
+        ++popped;
+    }
+    EXPECT_EQ(popped.load(), C_THREADS * C_PER);
+}
@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include <set>
+#include <stdexcept>
+#include "DeferredQueue.hpp"
+
+using HazardSystem::DeferredQueue;
+
+struct Dummy {
+    int value;
+    explicit Dummy(int v) : value(v) {}
+};
+
+TEST(DeferredQueueTest, RunsWhenNothingProtected) {
+    std::set<const Dummy*> hazards;
+    DeferredQueue<Dummy> queue(8, [&hazards](const Dummy* p) { return hazards.count(p) > 0; });
+    Dummy a(1);
+    int runs = 0;
+
+    EXPECT_TRUE(queue.defer({&a}, [&runs] { ++runs; }));
+    EXPECT_EQ(queue.size(), 1u);
+    EXPECT_EQ(queue.reclaim().value_or(0), 1u);
+    EXPECT_EQ(runs, 1);
+    EXPECT_EQ(queue.size(), 0u);
+}
+
+TEST(DeferredQueueTest, WaitsForEveryPointer) {
+    std::set<const Dummy*> hazards;
+    DeferredQueue<Dummy> queue(8, [&hazards](const Dummy* p) { return hazards.count(p) > 0; });
+    Dummy a(1), b(2);
+    int runs = 0;
+
+    hazards = {&a, &b};
+    ASSERT_TRUE(queue.defer({&a, &b}, [&runs] { ++runs; }));
+    EXPECT_FALSE(queue.reclaim().has_value());
+
+    hazards.erase(&a);
+    EXPECT_FALSE(queue.reclaim().has_value());
+    EXPECT_EQ(runs, 0);
+
+    hazards.erase(&b);
+    EXPECT_TRUE(queue.reclaim().has_value());
+    EXPECT_EQ(runs, 1);
+}
+
+TEST(DeferredQueueTest, EmptyCallbackRejected) {
+    DeferredQueue<Dummy> queue(8, [](const Dummy*) { return false; });
+    Dummy a(1);
+    EXPECT_FALSE(queue.defer({&a}, nullptr));
+    EXPECT_EQ(queue.size(), 0u);
+}
+
+TEST(DeferredQueueTest, BatchedUntilThreshold) {
+    DeferredQueue<Dummy> queue(4, [](const Dummy*) { return false; });
+    Dummy a(1);
+    int runs = 0;
+
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_TRUE(queue.defer({&a}, [&runs] { ++runs; }));
+    }
+    EXPECT_EQ(runs, 0);
+    ASSERT_TRUE(queue.defer({&a}, [&runs] { ++runs; }));
+    EXPECT_EQ(runs, 4);
+    EXPECT_EQ(queue.size(), 0u);
+}
+
+TEST(DeferredQueueTest, KeepsOrderOfBlockedEntries) {
+    std::set<const Dummy*> hazards;
+    DeferredQueue<Dummy> queue(16, [&hazards](const Dummy* p) { return hazards.count(p) > 0; });
+    std::vector<Dummy> items;
+    for (int i = 0; i < 6; ++i) {
+        items.emplace_back(i);
+    }
+    std::vector<int> order;
+    for (auto& item : items) {
+        if (item.value % 2 == 0) {
+            hazards.insert(&item);
+        }
+        ASSERT_TRUE(queue.defer({&item}, [&order, v = item.value] { order.push_back(v); }));
+    }
+
+    queue.reclaim();
+    EXPECT_EQ(order, (std::vector<int>{1, 3, 5}));
+
+    hazards.clear();
+    queue.reclaim();
+    EXPECT_EQ(order, (std::vector<int>{1, 3, 5, 0, 2, 4}));
+}
+
+TEST(DeferredQueueTest, CallbackMayDeferAgain) {
+    DeferredQueue<Dummy> queue(8, [](const Dummy*) { return false; });
+    Dummy a(1);
+    int runs = 0;
+
+    ASSERT_TRUE(queue.defer({&a}, [&] {
+        ++runs;
+        queue.defer({&a}, [&runs] { ++runs; });
+    }));
+    queue.reclaim();
+    EXPECT_EQ(runs, 1);
+    EXPECT_EQ(queue.size(), 1u);
+    queue.reclaim();
+    EXPECT_EQ(runs, 2);
+}
+
+TEST(DeferredQueueTest, ClearRunsEverything) {
+    DeferredQueue<Dummy> queue(8, [](const Dummy*) { return true; });
+    Dummy a(1);
+    int runs = 0;
+    for (int i = 0; i < 5; ++i) {
+        ASSERT_TRUE(queue.defer({&a}, [&runs] { ++runs; }));
+    }
+    queue.clear();
+    EXPECT_EQ(runs, 5);
+    EXPECT_EQ(queue.size(), 0u);
+}
+
+TEST(DeferredQueueTest, SinglePointerAndManyPointers) {
+    std::set<const Dummy*> hazards;
+    DeferredQueue<Dummy> queue(8, [&hazards](const Dummy* p) { return hazards.count(p) > 0; });
+    Dummy a(1), b(2), c(3), d(4);
+    int runs = 0;
+
+    // One pointer inline, four spill past the inline storage.
+    ASSERT_TRUE(queue.defer(&a, [&runs] { ++runs; }));
+    ASSERT_TRUE(queue.defer({&a, &b, &c, &d}, [&runs] { runs += 10; }));
+    hazards.insert(&d);
+    queue.reclaim();
+    EXPECT_EQ(runs, 1);
+    hazards.clear();
+    queue.reclaim();
+    EXPECT_EQ(runs, 11);
+}
+
+TEST(DeferredQueueTest, ThrowingCallbackRequeuesTheRest) {
+    DeferredQueue<Dummy> queue(8, [](const Dummy*) { return false; });
+    Dummy a(1);
+    std::vector<int> order;
+    ASSERT_TRUE(queue.defer({&a}, [&order] { order.push_back(1); }));
+    ASSERT_TRUE(queue.defer({&a}, [&order] { order.push_back(2); throw std::runtime_error("deferred"); }));
+    ASSERT_TRUE(queue.defer({&a}, [&order] { order.push_back(3); }));
+    ASSERT_TRUE(queue.defer({&a}, [&order] { order.push_back(4); }));
+
+    EXPECT_THROW(queue.reclaim(), std::runtime_error);
+    EXPECT_EQ(order, (std::vector<int>{1, 2}));
+    EXPECT_EQ(queue.size(), 2u);
+
+    queue.reclaim();
+    EXPECT_EQ(order, (std::vector<int>{1, 2, 3, 4}));
+    EXPECT_EQ(queue.size(), 0u);
+}
+
+TEST(DeferredQueueTest, DestructorSkipsThrowingCallback) {
+    Dummy a(1);
+    int runs = 0;
+    {
+        DeferredQueue<Dummy> queue(8, [](const Dummy*) { return true; });
+        ASSERT_TRUE(queue.defer({&a}, [] { throw std::runtime_error("deferred"); }));
+        ASSERT_TRUE(queue.defer({&a}, [&runs] { ++runs; }));
+        ASSERT_TRUE(queue.defer({&a}, [&runs] { ++runs; }));
+    }
+    EXPECT_EQ(runs, 2);
+}
@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <functional>
 #include <set>
+#include <memory_resource>
 #include "HashMultiTable.hpp"
 
 // Use the HazardSystem namespace
@@ -152,6 +153,12 @@ TEST_F(HashMultiTableTest, MultipleValuesPerKey) {
     }
     
     EXPECT_EQ(actual_values, expected_values);
+
+    // The visitor form sees the same values without a vector
+    std::set<int> visited_values;
+    EXPECT_EQ(table.find(key, [&](const std::shared_ptr<TestNode>& node) { visited_values.insert(node->data); }), static_cast<size_t>(count));
+    EXPECT_EQ(visited_values, expected_values);
+    EXPECT_EQ(table.find(key + 1, [](const std::shared_ptr<TestNode>&) {}), 0u);
     
     // Test find_first returns one result
     auto first = table.find_first(key);
@@ -1166,6 +1173,43 @@ TEST_F(HashMultiTableTest, ConcurrentUpdateAll) {
 }
 
 
+// Counts what a pmr container takes from and returns to its resource.
+class CountingResource : public std::pmr::memory_resource {
+public:
+    size_t allocations{0};
+    size_t outstanding{0};
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        ++allocations;
+        outstanding += bytes;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+        outstanding -= bytes;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+TEST(HashMultiTablePmrTest, NodesComeFromResource) {
+    CountingResource resource;
+    {
+        HazardSystem::pmr::HashMultiTable<int, TestNode, 8> table(&resource);
+        for (int i = 0; i < 30; ++i) {
+            ASSERT_TRUE(table.insert(i % 5, std::make_shared<TestNode>(i)));
+        }
+        EXPECT_GE(resource.allocations, 30u);
+        EXPECT_EQ(table.find(3).size(), 6u);
+        table.clear();
+        EXPECT_EQ(table.size(), 0u);
+    }
+    EXPECT_EQ(resource.outstanding, 0u);
+}
+
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -5,6 +5,7 @@
 #include <random>
 #include <chrono>
 #include <atomic>
+#include <memory_resource>
 #include "HashTable.hpp"  // Ensure this includes your HazardSystem::HashTable
 
 // Define a simple struct to use as a test object
@@ -62,6 +63,21 @@ TEST_F(HashTableTest, RemoveExistingKey) {
     ASSERT_EQ(hashTable->find(7), nullptr);
 }
 
+// Conditional remove only succeeds while the key still maps to the given value
+TEST_F(HashTableTest, RemoveExpectedValue) {
+    auto first  = std::make_shared<TestNode>(1);
+    auto second = std::make_shared<TestNode>(2);
+    ASSERT_TRUE(hashTable->insert(3, first));
+    ASSERT_TRUE(hashTable->insert(3, second));
+
+    EXPECT_FALSE(hashTable->remove(3, first));
+    ASSERT_NE(hashTable->find(3), nullptr);
+    EXPECT_TRUE(hashTable->remove(3, second));
+    EXPECT_EQ(hashTable->find(3), nullptr);
+    EXPECT_FALSE(hashTable->remove(3, second));
+    EXPECT_EQ(hashTable->size(), 0u);
+}
+
 // Test removing a non-existing key
 TEST_F(HashTableTest, RemoveNonExistingKey) {
     ASSERT_FALSE(hashTable->remove(100));
@@ -659,3 +675,59 @@ TEST_F(HashTableTest, RealWorldMixedOperations) {
     EXPECT_LT(mismatches, 10) << "Too many mismatches (likely a real bug or extreme race)";
     // SUCCEED() << "Concurrent real-world mixed operation test complete. Mismatches: " << mismatches;
 }
+
+// Counts what a pmr container takes from and returns to its resource.
+class CountingResource : public std::pmr::memory_resource {
+public:
+    size_t allocations{0};
+    size_t outstanding{0};
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        ++allocations;
+        outstanding += bytes;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+        outstanding -= bytes;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+TEST(HashTablePmrTest, NodesComeFromResource) {
+    CountingResource resource;
+    {
+        HazardSystem::pmr::HashTable<int, TestNode, 16> table(&resource);
+        for (int i = 0; i < 40; ++i) {
+            ASSERT_TRUE(table.insert(i, std::make_shared<TestNode>(i)));
+        }
+        EXPECT_GE(resource.allocations, 40u);
+        ASSERT_NE(table.find(7), nullptr);
+        EXPECT_EQ(table.find(7)->value, 7);
+        for (int i = 0; i < 40; i += 2) {
+            EXPECT_TRUE(table.remove(i));
+        }
+        EXPECT_EQ(table.size(), 20u);
+    }
+    EXPECT_EQ(resource.outstanding, 0u);
+}
+
+TEST(HashTablePmrTest, RemoveReleasesNodes) {
+    CountingResource resource;
+    HazardSystem::pmr::HashTable<int, TestNode, 16> table(&resource);
+    for (int i = 0; i < 10000; ++i) {
+        ASSERT_TRUE(table.insert(i, std::make_shared<TestNode>(i)));
+        ASSERT_TRUE(i % 2 ? table.remove(i) : table.remove(i, table.find(i)));
+        ASSERT_LE(resource.outstanding, 1024u) << "removed nodes stay linked after key " << i;
+    }
+    EXPECT_EQ(table.size(), 0u);
+    EXPECT_EQ(resource.outstanding, 0u);
+    // A removed key can come back.
+    ASSERT_TRUE(table.insert(3, std::make_shared<TestNode>(30)));
+    ASSERT_NE(table.find(3), nullptr);
+    EXPECT_EQ(table.find(3)->value, 30);
+    EXPECT_EQ(table.size(), 1u);
+}
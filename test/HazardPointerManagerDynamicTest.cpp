@@ -10,6 +10,9 @@
 #include <random>
 #include <algorithm>
 #include <iostream>
+#include <memory_resource>
+#include <cstring>
+#include <span>
 
 #include "HazardPointerManager.hpp"
 #include "ThreadRegistry.hpp"
@@ -673,6 +676,678 @@ TEST(DynamicHazardPointerManager, ABASimulation) {
     EXPECT_EQ(created.load(), destroyed.load() + 1);
 }
 
+// -----------------------------------------------------------------------------
+// 21) Short-lived threads recycle retire records
+// -----------------------------------------------------------------------------
+DEFINE_TESTDATA_TYPE(ThreadChurnRecords);
+TEST(DynamicHazardPointerManager, ThreadChurnRecyclesRecords) {
+  using TestData = ThreadChurnRecords_TestData;
+  auto& mgr = HazardPointerManager<TestData,0>::instance(16, 4);
+
+  for (int i = 0; i < 64; ++i) {
+    std::thread([&mgr, i] {
+      std::atomic<TestData*> src{new TestData(i)};
+      auto guard = mgr.protect(src);
+      EXPECT_TRUE(guard);
+      guard.reset();
+      EXPECT_TRUE(mgr.retire(src.exchange(nullptr)));
+    }).join();
+  }
+
+  // Each thread handed its record back on exit, so the pool never grew.
+  EXPECT_EQ(mgr.record_size(), 1u);
+}
+
+// -----------------------------------------------------------------------------
+// 22) Nodes still protected when their retiring thread exits are adopted
+// -----------------------------------------------------------------------------
+struct ExitedThreadAdoption_TestData {
+  static inline std::atomic<int> destroyed{0};
+  int value;
+  ExitedThreadAdoption_TestData(int v = 0) : value(v) {}
+  ~ExitedThreadAdoption_TestData() { destroyed.fetch_add(1); }
+};
+TEST(DynamicHazardPointerManager, ExitedThreadRetiredNodesAreAdopted) {
+  using TestData = ExitedThreadAdoption_TestData;
+  auto& mgr = HazardPointerManager<TestData,0>::instance(16, 4);
+  auto* node = new TestData(1);
+
+  auto guard = mgr.protect(node);
+  ASSERT_TRUE(guard);
+
+  std::thread([&mgr, node] {
+    EXPECT_TRUE(mgr.retire(node));
+  }).join();
+  // The retiring thread is gone but the node is still protected here.
+  EXPECT_EQ(TestData::destroyed.load(), 0);
+
+  guard.reset();
+  std::thread([&mgr] {
+    mgr.reclaim();
+  }).join();
+  EXPECT_EQ(TestData::destroyed.load(), 1);
+}
+
+// -----------------------------------------------------------------------------
+// 23) Intrusive types retire through the hook
+// -----------------------------------------------------------------------------
+struct IntrusiveRetire_TestData : hazard_obj_base<IntrusiveRetire_TestData> {
+  static inline std::atomic<int> destroyed{0};
+  int value;
+  IntrusiveRetire_TestData(int v = 0) : value(v) {}
+  ~IntrusiveRetire_TestData() { destroyed.fetch_add(1); }
+};
+TEST(DynamicHazardPointerManager, IntrusiveRetireAndReclaim) {
+  using TestData = IntrusiveRetire_TestData;
+  auto& mgr = HazardPointerManager<TestData,0>::instance(16, 4);
+  mgr.clear();
+
+  auto* kept = new TestData(1);
+  auto guard = mgr.protect(kept);
+  ASSERT_TRUE(guard);
+  EXPECT_TRUE(mgr.retire(kept));
+  EXPECT_TRUE(kept->hazard_retired());
+  EXPECT_FALSE(mgr.retire(kept));   // already queued
+
+  for (int i = 0; i < 8; ++i) {
+    EXPECT_TRUE(mgr.retire(new TestData(i)));
+  }
+  mgr.reclaim();
+  EXPECT_EQ(mgr.retire_size(), 1u);
+  EXPECT_EQ(TestData::destroyed.load(), 8);
+
+  static std::atomic<int> custom{0};
+  EXPECT_TRUE(mgr.retire(new TestData(42), [](TestData* p) { custom.fetch_add(1); delete p; }));
+
+  guard.reset();
+  mgr.reclaim();
+  EXPECT_EQ(mgr.retire_size(), 0u);
+  EXPECT_EQ(custom.load(), 1);
+  EXPECT_EQ(TestData::destroyed.load(), 10);
+}
+
+// -----------------------------------------------------------------------------
+// 24) Deferred callbacks wait for every named pointer
+// -----------------------------------------------------------------------------
+DEFINE_TESTDATA_TYPE(DeferCallback);
+TEST(DynamicHazardPointerManager, DeferRunsAfterPointersUnprotected) {
+  using TestData = DeferCallback_TestData;
+  auto& mgr = HazardPointerManager<TestData,0>::instance(16, 4);
+  mgr.clear();
+
+  TestData a(1), b(2);
+  auto ga = mgr.protect(&a);
+  auto gb = mgr.protect(&b);
+  ASSERT_TRUE(ga);
+  ASSERT_TRUE(gb);
+
+  std::atomic<int> runs{0};
+  EXPECT_TRUE(mgr.defer({&a, &b}, [&runs] { runs.fetch_add(1); }));
+  EXPECT_TRUE(mgr.defer(&b, [&runs] { runs.fetch_add(10); }));
+  EXPECT_EQ(mgr.deferred_size(), 2u);
+
+  mgr.reclaim();
+  EXPECT_EQ(runs.load(), 0);
+
+  ga.reset();
+  mgr.reclaim();
+  EXPECT_EQ(runs.load(), 0);
+
+  gb.reset();
+  mgr.reclaim();
+  EXPECT_EQ(runs.load(), 11);
+  EXPECT_EQ(mgr.deferred_size(), 0u);
+}
+
+// -----------------------------------------------------------------------------
+// 25) wait_unprotected blocks until the hazard is released
+// -----------------------------------------------------------------------------
+DEFINE_TESTDATA_TYPE(WaitUnprotected);
+TEST(DynamicHazardPointerManager, WaitUnprotectedBlocksUntilRelease) {
+  using TestData = WaitUnprotected_TestData;
+  auto& mgr = HazardPointerManager<TestData,0>::instance(16, 4);
+  mgr.clear();
+
+  TestData data(7);
+  auto guard = mgr.protect(&data);
+  ASSERT_TRUE(guard);
+
+  std::atomic<bool> returned{false};
+  std::thread waiter([&] {
+    mgr.wait_unprotected(&data);
+    returned.store(true);
+  });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_FALSE(returned.load());
+
+  guard.reset();
+  waiter.join();
+  EXPECT_TRUE(returned.load());
+
+  // Nothing protected: returns immediately.
+  mgr.wait_unprotected(&data);
+}
+
+// -----------------------------------------------------------------------------
+// 26) synchronize waits only for hazards published before the call
+// -----------------------------------------------------------------------------
+DEFINE_TESTDATA_TYPE(Synchronize);
+TEST(DynamicHazardPointerManager, SynchronizeWaitsForExistingHazards) {
+  using TestData = Synchronize_TestData;
+  auto& mgr = HazardPointerManager<TestData,0>::instance(16, 4);
+  mgr.clear();
+
+  TestData a(1), b(2);
+  auto ga = mgr.protect(&a);
+  auto gb = mgr.protect(&b);
+  ASSERT_TRUE(ga);
+  ASSERT_TRUE(gb);
+
+  std::atomic<bool> entered{false}, returned{false}, stop{false};
+  std::thread waiter([&] {
+    entered.store(true);
+    mgr.synchronize();
+    returned.store(true);
+  });
+  // Keeps re-protecting a after synchronize started; it gets the same slot and
+  // the same pointer back each time, which must not hold synchronize up.
+  std::thread churn([&] {
+    while (!stop.load()) {
+      auto g = mgr.protect(&a);
+      ASSERT_TRUE(g);
+      std::this_thread::yield();
+    }
+  });
+
+  while (!entered.load()) {
+    std::this_thread::yield();
+  }
+  ga.reset();
+  // b has been held since before the call, so synchronize cannot be done yet.
+  EXPECT_FALSE(returned.load());
+  gb.reset();
+  waiter.join();
+  stop.store(true);
+  churn.join();
+  EXPECT_TRUE(returned.load());
+}
+
+// -----------------------------------------------------------------------------
+// 27) Nodes built in a memory resource are returned to it on reclaim
+// -----------------------------------------------------------------------------
+struct ArenaRetire_TestData {
+  static inline std::atomic<int> destroyed{0};
+  int value;
+  explicit ArenaRetire_TestData(int v) : value(v) {}
+  ~ArenaRetire_TestData() { destroyed.fetch_add(1); }
+};
+TEST(DynamicHazardPointerManager, RetireIntoMemoryResource) {
+  using TestData = ArenaRetire_TestData;
+  auto& mgr = HazardPointerManager<TestData,0>::instance(16, 4);
+  mgr.clear();
+
+  std::pmr::monotonic_buffer_resource arena;
+  std::pmr::polymorphic_allocator<TestData> alloc(&arena);
+  TestData* kept = alloc.allocate(1);
+  alloc.construct(kept, 1);
+  TestData* freed = alloc.allocate(1);
+  alloc.construct(freed, 2);
+
+  auto guard = mgr.protect(kept);
+  ASSERT_TRUE(guard);
+  EXPECT_TRUE(mgr.retire(kept, &arena));
+  EXPECT_TRUE(mgr.retire(freed, &arena));
+  mgr.reclaim();
+  EXPECT_EQ(TestData::destroyed.load(), 1);
+
+  guard.reset();
+  mgr.reclaim();
+  EXPECT_EQ(TestData::destroyed.load(), 2);
+  EXPECT_EQ(mgr.retire_size(), 0u);
+  arena.release();
+}
+
+// -----------------------------------------------------------------------------
+// 28) is_protected counts every holder of a pointer and never blocks
+// -----------------------------------------------------------------------------
+DEFINE_TESTDATA_TYPE(IsProtected);
+TEST(DynamicHazardPointerManager, IsProtectedTracksAllHolders) {
+  using TestData = IsProtected_TestData;
+  auto& mgr = HazardPointerManager<TestData,0>::instance(16, 4);
+  mgr.clear();
+
+  TestData data(1), other(2);
+  EXPECT_FALSE(mgr.is_protected(&data));
+
+  auto first  = mgr.protect(&data);
+  auto second = mgr.protect(&data);
+  ASSERT_TRUE(first);
+  ASSERT_TRUE(second);
+  EXPECT_TRUE(mgr.is_protected(&data));
+  EXPECT_FALSE(mgr.is_protected(&other));
+
+  first.reset();
+  EXPECT_TRUE(mgr.is_protected(&data));
+  second.reset();
+  EXPECT_FALSE(mgr.is_protected(&data));
+}
+
+// -----------------------------------------------------------------------------
+// 29) wait_free_protect never fails while writers keep replacing the source
+// -----------------------------------------------------------------------------
+DEFINE_TESTDATA_TYPE(WaitFreeProtect);
+TEST(DynamicHazardPointerManager, WaitFreeProtectUnderWriterStorm) {
+  using TestData = WaitFreeProtect_TestData;
+  auto& mgr = HazardPointerManager<TestData,0>::instance(16, 4);
+  mgr.clear();
+
+  std::atomic<TestData*> source{nullptr};
+  EXPECT_FALSE(mgr.wait_free_protect(source));
+
+  source.store(new TestData(0));
+  constexpr int C_READERS = 4, C_WRITERS = 2, C_READS = 20000;
+  std::atomic<int> writers_done{0}, failures{0}, corrupt{0};
+
+  std::vector<std::thread> threads;
+  for (int w = 0; w < C_WRITERS; ++w) {
+    threads.emplace_back([&, w] {
+      for (int i = 1; i <= C_READS; ++i) {
+        TestData* old = source.exchange(new TestData(w * C_READS + i));
+        mgr.retire(old);
+      }
+      writers_done.fetch_add(1);
+    });
+  }
+  for (int r = 0; r < C_READERS; ++r) {
+    threads.emplace_back([&] {
+      for (int i = 0; i < C_READS; ++i) {
+        auto guard = mgr.wait_free_protect(source);
+        if (!guard) {
+          failures.fetch_add(1);
+          continue;
+        }
+        if (guard->destroyed.load() or guard->value < 0) {
+          corrupt.fetch_add(1);
+        }
+        guard->access();
+      }
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  EXPECT_EQ(writers_done.load(), C_WRITERS);
+  EXPECT_EQ(failures.load(), 0);
+  EXPECT_EQ(corrupt.load(), 0);
+  delete source.exchange(nullptr);
+  mgr.reclaim();
+  EXPECT_EQ(mgr.retire_size(), 0u);
+}
+
+// -----------------------------------------------------------------------------
+// 30) A range inside a slab keeps the slab from being reclaimed
+// -----------------------------------------------------------------------------
+struct RangeSlab_TestData {
+  static inline std::atomic<int> destroyed{0};
+  std::byte bytes[4096];
+  ~RangeSlab_TestData() { destroyed.fetch_add(1); }
+};
+TEST(DynamicHazardPointerManager, RangeHoldsSlabUntilReleased) {
+  using TestData = RangeSlab_TestData;
+  auto& mgr = HazardPointerManager<TestData,0>::instance(16, 4);
+  mgr.clear();
+
+  auto* held  = new TestData;
+  auto* other = new TestData;
+  EXPECT_FALSE(mgr.protect_range(nullptr, 8));
+  EXPECT_FALSE(mgr.protect_range(held->bytes, 0));
+
+  auto slice = mgr.protect_range(held->bytes + 1024, 256);
+  ASSERT_TRUE(slice);
+  EXPECT_EQ(slice.data(), held->bytes + 1024);
+  EXPECT_EQ(slice.span().size(), 256u);
+  EXPECT_TRUE(mgr.is_protected(held));
+  EXPECT_FALSE(mgr.is_protected(other));
+
+  EXPECT_TRUE(mgr.retire(held));
+  EXPECT_TRUE(mgr.retire(other));
+  mgr.reclaim();
+  EXPECT_EQ(TestData::destroyed.load(), 1);
+  EXPECT_EQ(mgr.retire_size(), 1u);
+
+  slice.reset();
+  mgr.reclaim();
+  EXPECT_EQ(TestData::destroyed.load(), 2);
+  EXPECT_EQ(mgr.retire_size(), 0u);
+  EXPECT_EQ(mgr.hazard_size(), 0u);
+
+  // Half-open: a range ending where the next slab starts does not cover it.
+  auto* adjacent = new TestData[2];
+  auto edge = mgr.protect_range(adjacent[1].bytes - 64, 64);
+  ASSERT_TRUE(edge);
+  EXPECT_TRUE(mgr.is_protected(&adjacent[0]));
+  EXPECT_FALSE(mgr.is_protected(&adjacent[1]));
+  edge.reset();
+  delete[] adjacent;
+}
+
+// -----------------------------------------------------------------------------
+// 31) Slices taken through a source are checked against hazard_extent()
+// -----------------------------------------------------------------------------
+struct RangeExtent_TestData {
+  static inline std::atomic<int> destroyed{0};
+  std::unique_ptr<std::byte[]> buffer;
+  size_t size;
+  explicit RangeExtent_TestData(size_t n) : buffer(new std::byte[n]), size(n) {}
+  ~RangeExtent_TestData() { destroyed.fetch_add(1); }
+  std::span<const std::byte> hazard_extent() const { return {buffer.get(), size}; }
+};
+TEST(DynamicHazardPointerManager, RangeFromSourceUsesExtent) {
+  using TestData = RangeExtent_TestData;
+  static_assert(ExtentRetirable<TestData>);
+  auto& mgr = HazardPointerManager<TestData,0>::instance(16, 4);
+  mgr.clear();
+
+  std::atomic<TestData*> source{nullptr};
+  EXPECT_FALSE(mgr.protect_range(source, 0, 16));
+
+  auto* slab = new TestData(4096);
+  source.store(slab);
+  EXPECT_FALSE(mgr.protect_range(source, 4000, 200));
+  EXPECT_FALSE(mgr.protect_range(source, 8192, 1));
+  EXPECT_EQ(mgr.hazard_size(), 0u);
+
+  auto slice = mgr.protect_range(source, 100, 50);
+  ASSERT_TRUE(slice);
+  EXPECT_EQ(slice.data(), slab->buffer.get() + 100);
+  EXPECT_EQ(slice.size(), 50u);
+
+  // The slab is recycled: unlinked and retired while the reader holds its slice.
+  EXPECT_TRUE(mgr.retire(source.exchange(new TestData(64))));
+  mgr.reclaim();
+  EXPECT_EQ(TestData::destroyed.load(), 0);
+
+  slice.reset();
+  mgr.reclaim();
+  EXPECT_EQ(TestData::destroyed.load(), 1);
+  EXPECT_EQ(mgr.retire_size(), 0u);
+  delete source.exchange(nullptr);
+}
+
+// -----------------------------------------------------------------------------
+// 32) Readers holding slices never see a slab reclaimed under them
+// -----------------------------------------------------------------------------
+struct RangeStorm_TestData {
+  std::byte bytes[1024];
+  explicit RangeStorm_TestData(int stamp) {
+    std::memset(bytes, stamp % 255, sizeof(bytes));
+  }
+  ~RangeStorm_TestData() { std::memset(bytes, 0xFF, sizeof(bytes)); }
+};
+TEST(DynamicHazardPointerManager, RangeSlicesUnderWriterStorm) {
+  using TestData = RangeStorm_TestData;
+  auto& mgr = HazardPointerManager<TestData,0>::instance(16, 4);
+  mgr.clear();
+
+  std::atomic<TestData*> source{new TestData(0)};
+  constexpr int C_READERS = 3, C_WRITES = 20000;
+  std::atomic<bool> done{false};
+  std::atomic<int> corrupt{0}, reads{0};
+
+  std::thread writer([&] {
+    for (int i = 1; i <= C_WRITES; ++i) {
+      mgr.retire(source.exchange(new TestData(i)));
+    }
+    done.store(true);
+  });
+  std::vector<std::thread> readers;
+  for (int r = 0; r < C_READERS; ++r) {
+    readers.emplace_back([&, r] {
+      size_t offset = static_cast<size_t>(r) * 128;
+      while (!done.load()) {
+        auto slice = mgr.protect_range(source, offset, 256);
+        if (!slice) {
+          continue;
+        }
+        const std::byte first = slice.data()[0];
+        // Hold the slice across a reschedule so the writer's scans see it.
+        std::this_thread::yield();
+        for (std::byte b : slice.span()) {
+          if (b != first or b == std::byte{0xFF}) {
+            corrupt.fetch_add(1);
+            break;
+          }
+        }
+        reads.fetch_add(1);
+        offset = (offset + 64) % 768;
+      }
+    });
+  }
+  writer.join();
+  for (auto& t : readers) {
+    t.join();
+  }
+
+  EXPECT_EQ(corrupt.load(), 0);
+  EXPECT_GT(reads.load(), 0);
+  delete source.exchange(nullptr);
+  mgr.reclaim();
+  EXPECT_EQ(mgr.retire_size(), 0u);
+}
+
+// -----------------------------------------------------------------------------
+// 33) Same storm while an unrelated range is held, so every writer scan takes
+//     the range snapshot before its per-node checks
+// -----------------------------------------------------------------------------
+TEST(DynamicHazardPointerManager, RangeSlicesUnderWriterStormWithRangeHeld) {
+  using TestData = RangeStorm_TestData;
+  auto& mgr = HazardPointerManager<TestData,0>::instance(16, 4);
+  mgr.clear();
+
+  std::byte unrelated[64];
+  auto held = mgr.protect_range(unrelated, sizeof(unrelated));
+  ASSERT_TRUE(held);
+
+  std::atomic<TestData*> source{new TestData(0)};
+  constexpr int C_READERS = 3, C_WRITES = 20000;
+  std::atomic<bool> done{false};
+  std::atomic<int> corrupt{0}, reads{0};
+
+  std::thread writer([&] {
+    for (int i = 1; i <= C_WRITES; ++i) {
+      mgr.retire(source.exchange(new TestData(i)));
+      mgr.reclaim();
+    }
+    done.store(true);
+  });
+  std::vector<std::thread> readers;
+  for (int r = 0; r < C_READERS; ++r) {
+    readers.emplace_back([&, r] {
+      size_t offset = static_cast<size_t>(r) * 128;
+      while (!done.load()) {
+        auto slice = mgr.protect_range(source, offset, 256);
+        if (!slice) {
+          continue;
+        }
+        const std::byte first = slice.data()[0];
+        std::this_thread::yield();
+        for (std::byte b : slice.span()) {
+          if (b != first or b == std::byte{0xFF}) {
+            corrupt.fetch_add(1);
+            break;
+          }
+        }
+        reads.fetch_add(1);
+        offset = (offset + 64) % 768;
+      }
+    });
+  }
+  writer.join();
+  for (auto& t : readers) {
+    t.join();
+  }
+
+  EXPECT_EQ(corrupt.load(), 0);
+  EXPECT_GT(reads.load(), 0);
+  held.reset();
+  EXPECT_EQ(mgr.hazard_size(), 0u);
+  delete source.exchange(nullptr);
+  mgr.reclaim();
+  EXPECT_EQ(mgr.retire_size(), 0u);
+}
+
+// -----------------------------------------------------------------------------
+// 34) A source slice published after a scan copied the ranges is still seen:
+//     the reader parks in hazard_extent() between validation and publish, and
+//     a deferred callback (run after the copy, before retired nodes are
+//     checked) lets it finish
+// -----------------------------------------------------------------------------
+struct RangeRace_TestData {
+  static inline std::atomic<int> destroyed{0};
+  static inline std::atomic<int> phase{0};
+  std::byte bytes[256];
+  ~RangeRace_TestData() { destroyed.fetch_add(1); }
+  std::span<const std::byte> hazard_extent() const {
+    int expected = 1;
+    if (phase.compare_exchange_strong(expected, 2)) {
+      while (phase.load() != 3) {
+        std::this_thread::yield();
+      }
+    }
+    return {bytes, sizeof(bytes)};
+  }
+};
+TEST(DynamicHazardPointerManager, RangePublishedAfterScanSnapshotKeepsSlab) {
+  using TestData = RangeRace_TestData;
+  static_assert(ExtentRetirable<TestData>);
+  auto& mgr = HazardPointerManager<TestData,0>::instance(16, 4);
+  mgr.clear();
+
+  std::byte unrelated[64];
+  auto held = mgr.protect_range(unrelated, sizeof(unrelated));
+  ASSERT_TRUE(held);
+
+  auto* slab = new TestData;
+  std::atomic<TestData*> source{slab};
+  TestData::phase.store(1);
+
+  std::atomic<bool> got{false};
+  std::thread reader([&] {
+    auto slice = mgr.protect_range(source, 0, 64);
+    got.store(static_cast<bool>(slice));
+    TestData::phase.store(4);
+    while (TestData::phase.load() != 5) {
+      std::this_thread::yield();
+    }
+  });
+  while (TestData::phase.load() != 2) {
+    std::this_thread::yield();
+  }
+
+  EXPECT_TRUE(mgr.retire(source.exchange(nullptr)));
+  EXPECT_TRUE(mgr.defer(static_cast<const TestData*>(nullptr), [] {
+    TestData::phase.store(3);
+    while (TestData::phase.load() != 4) {
+      std::this_thread::yield();
+    }
+  }));
+  mgr.reclaim();
+  EXPECT_TRUE(got.load());
+  EXPECT_EQ(TestData::destroyed.load(), 0);
+
+  TestData::phase.store(5);
+  reader.join();
+  mgr.reclaim();
+  EXPECT_EQ(TestData::destroyed.load(), 1);
+  EXPECT_EQ(mgr.retire_size(), 0u);
+  held.reset();
+}
+
+// -----------------------------------------------------------------------------
+// 35) unlink; synchronize(); free holds with wait_free_protect readers, whose
+//     requests a helper may complete with a value read before the unlink
+// -----------------------------------------------------------------------------
+DEFINE_TESTDATA_TYPE(SynchronizeWaitFree);
+TEST(DynamicHazardPointerManager, SynchronizeWaitsForWaitFreeRequests) {
+  using TestData = SynchronizeWaitFree_TestData;
+  auto& mgr = HazardPointerManager<TestData,0>::instance(16, 4);
+  mgr.clear();
+
+  std::atomic<TestData*> source{new TestData(0)};
+  constexpr int C_READERS = 4, C_WRITERS = 2, C_WRITES = 5000;
+  std::atomic<int> writers_done{0}, corrupt{0}, reads{0};
+  // Freed nodes are only marked, so a late reader sees the mark, not freed memory.
+  std::vector<std::vector<TestData*>> freed(C_WRITERS);
+
+  std::vector<std::thread> threads;
+  for (int w = 0; w < C_WRITERS; ++w) {
+    threads.emplace_back([&, w] {
+      for (int i = 1; i <= C_WRITES; ++i) {
+        TestData* old = source.exchange(new TestData(i));
+        mgr.synchronize();
+        old->destroyed.store(true);
+        freed[w].push_back(old);
+      }
+      writers_done.fetch_add(1);
+    });
+  }
+  for (int r = 0; r < C_READERS; ++r) {
+    threads.emplace_back([&] {
+      while (writers_done.load() < C_WRITERS) {
+        auto guard = mgr.wait_free_protect(source);
+        if (guard and guard->destroyed.load()) {
+          corrupt.fetch_add(1);
+        }
+        reads.fetch_add(1);
+      }
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  EXPECT_EQ(corrupt.load(), 0);
+  EXPECT_GT(reads.load(), 0);
+  EXPECT_EQ(mgr.hazard_size(), 0u);
+  for (auto& nodes : freed) {
+    for (TestData* node : nodes) {
+      delete node;
+    }
+  }
+  delete source.exchange(nullptr);
+}
+
+// -----------------------------------------------------------------------------
+// 36) reclaim_all also clears records left behind by exited threads
+// -----------------------------------------------------------------------------
+struct OrphanedRecord_TestData {
+  static inline std::atomic<int> destroyed{0};
+  int value;
+  OrphanedRecord_TestData(int v = 0) : value(v) {}
+  ~OrphanedRecord_TestData() { destroyed.fetch_add(1); }
+};
+TEST(DynamicHazardPointerManager, ReclaimAllClearsOrphanedRecords) {
+  using TestData = OrphanedRecord_TestData;
+  auto& mgr = HazardPointerManager<TestData,0>::instance(16, 4);
+  auto* node = new TestData(1);
+
+  // Take this thread's record first, so the worker's stays unowned after it exits.
+  mgr.reclaim();
+  auto guard = mgr.protect(node);
+  ASSERT_TRUE(guard);
+  std::thread([&mgr, node] {
+    EXPECT_TRUE(mgr.retire(node));
+  }).join();
+  EXPECT_EQ(TestData::destroyed.load(), 0);
+  EXPECT_EQ(mgr.record_size(), 2u);
+
+  guard.reset();
+  mgr.reclaim_all();
+  EXPECT_EQ(TestData::destroyed.load(), 1);
+}
+
 // -----------------------------------------------------------------------------
 // main
 // -----------------------------------------------------------------------------
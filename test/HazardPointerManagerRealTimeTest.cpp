@@ -0,0 +1,473 @@
+// HazardPointerManagerRealTimeTest.cpp
+//
+// Interposes malloc/calloc/realloc for the whole binary. While a MallocTrap is
+// alive on a thread, every allocation that thread makes is counted, so a test
+// can assert that a section of code allocated nothing (operator new ends up in
+// malloc too).
+//
+// SyscallTrap does the same for sched_yield, pthread_mutex_lock and syscall
+// (libstdc++'s futex wait and wake), and adds the thread's voluntary context
+// switches, so a test can assert that a section neither entered the kernel
+// through those paths nor blocked.
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cstdarg>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include "HazardPointerManager.hpp"
+
+using namespace HazardSystem;
+
+#if defined(__GLIBC__)
+#include <dlfcn.h>
+#include <pthread.h>
+#include <sys/resource.h>
+
+extern "C" void* __libc_malloc(size_t size);
+extern "C" void* __libc_calloc(size_t count, size_t size);
+extern "C" void* __libc_realloc(void* ptr, size_t size);
+
+namespace {
+    thread_local bool t_trapped = false;
+    std::atomic<size_t> g_trapped_calls{0};
+
+    void note_allocation(void) {
+        if (t_trapped) {
+            g_trapped_calls.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+extern "C" void* malloc(size_t size) {
+    note_allocation();
+    return __libc_malloc(size);
+}
+
+extern "C" void* calloc(size_t count, size_t size) {
+    note_allocation();
+    return __libc_calloc(count, size);
+}
+
+extern "C" void* realloc(void* ptr, size_t size) {
+    note_allocation();
+    return __libc_realloc(ptr, size);
+}
+
+// Counts this thread's allocations between construction and calls().
+class MallocTrap {
+    public:
+        MallocTrap(void) : m_start(g_trapped_calls.load()) {
+            t_trapped = true;
+        }
+        ~MallocTrap(void) {
+            t_trapped = false;
+        }
+        size_t calls(void) const {
+            return g_trapped_calls.load() - m_start;
+        }
+    private:
+        size_t m_start;
+};
+
+extern "C" int __sched_yield(void);
+
+namespace {
+    using SyscallFunction = long (*)(long, long, long, long, long, long, long);
+    using MutexLockFunction = int (*)(pthread_mutex_t*);
+
+    thread_local bool t_syscall_trapped = false;
+    std::atomic<size_t> g_trapped_syscalls{0};
+    const SyscallFunction g_syscall      = reinterpret_cast<SyscallFunction>(dlsym(RTLD_NEXT, "syscall"));
+    const MutexLockFunction g_mutex_lock = reinterpret_cast<MutexLockFunction>(dlsym(RTLD_NEXT, "pthread_mutex_lock"));
+
+    void note_syscall(void) {
+        if (t_syscall_trapped) {
+            g_trapped_syscalls.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    long voluntary_switches(void) {
+        rusage usage{};
+        getrusage(RUSAGE_THREAD, &usage);
+        return usage.ru_nvcsw;
+    }
+}
+
+extern "C" int sched_yield(void) noexcept {
+    note_syscall();
+    return __sched_yield();
+}
+
+extern "C" int pthread_mutex_lock(pthread_mutex_t* mutex) noexcept {
+    note_syscall();
+    return g_mutex_lock(mutex);
+}
+
+extern "C" long syscall(long number, ...) noexcept {
+    note_syscall();
+    va_list args;
+    va_start(args, number);
+    long a[6];
+    for (long& arg : a) {
+        arg = va_arg(args, long);
+    }
+    va_end(args);
+    return g_syscall(number, a[0], a[1], a[2], a[3], a[4], a[5]);
+}
+
+// Counts this thread's trapped calls and voluntary context switches between
+// construction and calls(). Per thread, so a test sums one trap per thread.
+class SyscallTrap {
+    public:
+        SyscallTrap(void) : m_start(g_trapped_syscalls.load()), m_switches(voluntary_switches()) {
+            t_syscall_trapped = true;
+        }
+        ~SyscallTrap(void) {
+            t_syscall_trapped = false;
+        }
+        size_t calls(void) const {
+            const long switches = voluntary_switches() - m_switches;
+            return g_trapped_syscalls.load() - m_start + static_cast<size_t>(switches);
+        }
+    private:
+        size_t m_start;
+        long m_switches;
+};
+#endif
+
+struct Tick {
+    uint64_t seq;
+};
+
+struct Quote {
+    uint64_t seq;
+};
+
+struct Level {
+    uint64_t seq;
+};
+
+struct Fill {
+    uint64_t seq;
+};
+
+// Every Slice claims the same shared bytes, so one range pins them all.
+struct Slice {
+    static inline std::byte storage[256];
+    uint64_t seq;
+    std::span<const std::byte> hazard_extent() const { return {storage, sizeof(storage)}; }
+};
+
+TEST(RealTimeProfile, TrapSeesAllocations) {
+#if !defined(__GLIBC__)
+    GTEST_SKIP() << "malloc interposition needs glibc";
+#else
+    size_t seen = 0;
+    {
+        MallocTrap trap;
+        auto* leaked = new int(1);
+        seen = trap.calls();
+        delete leaked;
+    }
+    EXPECT_GE(seen, 1u);
+#endif
+}
+
+TEST(RealTimeProfile, TrapSeesSyscalls) {
+#if !defined(__GLIBC__)
+    GTEST_SKIP() << "syscall interposition needs glibc";
+#else
+    std::atomic<uint32_t> word{0};
+    size_t seen = 0;
+    {
+        SyscallTrap trap;
+        std::this_thread::yield();
+        word.notify_all();
+        seen = trap.calls();
+    }
+    EXPECT_GE(seen, 1u);
+#endif
+}
+
+TEST(RealTimeProfile, NoAllocationAfterWarmUp) {
+#if !defined(__GLIBC__)
+    GTEST_SKIP() << "malloc interposition needs glibc";
+#else
+    using Manager = HazardPointerManager<Tick, 0>;
+    auto& manager = Manager::instance(16, 4);
+    ASSERT_TRUE(manager.warm_up());
+
+    // Nodes are the caller's; only the manager's own work is under the trap.
+    constexpr size_t C_ROUNDS = 4096;
+    std::vector<Tick*> nodes;
+    nodes.reserve(C_ROUNDS);
+    for (size_t i = 0; i < C_ROUNDS; ++i) {
+        nodes.push_back(new Tick{i});
+    }
+    std::atomic<Tick*> source{new Tick{C_ROUNDS}};
+
+    size_t calls    = 0;
+    size_t syscalls = 0;
+    uint64_t sum = 0;
+    bool retired = true;
+    {
+        MallocTrap trap;
+        SyscallTrap kernel;
+        for (size_t i = 0; i < C_ROUNDS; ++i) {
+            auto held  = manager.protect(nodes[i]);
+            auto tried = manager.try_protect(source);
+            auto waited = manager.wait_free_protect(source);
+            sum += held->seq + (tried ? tried->seq : 0) + (waited ? waited->seq : 0);
+            held.reset();
+            retired = manager.retire(source.exchange(nodes[i])) and retired;
+            if (i % 64 == 0) {
+                manager.reclaim();
+            }
+        }
+        manager.reclaim();
+        calls    = trap.calls();
+        syscalls = kernel.calls();
+    }
+    EXPECT_EQ(calls, 0u);
+    EXPECT_EQ(syscalls, 0u);
+    EXPECT_TRUE(retired);
+    EXPECT_GT(sum, 0u);
+    EXPECT_LE(manager.retire_size(), manager.hazard_capacity());
+
+    delete source.exchange(nullptr);
+    manager.reclaim();
+#endif
+}
+
+TEST(RealTimeProfile, RetireNeverFailsWhileReadersHold) {
+#if !defined(__GLIBC__)
+    GTEST_SKIP() << "malloc interposition needs glibc";
+#else
+    using Manager = HazardPointerManager<Quote, 0>;
+    auto& manager = Manager::instance(16, 4);
+
+    // A second thread keeps all but one slot protecting whatever is current, so
+    // the pinned retire map always holds protected nodes when it fills up.
+    std::atomic<Quote*> source{new Quote{0}};
+    std::atomic<bool> stop{false};
+    std::atomic<bool> ready{false};
+    std::thread reader([&] {
+        ASSERT_TRUE(manager.warm_up());
+        std::vector<ProtectedPointer<Quote>> held;
+        held.reserve(manager.hazard_capacity());
+        ready.store(true);
+        while (!stop.load()) {
+            held.clear();
+            while (held.size() + 1 < manager.hazard_capacity()) {
+                auto guard = manager.wait_free_protect(source);
+                if (!guard) {
+                    break;
+                }
+                held.push_back(std::move(guard));
+            }
+        }
+    });
+    while (!ready.load()) {
+        std::this_thread::yield();
+    }
+
+    ASSERT_TRUE(manager.warm_up());
+    constexpr size_t C_ROUNDS = 2048;
+    std::vector<Quote*> nodes;
+    nodes.reserve(C_ROUNDS);
+    for (size_t i = 1; i <= C_ROUNDS; ++i) {
+        nodes.push_back(new Quote{i});
+    }
+
+    size_t calls    = 0;
+    size_t syscalls = 0;
+    size_t failed   = 0;
+    {
+        MallocTrap trap;
+        SyscallTrap kernel;
+        for (Quote* node : nodes) {
+            if (!manager.retire(source.exchange(node))) {
+                ++failed;
+            }
+            manager.reclaim();
+        }
+        calls    = trap.calls();
+        syscalls = kernel.calls();
+    }
+    stop.store(true);
+    reader.join();
+
+    EXPECT_EQ(calls, 0u);
+    EXPECT_EQ(syscalls, 0u);
+    EXPECT_EQ(failed, 0u);
+    delete source.exchange(nullptr);
+    manager.reclaim();
+    EXPECT_EQ(manager.retire_size(), 0u);
+#endif
+}
+
+TEST(RealTimeProfile, SpinOnlyWaitStaysInUserSpace) {
+#if !defined(__GLIBC__)
+    GTEST_SKIP() << "syscall interposition needs glibc";
+#else
+    // Another thread's unfinished step, held open for longer than the spin and
+    // yield stages last. A default waiter parks on it; a spin-only one must not.
+    auto wait_out = [](const bool spin_only) {
+        std::atomic<uint32_t> step{0};
+        std::atomic<bool> ready{false};
+        size_t calls = 0;
+        std::thread waiter([&] {
+            Backoff::set_spin_only(spin_only);
+            ready.store(true);
+            SyscallTrap trap;
+            Backoff backoff;
+            static_cast<void>(backoff.wait_while(step, 0U));
+            calls = trap.calls();
+        });
+        while (!ready.load()) {
+            std::this_thread::yield();
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        step.store(1U);
+        step.notify_all();
+        waiter.join();
+        return calls;
+    };
+
+    EXPECT_GT(wait_out(false), 0u);
+    EXPECT_EQ(wait_out(true), 0u);
+#endif
+}
+
+TEST(RealTimeProfile, WarmedThreadsSpinOnUnsettledRegistrySlot) {
+#if !defined(__GLIBC__)
+    GTEST_SKIP() << "syscall interposition needs glibc";
+#else
+    using Manager = HazardPointerManager<Level, 0>;
+    auto& manager = Manager::instance(16, 4);
+
+    // Every thread protects the same node, so its registry slot keeps going
+    // through install and tombstone. A thread that finds it between the two
+    // must wait it out by spinning: a yield, futex wait or wake is trapped.
+    constexpr size_t C_THREADS = 4;
+    constexpr size_t C_ROUNDS  = 20000;
+    auto* node = new Level{1};
+    std::atomic<size_t> calls{0};
+    std::atomic<size_t> held{0};
+    std::atomic<size_t> ready{0};
+    std::vector<std::thread> threads;
+    threads.reserve(C_THREADS);
+    for (size_t t = 0; t < C_THREADS; ++t) {
+        threads.emplace_back([&] {
+            ASSERT_TRUE(manager.warm_up());
+            ready.fetch_add(1);
+            while (ready.load() < C_THREADS) {
+                std::this_thread::yield();
+            }
+            size_t local = 0;
+            SyscallTrap trap;
+            for (size_t i = 0; i < C_ROUNDS; ++i) {
+                auto guard = manager.protect(node);
+                local += guard ? guard->seq : 0;
+            }
+            calls.fetch_add(trap.calls());
+            held.fetch_add(local);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(calls.load(), 0u);
+    EXPECT_EQ(held.load(), C_THREADS * C_ROUNDS);
+    EXPECT_FALSE(manager.is_protected(node));
+    delete node;
+#endif
+}
+
+TEST(RealTimeProfile, ReclaimRunsDeferredWithoutAllocating) {
+#if !defined(__GLIBC__)
+    GTEST_SKIP() << "malloc interposition needs glibc";
+#else
+    using Manager = HazardPointerManager<Fill, 0>;
+    auto& manager = Manager::instance(16, 4);
+    ASSERT_TRUE(manager.warm_up());
+
+    // The callbacks wait on a held node, so the queue grows past several scans
+    // before the trap; only the final reclaim that runs them is measured.
+    constexpr size_t C_DEFERRED = 1024;
+    auto* node = new Fill{1};
+    size_t ran = 0;
+    {
+        auto guard = manager.protect(node);
+        for (size_t i = 0; i < C_DEFERRED; ++i) {
+            ASSERT_TRUE(manager.defer(node, [&ran] { ++ran; }));
+        }
+        EXPECT_EQ(ran, 0u);
+    }
+
+    size_t calls    = 0;
+    size_t syscalls = 0;
+    {
+        MallocTrap trap;
+        SyscallTrap kernel;
+        manager.reclaim();
+        calls    = trap.calls();
+        syscalls = kernel.calls();
+    }
+    EXPECT_EQ(calls, 0u);
+    EXPECT_EQ(syscalls, 0u);
+    EXPECT_EQ(ran, C_DEFERRED);
+    delete node;
+#endif
+}
+
+TEST(RealTimeProfile, HeldRangeCanFillTheReserve) {
+#if !defined(__GLIBC__)
+    GTEST_SKIP() << "malloc interposition needs glibc";
+#else
+    using Manager = HazardPointerManager<Slice, 0>;
+    auto& manager = Manager::instance(16, 4);
+    ASSERT_TRUE(manager.warm_up());
+
+    // A range pins every node it overlaps, not one per slot, so the pinned map
+    // fills up; retire must then refuse the node rather than grow.
+    constexpr size_t C_NODES = 1024;
+    std::vector<Slice*> nodes;
+    nodes.reserve(C_NODES);
+    for (size_t i = 0; i < C_NODES; ++i) {
+        nodes.push_back(new Slice{i});
+    }
+    std::vector<Slice*> refused;
+    refused.reserve(C_NODES);
+
+    size_t calls = 0;
+    {
+        auto range = manager.protect_range(Slice::storage, sizeof(Slice::storage));
+        ASSERT_TRUE(range);
+        MallocTrap trap;
+        for (Slice* node : nodes) {
+            if (!manager.retire(node)) {
+                refused.push_back(node);
+            }
+        }
+        manager.reclaim();
+        calls = trap.calls();
+    }
+    EXPECT_EQ(calls, 0u);
+    EXPECT_GT(refused.size(), 0u);
+    EXPECT_EQ(manager.retire_size() + refused.size(), C_NODES);
+
+    manager.reclaim();
+    EXPECT_EQ(manager.retire_size(), 0u);
+    for (Slice* node : refused) {
+        delete node;
+    }
+#endif
+}
@@ -132,3 +132,55 @@ TEST(HazardRegistryTest, SnapshotStabilityUnderConcurrentWrites) {
         EXPECT_NE(p, nullptr);
     }
 }
+
+TEST(HazardRegistryTest, TryAddJoinsAndRemoveCountsDown) {
+    HazardRegistry<int> registry(4);
+    int a = 1, b = 2;
+
+    ASSERT_TRUE(registry.try_add(&a));
+    ASSERT_TRUE(registry.try_add(&a));
+    ASSERT_TRUE(registry.add(&a));
+    EXPECT_TRUE(registry.remove(&a));
+    EXPECT_TRUE(registry.remove(&a));
+    EXPECT_TRUE(registry.contains(&a));
+    EXPECT_TRUE(registry.remove(&a));
+    EXPECT_FALSE(registry.contains(&a));
+
+    // A remove without a matching add changes nothing.
+    EXPECT_FALSE(registry.remove(&a));
+    EXPECT_FALSE(registry.remove(&b));
+    ASSERT_TRUE(registry.try_add(&b));
+    EXPECT_TRUE(registry.contains(&b));
+    EXPECT_FALSE(registry.try_add(nullptr));
+}
+
+TEST(HazardRegistryTest, TryAddUnderContentionKeepsHolderVisible) {
+    HazardRegistry<int> registry(16);
+    int shared = 0;
+    ASSERT_TRUE(registry.add(&shared));
+
+    constexpr int C_THREADS = 4, C_ROUNDS = 20000;
+    std::atomic<int> added{0}, lost{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < C_THREADS; ++t) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < C_ROUNDS; ++i) {
+                if (registry.try_add(&shared)) {
+                    added.fetch_add(1);
+                    registry.remove(&shared);
+                }
+                if (!registry.contains(&shared)) {
+                    lost.fetch_add(1);
+                }
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    EXPECT_GT(added.load(), 0);
+    EXPECT_EQ(lost.load(), 0);
+    EXPECT_TRUE(registry.remove(&shared));
+    EXPECT_FALSE(registry.contains(&shared));
+}
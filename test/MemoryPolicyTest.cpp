@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+#include "MemoryPolicy.hpp"
+#include "BitmaskTable.hpp"
+#include "HazardRegistry.hpp"
+
+using namespace HazardSystem;
+
+namespace {
+
+const std::vector<MemoryPolicy>& policies() {
+    static const std::vector<MemoryPolicy> c_policies{
+        MemoryPolicy{},
+        MemoryPolicy::huge_pages(),
+        MemoryPolicy::interleave(),
+        MemoryPolicy::bind(),
+        MemoryPolicy::bind(0, PagePolicy::HugePages),
+    };
+    return c_policies;
+}
+
+} // namespace
+
+TEST(MemoryPolicyTest, AllocatorRoundTripsEverySize) {
+    for (const auto& policy : policies()) {
+        PolicyAllocator<uint64_t> alloc(policy);
+        for (size_t count : {1UL, 511UL, 512UL, 4096UL, 300000UL}) {
+            uint64_t* data = alloc.allocate(count);
+            ASSERT_NE(data, nullptr);
+            for (size_t i = 0; i < count; ++i) {
+                data[i] = i;
+            }
+            EXPECT_EQ(data[count - 1], count - 1);
+            alloc.deallocate(data, count);
+        }
+    }
+}
+
+TEST(MemoryPolicyTest, MappedBlocksArePageAligned) {
+    PolicyAllocator<uint64_t> alloc(MemoryPolicy::huge_pages());
+    uint64_t* data = alloc.allocate(1UL << 20);
+#if defined(__linux__)
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(data) % Pages::page_size(), 0U);
+#endif
+    alloc.deallocate(data, 1UL << 20);
+}
+
+TEST(MemoryPolicyTest, PageSizesComeFromTheSystem) {
+#if defined(__linux__)
+    EXPECT_EQ(Pages::page_size(), static_cast<size_t>(::sysconf(_SC_PAGESIZE)));
+#endif
+    const size_t huge = Pages::huge_page_size();
+    if (huge != 0UL) {
+        EXPECT_GT(huge, Pages::page_size());
+        EXPECT_EQ(huge & (huge - 1UL), 0UL);
+    }
+    // Whatever the huge page size, a block of a few of them round-trips.
+    const size_t count = std::max(huge, Pages::page_size()) * 3UL / sizeof(uint64_t);
+    PolicyAllocator<uint64_t> alloc(MemoryPolicy::huge_pages());
+    uint64_t* data = alloc.allocate(count);
+    data[0]         = 1U;
+    data[count - 1] = 2U;
+    EXPECT_EQ(data[0] + data[count - 1], 3U);
+    alloc.deallocate(data, count);
+}
+
+TEST(MemoryPolicyTest, AllocatorEqualityFollowsPolicy) {
+    PolicyAllocator<int> plain;
+    PolicyAllocator<int> huge(MemoryPolicy::huge_pages());
+    PolicyAllocator<long> huge_rebound(huge);
+    EXPECT_TRUE(plain == PolicyAllocator<int>());
+    EXPECT_FALSE(plain == huge);
+    EXPECT_TRUE(huge == huge_rebound);
+}
+
+TEST(MemoryPolicyTest, BitmaskTableUsesPolicy) {
+    for (const auto& policy : policies()) {
+        BitmaskTable<int, 0> table(8192, policy);
+        std::vector<int> items(table.capacity());
+        for (auto& item : items) {
+            ASSERT_TRUE(table.set(&item).has_value());
+        }
+        EXPECT_EQ(table.size(), table.capacity());
+        size_t seen = 0;
+        table.for_each([&seen](size_t, int*) { ++seen; });
+        EXPECT_EQ(seen, table.capacity());
+    }
+}
+
+TEST(MemoryPolicyTest, HazardRegistryUsesPolicy) {
+    for (const auto& policy : policies()) {
+        HazardRegistry<int> registry(20000, policy);
+        std::vector<int> items(20000);
+        for (auto& item : items) {
+            ASSERT_TRUE(registry.add(&item));
+        }
+        for (auto& item : items) {
+            EXPECT_TRUE(registry.contains(&item));
+        }
+        for (auto& item : items) {
+            ASSERT_TRUE(registry.remove(&item));
+        }
+        EXPECT_FALSE(registry.contains(&items.front()));
+    }
+}
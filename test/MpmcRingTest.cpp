@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "MpmcRing.hpp"
+
+using HazardSystem::MpmcRing;
+
+TEST(MpmcRingTest, FifoUntilFull) {
+    MpmcRing<int> ring(5);
+    EXPECT_EQ(ring.capacity(), 8u);
+    EXPECT_TRUE(ring.empty());
+    EXPECT_FALSE(ring.try_pop().has_value());
+
+    for (int i = 0; i < 8; ++i) {
+        EXPECT_TRUE(ring.try_push(i));
+    }
+    EXPECT_FALSE(ring.try_push(8));
+    EXPECT_EQ(ring.size(), 8u);
+
+    // Wraps around the same cells for a few laps.
+    for (int i = 0; i < 40; ++i) {
+        EXPECT_EQ(ring.try_pop(), i);
+        EXPECT_TRUE(ring.try_push(i + 8));
+    }
+    for (int i = 40; i < 48; ++i) {
+        EXPECT_EQ(ring.try_pop(), i);
+    }
+    EXPECT_TRUE(ring.empty());
+}
+
+TEST(MpmcRingTest, GrowKeepsOrderAcrossSegments) {
+    MpmcRing<std::unique_ptr<int>> ring(4);
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(ring.try_push(std::make_unique<int>(i)));
+    }
+    EXPECT_FALSE(ring.try_push(std::make_unique<int>(-1)));
+
+    EXPECT_FALSE(ring.grow(4));
+    EXPECT_TRUE(ring.grow(16));
+    EXPECT_EQ(ring.capacity(), 16u);
+    for (int i = 4; i < 20; ++i) {
+        EXPECT_TRUE(ring.try_push(std::make_unique<int>(i)));
+    }
+    EXPECT_FALSE(ring.try_push(std::make_unique<int>(-1)));
+    EXPECT_EQ(ring.size(), 20u);
+
+    // The old segment drains first, then the new one.
+    for (int i = 0; i < 10; ++i) {
+        auto item = ring.try_pop();
+        ASSERT_TRUE(item.has_value());
+        EXPECT_EQ(**item, i);
+    }
+    // Items left behind are destroyed with the ring.
+}
+
+TEST(MpmcRingTest, BatchesMixWithSingleCalls) {
+    MpmcRing<uint64_t> ring(8);
+    std::vector<uint64_t> in{0, 1, 2, 3, 4, 5};
+    EXPECT_EQ(ring.push_batch(in.begin(), in.end()), 6u);
+    EXPECT_TRUE(ring.try_push(6));
+    EXPECT_EQ(ring.push_batch(in.begin(), in.end()), 1u);
+
+    std::vector<uint64_t> out;
+    EXPECT_EQ(ring.pop_batch(out, 3), 3u);
+    EXPECT_EQ(ring.try_pop(), 3u);
+    ASSERT_TRUE(ring.grow(32));
+    std::vector<uint64_t> more{7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+    EXPECT_EQ(ring.push_batch(more.begin(), more.end()), 10u);
+
+    // One batch stops at the end of the old segment; the next moves on.
+    EXPECT_EQ(ring.pop_batch(out, 100), 4u);
+    EXPECT_EQ(ring.pop_batch(out, 100), 10u);
+    EXPECT_EQ(ring.pop_batch(out, 100), 0u);
+    const std::vector<uint64_t> expected{0, 1, 2, 4, 5, 6, 0, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+    EXPECT_EQ(out, expected);
+}
+
+TEST(MpmcRingTest, ConcurrentProducersConsumersAcrossGrows) {
+    constexpr uint64_t C_PRODUCERS = 3;
+    constexpr uint64_t C_CONSUMERS = 3;
+    constexpr uint64_t C_PER       = 30000;
+    MpmcRing<uint64_t> ring(16);
+
+    std::atomic<uint64_t> received{0};
+    std::atomic<uint64_t> errors{0};
+    std::vector<std::atomic<uint8_t>> seen(C_PRODUCERS * C_PER);
+    std::vector<std::thread> threads;
+
+    for (uint64_t p = 0; p < C_PRODUCERS; ++p) {
+        threads.emplace_back([&, p] {
+            std::vector<uint64_t> batch;
+            for (uint64_t i = 0; i < C_PER;) {
+                if (i % 3 == 0) {
+                    if (ring.try_push(p * C_PER + i)) {
+                        ++i;
+                    }
+                } else {
+                    batch.clear();
+                    for (uint64_t j = i; j < std::min(C_PER, i + 8); ++j) {
+                        batch.push_back(p * C_PER + j);
+                    }
+                    i += ring.push_batch(batch.begin(), batch.end());
+                }
+            }
+        });
+    }
+    for (uint64_t c = 0; c < C_CONSUMERS; ++c) {
+        threads.emplace_back([&, c] {
+            // Values from one producer come out of one consumer in order.
+            std::vector<uint64_t> last(C_PRODUCERS, 0);
+            std::vector<uint64_t> out;
+            auto take = [&](uint64_t value) {
+                const uint64_t producer = value / C_PER;
+                if (value + 1 <= last[producer] or seen[value].exchange(1) != 0) {
+                    errors.fetch_add(1);
+                }
+                last[producer] = value + 1;
+                received.fetch_add(1);
+            };
+            while (received.load(std::memory_order_relaxed) < C_PRODUCERS * C_PER) {
+                if (c == 0) {
+                    if (auto value = ring.try_pop()) {
+                        take(*value);
+                    }
+                } else {
+                    out.clear();
+                    ring.pop_batch(out, 8);
+                    for (uint64_t value : out) {
+                        take(value);
+                    }
+                }
+            }
+        });
+    }
+    // Grow a few times while everything is moving.
+    for (size_t capacity = 64; capacity <= 4096; capacity *= 4) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        EXPECT_TRUE(ring.grow(capacity));
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(errors.load(), 0u);
+    EXPECT_EQ(received.load(), C_PRODUCERS * C_PER);
+    EXPECT_TRUE(ring.empty());
+    EXPECT_EQ(ring.capacity(), 4096u);
+    MpmcRing<uint64_t>::Manager::instance().reclaim_all();
+}
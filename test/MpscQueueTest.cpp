@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "MpscQueue.hpp"
+#include "HazardPointerManager.hpp"
+
+using HazardSystem::MpscQueue;
+using HazardSystem::mpsc_hook;
+using HazardSystem::hazard_obj_base;
+using HazardSystem::HazardPointerManager;
+
+struct Message : mpsc_hook {
+    int producer = 0;
+    int sequence = 0;
+};
+
+TEST(MpscQueueTest, SingleProducerIsFifo) {
+    MpscQueue<Message> queue;
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(queue.pop(), nullptr);
+
+    std::vector<Message> messages(10);
+    for (int i = 0; i < 10; ++i) {
+        messages[i].sequence = i;
+        queue.push(&messages[i]);
+    }
+    EXPECT_FALSE(queue.empty());
+    for (int i = 0; i < 10; ++i) {
+        Message* message = queue.pop();
+        ASSERT_NE(message, nullptr);
+        EXPECT_EQ(message->sequence, i);
+    }
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(queue.pop(), nullptr);
+
+    // Popped messages are the consumer's to reuse at once.
+    queue.push(&messages[3]);
+    queue.push(&messages[0]);
+    EXPECT_EQ(queue.pop(), &messages[3]);
+    EXPECT_EQ(queue.pop(), &messages[0]);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(MpscQueueTest, PopBatchStopsWhenEmpty) {
+    MpscQueue<Message> queue;
+    std::vector<Message> messages(5);
+    for (auto& message : messages) {
+        queue.push(&message);
+    }
+
+    std::vector<Message*> out;
+    EXPECT_EQ(queue.pop_batch(out, 3), 3u);
+    EXPECT_EQ(queue.pop_batch(out, 10), 2u);
+    ASSERT_EQ(out.size(), 5u);
+    for (size_t i = 0; i < out.size(); ++i) {
+        EXPECT_EQ(out[i], &messages[i]);
+    }
+    EXPECT_EQ(queue.pop_batch(out, 10), 0u);
+}
+
+TEST(MpscQueueTest, ManyProducersKeepPerProducerOrder) {
+    constexpr int C_PRODUCERS = 4;
+    constexpr int C_PER       = 20000;
+    MpscQueue<Message> queue;
+    std::vector<std::vector<Message>> messages(C_PRODUCERS, std::vector<Message>(C_PER));
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < C_PRODUCERS; ++p) {
+        producers.emplace_back([&, p] {
+            for (int i = 0; i < C_PER; ++i) {
+                messages[p][i].producer = p;
+                messages[p][i].sequence = i;
+                queue.push(&messages[p][i]);
+            }
+        });
+    }
+
+    std::vector<int> next(C_PRODUCERS, 0);
+    std::vector<Message*> batch;
+    int received = 0;
+    while (received < C_PRODUCERS * C_PER) {
+        batch.clear();
+        if (queue.pop_batch(batch, 64) == 0) {
+            std::this_thread::yield();
+            continue;
+        }
+        for (Message* message : batch) {
+            EXPECT_EQ(message->sequence, next[message->producer]++);
+            ++received;
+        }
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    EXPECT_EQ(queue.pop_wait(), nullptr);
+    EXPECT_TRUE(queue.empty());
+}
+
+struct Retired : mpsc_hook, hazard_obj_base<Retired> {
+    static inline std::atomic<int> destroyed{0};
+    int value = 0;
+    ~Retired() { destroyed.fetch_add(1); }
+};
+
+TEST(MpscQueueTest, ConsumerRetiresWhileReadersHold) {
+    auto& manager = HazardPointerManager<Retired, 0>::instance(8, 4);
+    manager.clear();
+    MpscQueue<Retired> queue;
+
+    auto* held = new Retired();
+    auto* free = new Retired();
+    queue.push(held);
+    queue.push(free);
+
+    // A reader that found the message elsewhere still holds it.
+    auto guard = manager.protect(held);
+    ASSERT_TRUE(guard);
+
+    EXPECT_TRUE(manager.retire(queue.pop_wait()));
+    EXPECT_TRUE(manager.retire(queue.pop_wait()));
+    manager.reclaim();
+    EXPECT_EQ(Retired::destroyed.load(), 1);
+
+    guard.reset();
+    manager.reclaim();
+    EXPECT_EQ(Retired::destroyed.load(), 2);
+}
@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <memory_resource>
+#include <set>
+#include <thread>
+#include <vector>
+#include "ObjectPool.hpp"
+#include "HazardPointerManager.hpp"
+
+using HazardSystem::ObjectPool;
+using HazardSystem::HazardPointerManager;
+
+struct PoolNode {
+    static inline std::atomic<int> live{0};
+    explicit PoolNode(int v) : value(v) { live.fetch_add(1); }
+    ~PoolNode() { live.fetch_sub(1); }
+    int value;
+    char payload[40]{};
+};
+
+TEST(ObjectPoolTest, ReusesFreedSlotsLifo) {
+    ObjectPool<PoolNode, 8> pool(1);
+    EXPECT_EQ(pool.depots(), 1u);
+    EXPECT_EQ(pool.capacity(), 0u);
+
+    PoolNode* first = pool.allocate();
+    EXPECT_EQ(pool.capacity(), 8u);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(first) % alignof(PoolNode), 0u);
+    pool.deallocate(first);
+    EXPECT_EQ(pool.allocate(), first);
+    pool.deallocate(first);
+
+    // 20 live slots need three carved magazines' worth; freeing and
+    // allocating them again carves nothing new.
+    std::vector<PoolNode*> nodes;
+    for (int i = 0; i < 20; ++i) {
+        nodes.push_back(pool.allocate());
+    }
+    EXPECT_EQ(std::set<PoolNode*>(nodes.begin(), nodes.end()).size(), 20u);
+    const size_t carved = pool.capacity();
+    for (PoolNode* node : nodes) {
+        pool.deallocate(node);
+    }
+    for (int i = 0; i < 20; ++i) {
+        nodes[i] = pool.allocate();
+    }
+    EXPECT_EQ(pool.capacity(), carved);
+    for (PoolNode* node : nodes) {
+        pool.deallocate(node);
+    }
+}
+
+TEST(ObjectPoolTest, CreateAndDestroyRunLifetime) {
+    ObjectPool<PoolNode> pool;
+    EXPECT_GE(pool.depots(), 1u);
+    PoolNode* node = pool.create(7);
+    EXPECT_EQ(node->value, 7);
+    EXPECT_EQ(PoolNode::live.load(), 1);
+    pool.destroy(node);
+    EXPECT_EQ(PoolNode::live.load(), 0);
+    pool.destroy(nullptr);
+}
+
+TEST(ObjectPoolTest, SlotsFreedOnOtherThreadsComeBack) {
+    constexpr int C_COUNT = 1000;
+    ObjectPool<PoolNode, 16> pool(2);
+
+    std::vector<PoolNode*> nodes;
+    std::thread producer([&] {
+        for (int i = 0; i < C_COUNT; ++i) {
+            nodes.push_back(pool.create(i));
+        }
+    });
+    producer.join();
+    const size_t carved = pool.capacity();
+    EXPECT_GE(carved, static_cast<size_t>(C_COUNT));
+
+    // The freeing thread's full magazines go to the depot, and the rest
+    // when it exits.
+    std::thread consumer([&] {
+        for (PoolNode* node : nodes) {
+            pool.destroy(node);
+        }
+    });
+    consumer.join();
+    EXPECT_EQ(PoolNode::live.load(), 0);
+
+    for (int i = 0; i < C_COUNT; ++i) {
+        nodes[i] = pool.create(i);
+    }
+    EXPECT_EQ(pool.capacity(), carved);
+    for (PoolNode* node : nodes) {
+        pool.destroy(node);
+    }
+}
+
+TEST(ObjectPoolTest, RetiredNodesFlowBackIntoPool) {
+    auto& manager = HazardPointerManager<PoolNode, 0>::instance(8, 4);
+    manager.clear();
+    ObjectPool<PoolNode, 8> pool(1);
+
+    PoolNode* held   = pool.create(1);
+    PoolNode* unused = pool.create(2);
+    const size_t carved = pool.capacity();
+
+    auto guard = manager.protect(held);
+    ASSERT_TRUE(guard);
+    EXPECT_TRUE(manager.retire(held, &pool));
+    EXPECT_TRUE(manager.retire(unused, &pool));
+    manager.reclaim();
+    EXPECT_EQ(PoolNode::live.load(), 1);
+    EXPECT_EQ(pool.allocate(), unused);
+    pool.deallocate(unused);
+
+    guard.reset();
+    manager.reclaim();
+    EXPECT_EQ(PoolNode::live.load(), 0);
+    EXPECT_EQ(pool.allocate(), held);
+    pool.deallocate(held);
+    EXPECT_EQ(pool.capacity(), carved);
+}
+
+TEST(ObjectPoolTest, OversizedRequestsGoUpstream) {
+    ObjectPool<PoolNode, 8> pool(1);
+    std::pmr::vector<int> values(&pool);
+    values.resize(1000, 3);
+    EXPECT_EQ(values[999], 3);
+    EXPECT_EQ(pool.capacity(), 0u);
+
+    std::pmr::polymorphic_allocator<PoolNode> alloc(&pool);
+    PoolNode* node = alloc.new_object<PoolNode>(5);
+    EXPECT_EQ(pool.capacity(), 8u);
+    alloc.delete_object(node);
+    EXPECT_EQ(PoolNode::live.load(), 0);
+}
@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "RadixTree.hpp"
+
+using HazardSystem::RadixTree;
+
+TEST(RadixTreeTest, InsertFindErase) {
+    RadixTree<int> tree;
+    EXPECT_TRUE(tree.empty());
+    EXPECT_FALSE(tree.find("a").has_value());
+
+    EXPECT_TRUE(tree.insert_or_assign("romane", 1));
+    EXPECT_TRUE(tree.insert_or_assign("romanus", 2));
+    EXPECT_TRUE(tree.insert_or_assign("romulus", 3));
+    EXPECT_TRUE(tree.insert_or_assign("rubens", 4));
+    EXPECT_TRUE(tree.insert_or_assign("ruber", 5));
+    EXPECT_TRUE(tree.insert_or_assign("rubicon", 6));
+    EXPECT_TRUE(tree.insert_or_assign("rubicundus", 7));
+    EXPECT_EQ(tree.size(), 7u);
+
+    EXPECT_EQ(tree.find("romanus"), 2);
+    EXPECT_EQ(tree.find("rubicundus"), 7);
+    EXPECT_FALSE(tree.find("rom").has_value());
+    EXPECT_FALSE(tree.find("rubiconx").has_value());
+
+    EXPECT_FALSE(tree.insert_or_assign("ruber", 50));
+    EXPECT_EQ(tree.find("ruber"), 50);
+    EXPECT_EQ(tree.size(), 7u);
+
+    EXPECT_TRUE(tree.erase("romulus"));
+    EXPECT_FALSE(tree.erase("romulus"));
+    EXPECT_FALSE(tree.erase("rom"));
+    EXPECT_FALSE(tree.contains("romulus"));
+    EXPECT_TRUE(tree.contains("romane"));
+    EXPECT_TRUE(tree.contains("romanus"));
+    EXPECT_EQ(tree.size(), 6u);
+
+    for (const char* key : {"romane", "romanus", "rubens", "ruber", "rubicon", "rubicundus"}) {
+        EXPECT_TRUE(tree.erase(key)) << key;
+    }
+    EXPECT_TRUE(tree.empty());
+    EXPECT_FALSE(tree.lower_bound("").has_value());
+}
+
+TEST(RadixTreeTest, KeysThatArePrefixesOfOthers) {
+    RadixTree<int> tree;
+    EXPECT_TRUE(tree.insert_or_assign("/api/v1/users", 3));
+    EXPECT_TRUE(tree.insert_or_assign("/api", 1));
+    EXPECT_TRUE(tree.insert_or_assign("/api/v1", 2));
+    EXPECT_TRUE(tree.insert_or_assign("", 0));
+
+    EXPECT_EQ(tree.find(""), 0);
+    EXPECT_EQ(tree.find("/api"), 1);
+    EXPECT_EQ(tree.find("/api/v1"), 2);
+    EXPECT_EQ(tree.find("/api/v1/users"), 3);
+    EXPECT_FALSE(tree.find("/api/v").has_value());
+
+    auto match = tree.longest_prefix("/api/v1/users/42");
+    ASSERT_TRUE(match.has_value());
+    EXPECT_EQ(match->first, "/api/v1/users");
+    match = tree.longest_prefix("/api/v2/orders");
+    ASSERT_TRUE(match.has_value());
+    EXPECT_EQ(match->first, "/api");
+    EXPECT_EQ(match->second, 1);
+    match = tree.longest_prefix("/static");
+    ASSERT_TRUE(match.has_value());
+    EXPECT_EQ(match->first, "");
+
+    EXPECT_TRUE(tree.erase("/api/v1"));
+    EXPECT_TRUE(tree.erase(""));
+    EXPECT_EQ(tree.longest_prefix("/api/v1/x")->first, "/api");
+    EXPECT_FALSE(tree.longest_prefix("/static").has_value());
+    EXPECT_EQ(tree.find("/api/v1/users"), 3);
+}
+
+TEST(RadixTreeTest, MatchesOrderedMapThroughGrowAndShrink) {
+    // Dense byte fan-out walks nodes through 4 -> 16 -> 48 -> 256 and back.
+    RadixTree<int> tree;
+    std::map<std::string, int> reference;
+    std::mt19937 rng(7);
+
+    for (int round = 0; round < 20000; ++round) {
+        std::string key(1 + rng() % 4, '\0');
+        for (auto& c : key) {
+            c = static_cast<char>(rng() % 3 == 0 ? rng() % 256 : 'a' + rng() % 4);
+        }
+        if (rng() % 3 == 0) {
+            EXPECT_EQ(tree.erase(key), reference.erase(key) == 1u);
+        } else {
+            EXPECT_EQ(tree.insert_or_assign(key, round), reference.insert_or_assign(key, round).second);
+        }
+    }
+    ASSERT_EQ(tree.size(), reference.size());
+
+    std::vector<std::pair<std::string, int>> scanned;
+    tree.scan_prefix("", [&](const std::string& key, const int& value) { scanned.emplace_back(key, value); });
+    const std::vector<std::pair<std::string, int>> ordered(reference.begin(), reference.end());
+    EXPECT_EQ(scanned, ordered);
+
+    for (const auto& [key, value] : reference) {
+        EXPECT_EQ(tree.find(key), value);
+    }
+
+    std::vector<std::string> under_ab;
+    const size_t visited = tree.scan_prefix("ab", [&](const std::string& key, const int&) { under_ab.push_back(key); }, 5);
+    EXPECT_EQ(visited, std::min<size_t>(5u, std::distance(reference.lower_bound("ab"), reference.lower_bound("ac"))));
+    EXPECT_EQ(visited, under_ab.size());
+    auto expected = reference.lower_bound("ab");
+    for (const auto& key : under_ab) {
+        EXPECT_EQ(key, (expected++)->first);
+    }
+
+    for (const auto& probe : {std::string("b"), std::string("ab\x7f"), std::string("\xff\xff")}) {
+        auto found = tree.lower_bound(probe);
+        auto it    = reference.lower_bound(probe);
+        ASSERT_EQ(found.has_value(), it != reference.end());
+        if (found) {
+            EXPECT_EQ(found->first, it->first);
+        }
+    }
+}
+
+TEST(RadixTreeTest, ReadersRunDuringWrites) {
+    RadixTree<uint64_t> tree;
+    constexpr uint64_t C_STABLE = 512;
+    constexpr uint64_t C_CHURN  = 512;
+    auto key = [](const char* space, uint64_t i) { return std::string(space) + std::to_string(i * 2654435761u % 100003u); };
+
+    // Stable keys never change; churn keys come and go around them.
+    for (uint64_t i = 0; i < C_STABLE; ++i) {
+        tree.insert_or_assign(key("stable/", i), i);
+    }
+
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> misses{0};
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 3; ++r) {
+        readers.emplace_back([&, r] {
+            uint64_t i = static_cast<uint64_t>(r);
+            while (!stop.load(std::memory_order_relaxed)) {
+                i = (i + 7) % C_STABLE;
+                if (tree.find(key("stable/", i)) != i) {
+                    misses.fetch_add(1);
+                }
+                auto match = tree.longest_prefix(key("stable/", i) + "/tail");
+                if (!match or match->second != i) {
+                    misses.fetch_add(1);
+                }
+                size_t seen = tree.scan_prefix("stable/", [](const std::string&, const uint64_t&) {}, 16);
+                if (seen != 16) {
+                    misses.fetch_add(1);
+                }
+            }
+        });
+    }
+
+    std::thread writer([&] {
+        for (int round = 0; round < 20; ++round) {
+            for (uint64_t i = 0; i < C_CHURN; ++i) {
+                tree.insert_or_assign(key("stable/", i) + "x", i);
+                tree.insert_or_assign(key("churn/", i), i);
+            }
+            for (uint64_t i = 0; i < C_CHURN; ++i) {
+                tree.erase(key("stable/", i) + "x");
+                tree.erase(key("churn/", i));
+            }
+        }
+        stop.store(true);
+    });
+
+    writer.join();
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_EQ(misses.load(), 0u);
+    EXPECT_EQ(tree.size(), C_STABLE);
+    RadixTree<uint64_t>::Manager::instance().reclaim_all();
+}
@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include <atomic>
+#include "RetireList.hpp"
+
+using HazardSystem::RetireList;
+using HazardSystem::hazard_obj_base;
+
+struct Node : hazard_obj_base<Node> {
+    int value;
+    static inline std::atomic<int> destroyed{0};
+    explicit Node(int v) : value(v) {}
+    ~Node() { destroyed.fetch_add(1); }
+};
+
+static_assert(HazardSystem::IntrusiveRetirable<Node>);
+static_assert(!HazardSystem::IntrusiveRetirable<int>);
+
+auto always_hazard = [](const Node*) { return true; };
+auto never_hazard  = [](const Node*) { return false; };
+auto hazard_even   = [](const Node* ptr) { return ptr && (ptr->value % 2 == 0); };
+
+class RetireListTest : public ::testing::Test {
+protected:
+    void SetUp() override { Node::destroyed.store(0); }
+};
+
+TEST_F(RetireListTest, ConstructAndBasicOps) {
+    RetireList<Node> list(8, always_hazard);
+    EXPECT_EQ(list.size(), 0u);
+    EXPECT_TRUE(list.retire(new Node(1)));
+    EXPECT_EQ(list.size(), 1u);
+    list.clear();
+    EXPECT_EQ(list.size(), 0u);
+    EXPECT_EQ(Node::destroyed.load(), 1);
+}
+
+TEST_F(RetireListTest, NullPointerNotInserted) {
+    RetireList<Node> list(8, always_hazard);
+    EXPECT_FALSE(list.retire(nullptr));
+    EXPECT_EQ(list.size(), 0u);
+}
+
+TEST_F(RetireListTest, DuplicateNotInsertedTwice) {
+    RetireList<Node> list(8, always_hazard);
+    auto* ptr = new Node(5);
+    EXPECT_TRUE(list.retire(ptr));
+    EXPECT_TRUE(ptr->hazard_retired());
+    EXPECT_FALSE(list.retire(ptr));
+    EXPECT_EQ(list.size(), 1u);
+}
+
+TEST_F(RetireListTest, ReclaimKeepsHazards) {
+    RetireList<Node> list(64, hazard_even);
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_TRUE(list.retire(new Node(i)));
+    }
+    auto removed = list.reclaim();
+    ASSERT_TRUE(removed.has_value());
+    EXPECT_EQ(removed.value(), 5u);
+    EXPECT_EQ(list.size(), 5u);
+    EXPECT_EQ(Node::destroyed.load(), 5);
+
+    // Nothing new to reclaim
+    EXPECT_FALSE(list.reclaim().has_value());
+
+    EXPECT_EQ(list.reclaim_with(never_hazard).value_or(0), 5u);
+    EXPECT_EQ(list.size(), 0u);
+    EXPECT_EQ(Node::destroyed.load(), 10);
+}
+
+TEST_F(RetireListTest, ThresholdTriggersScan) {
+    RetireList<Node> list(4, never_hazard);
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_TRUE(list.retire(new Node(i)));
+    }
+    EXPECT_EQ(list.size(), 3u);
+    ASSERT_TRUE(list.retire(new Node(3)));
+    EXPECT_EQ(list.size(), 0u);
+    EXPECT_EQ(Node::destroyed.load(), 4);
+}
+
+TEST_F(RetireListTest, SurvivorsDelayNextScan) {
+    RetireList<Node> list(4, always_hazard);
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(list.retire(new Node(i)));
+    }
+    // Scan at threshold kept all four; the next scan waits for 8.
+    for (int i = 4; i < 8; ++i) {
+        ASSERT_TRUE(list.retire(new Node(i)));
+    }
+    EXPECT_EQ(list.size(), 8u);
+    EXPECT_EQ(Node::destroyed.load(), 0);
+}
+
+TEST_F(RetireListTest, CustomReclaimFunction) {
+    static std::vector<int> reclaimed;
+    reclaimed.clear();
+    RetireList<Node> list(8, never_hazard);
+    auto reclaim = [](Node* ptr) {
+        reclaimed.push_back(ptr->value);
+        delete ptr;
+    };
+    ASSERT_TRUE(list.retire(new Node(7), +reclaim));
+    ASSERT_TRUE(list.retire(new Node(9), +reclaim));
+    list.reclaim();
+    EXPECT_EQ(reclaimed.size(), 2u);
+    EXPECT_EQ(Node::destroyed.load(), 2);
+}
+
+TEST_F(RetireListTest, NodeCanBeRetiredAgainAfterReclaimHook) {
+    static Node pooled(11);
+    RetireList<Node> list(8, never_hazard);
+    auto recycle = [](Node*) {};
+    ASSERT_TRUE(list.retire(&pooled, +recycle));
+    list.reclaim();
+    EXPECT_FALSE(pooled.hazard_retired());
+    EXPECT_TRUE(list.retire(&pooled, +recycle));
+    list.reclaim();
+    EXPECT_EQ(list.size(), 0u);
+}
+
+TEST_F(RetireListTest, DestructorReclaimsEverything) {
+    {
+        RetireList<Node> list(64, always_hazard);
+        for (int i = 0; i < 16; ++i) {
+            ASSERT_TRUE(list.retire(new Node(i)));
+        }
+    }
+    EXPECT_EQ(Node::destroyed.load(), 16);
+}
+
+TEST_F(RetireListTest, ReclaimFunctionCanRetireChildren) {
+    // Cascading reclaim: freeing a parent retires its children into the same list.
+    static RetireList<Node>* s_list = nullptr;
+    RetireList<Node> list(64, hazard_even);
+    s_list = &list;
+    auto cascade = [](Node* parent) {
+        s_list->retire(new Node(parent->value * 10));
+        s_list->retire(new Node(parent->value * 10 + 1));
+        delete parent;
+    };
+    ASSERT_TRUE(list.retire(new Node(4)));
+    ASSERT_TRUE(list.retire(new Node(1), +cascade));
+
+    // 1 is freed and retires 10 and 11; 4 stays protected.
+    EXPECT_EQ(list.reclaim().value_or(0), 1u);
+    EXPECT_EQ(list.size(), 3u);
+    EXPECT_EQ(Node::destroyed.load(), 1);
+
+    // 11 is now scanned and freed, 10 and 4 stay.
+    EXPECT_EQ(list.reclaim().value_or(0), 1u);
+    EXPECT_EQ(list.size(), 2u);
+
+    ASSERT_TRUE(list.retire(new Node(3), +cascade));
+    list.clear();
+    EXPECT_EQ(list.size(), 0u);
+    // 1, 11, then 4, 10, 3 and 3's children 30 and 31.
+    EXPECT_EQ(Node::destroyed.load(), 7);
+    s_list = nullptr;
+}
@@ -3,6 +3,7 @@
 #include <set>
 #include <random>
 #include <atomic>
+#include <memory_resource>
 #include "RetireMap.hpp" // <-- Adjust path as needed
 
 using HazardSystem::RetireMap;
@@ -254,3 +255,71 @@ TEST(RetireMapTest, RandomHazardFunction) {
     }
     EXPECT_EQ(s.size(), expected_survivors);
 }
+
+TEST(RetireMapTest, ReservePinsThresholdAndRecyclesNodes) {
+    std::set<const Dummy*> hazards;
+    RetireMap<Dummy> s(2, [&hazards](const Dummy* ptr) { return hazards.count(ptr) > 0; });
+    EXPECT_TRUE(s.reserve(7)); // rounded up to 8
+
+    auto ptrs = make_ptrs(8);
+    for (auto* ptr : ptrs) {
+        hazards.insert(ptr);
+        EXPECT_TRUE(s.retire(ptr));
+    }
+    EXPECT_EQ(s.size(), 8u);
+
+    // Full and everything protected: rejected rather than grown
+    auto extra = std::make_unique<Dummy>(99);
+    EXPECT_FALSE(s.retire(extra.get()));
+    EXPECT_EQ(s.size(), 8u);
+
+    // Once something is free, the full map makes room by scanning
+    hazards.erase(ptrs[0]);
+    hazards.erase(ptrs[1]);
+    EXPECT_TRUE(s.retire(extra.release()));
+    EXPECT_EQ(s.size(), 7u);
+
+    hazards.clear();
+    EXPECT_EQ(s.reclaim(), 7u);
+    EXPECT_EQ(s.size(), 0u);
+}
+
+struct ArenaNode {
+    static inline int destroyed = 0;
+    int value;
+    explicit ArenaNode(int v) : value(v) {}
+    ~ArenaNode() { ++destroyed; }
+};
+
+TEST(RetireMapTest, PmrArenaHoldsMapAndNodes) {
+    std::pmr::monotonic_buffer_resource arena;
+    std::set<const ArenaNode*> hazards;
+    ArenaNode::destroyed = 0;
+    {
+        HazardSystem::pmr::RetireMap<ArenaNode> map(16, [&hazards](const ArenaNode* p) { return hazards.count(p) > 0; }, &arena);
+        std::pmr::polymorphic_allocator<ArenaNode> alloc(&arena);
+
+        std::vector<ArenaNode*> nodes;
+        for (int i = 0; i < 8; ++i) {
+            ArenaNode* node = alloc.allocate(1);
+            alloc.construct(node, i);
+            nodes.push_back(node);
+        }
+        hazards.insert(nodes[0]);
+        for (auto* node : nodes) {
+            ASSERT_TRUE(map.retire(node, &arena));
+        }
+        EXPECT_FALSE(map.retire(nodes[0], nullptr));
+
+        map.reclaim();
+        EXPECT_EQ(ArenaNode::destroyed, 7);
+        EXPECT_EQ(map.size(), 1u);
+
+        hazards.clear();
+        map.reclaim();
+        EXPECT_EQ(ArenaNode::destroyed, 8);
+        EXPECT_EQ(map.size(), 0u);
+    }
+    // Nothing retired from the arena is pending; drop it in one go.
+    arena.release();
+}
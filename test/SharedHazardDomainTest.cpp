@@ -0,0 +1,250 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstring>
+#include <new>
+#include <vector>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "SharedHazardDomain.hpp"
+
+using HazardSystem::SharedHazardDomain;
+using Offset = SharedHazardDomain::Offset;
+
+namespace {
+
+constexpr size_t C_SLOTS    = 8;
+constexpr size_t C_RETIRED  = 16;
+constexpr size_t C_REGION   = 64 * 1024;
+
+struct Node {
+    int value;
+};
+
+// Lives in the region right after the domain: the published pointer, the
+// nodes, a reclaim log and a few flags for the parent/child handshake.
+struct Shared {
+    std::atomic<Offset> head;
+    std::atomic<int> child_ready;
+    std::atomic<int> child_release;
+    std::atomic<int> reclaimed_count;
+    Offset reclaimed[C_RETIRED];
+    Node nodes[4];
+};
+
+class SharedHazardDomainTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_region = ::mmap(nullptr, C_REGION, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+        ASSERT_NE(m_region, MAP_FAILED);
+        auto domain = SharedHazardDomain::create(m_region, C_REGION, C_SLOTS, C_RETIRED, reclaimer());
+        ASSERT_TRUE(domain.has_value());
+        m_domain.emplace(std::move(domain.value()));
+        auto* place = static_cast<std::byte*>(m_region) + SharedHazardDomain::required_size(C_SLOTS, C_RETIRED);
+        m_shared = new (place) Shared{};
+    }
+
+    void TearDown() override {
+        m_domain.reset();
+        ::munmap(m_region, C_REGION);
+    }
+
+    SharedHazardDomain::Reclaimer reclaimer() {
+        return [this](Offset offset) {
+            const int index = m_shared->reclaimed_count.fetch_add(1);
+            m_shared->reclaimed[index] = offset;
+        };
+    }
+
+    Offset publish(int index, int value) {
+        m_shared->nodes[index].value = value;
+        const Offset offset = m_domain->offset_of(&m_shared->nodes[index]);
+        m_shared->head.store(offset);
+        return offset;
+    }
+
+    void* m_region{nullptr};
+    std::optional<SharedHazardDomain> m_domain;
+    Shared* m_shared{nullptr};
+};
+
+} // namespace
+
+TEST_F(SharedHazardDomainTest, AttachValidatesRegion) {
+    auto attached = SharedHazardDomain::attach(m_region, C_REGION, [](Offset) {});
+    ASSERT_TRUE(attached.has_value());
+    EXPECT_EQ(attached->hazard_capacity(), C_SLOTS);
+    EXPECT_EQ(attached->retire_capacity(), C_RETIRED);
+
+    std::vector<std::byte> garbage(C_REGION + 64);
+    void* aligned = garbage.data() + (64 - reinterpret_cast<uintptr_t>(garbage.data()) % 64) % 64;
+    EXPECT_FALSE(SharedHazardDomain::attach(aligned, C_REGION, [](Offset) {}).has_value());
+    EXPECT_FALSE(SharedHazardDomain::attach(m_region, 64, [](Offset) {}).has_value());
+    EXPECT_FALSE(SharedHazardDomain::create(m_region, 64, C_SLOTS, C_RETIRED, [](Offset) {}).has_value());
+}
+
+TEST_F(SharedHazardDomainTest, ProtectedOffsetIsNotReclaimed) {
+    const Offset offset = publish(0, 42);
+
+    auto guard = m_domain->protect<Node>(m_shared->head);
+    ASSERT_TRUE(guard);
+    EXPECT_EQ(guard->value, 42);
+    EXPECT_EQ(m_domain->hazard_size(), 1u);
+
+    m_shared->head.store(SharedHazardDomain::C_NULL_OFFSET);
+    ASSERT_TRUE(m_domain->retire(offset));
+    EXPECT_EQ(m_domain->reclaim(), 0u);
+    EXPECT_EQ(m_domain->retire_size(), 1u);
+
+    guard.reset();
+    EXPECT_EQ(m_domain->hazard_size(), 0u);
+    EXPECT_EQ(m_domain->reclaim(), 1u);
+    EXPECT_EQ(m_shared->reclaimed_count.load(), 1);
+    EXPECT_EQ(m_shared->reclaimed[0], offset);
+}
+
+TEST_F(SharedHazardDomainTest, RetireRingDrainsWhenFull) {
+    const Offset offset = publish(0, 1);
+    for (size_t i = 0; i < C_RETIRED * 4; ++i) {
+        ASSERT_TRUE(m_domain->retire(offset));
+    }
+    m_domain->reclaim();
+    EXPECT_EQ(m_domain->retire_size(), 0u);
+    EXPECT_EQ(m_shared->reclaimed_count.load(), static_cast<int>(C_RETIRED * 4));
+}
+
+#if defined(__linux__)
+TEST_F(SharedHazardDomainTest, ViewsAtDifferentAddressesAgree) {
+    const int fd = ::memfd_create("hazard-domain-test", 0);
+    ASSERT_GE(fd, 0);
+    ASSERT_EQ(::ftruncate(fd, C_REGION), 0);
+    void* first  = ::mmap(nullptr, C_REGION, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    void* second = ::mmap(nullptr, C_REGION, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    ASSERT_NE(first, MAP_FAILED);
+    ASSERT_NE(second, MAP_FAILED);
+    ASSERT_NE(first, second);
+
+    int reclaimed = 0;
+    auto a = SharedHazardDomain::create(first, C_REGION, C_SLOTS, C_RETIRED, [&reclaimed](Offset) { ++reclaimed; });
+    auto b = SharedHazardDomain::attach(second, C_REGION, [&reclaimed](Offset) { ++reclaimed; });
+    ASSERT_TRUE(a.has_value());
+    ASSERT_TRUE(b.has_value());
+
+    const Offset offset = SharedHazardDomain::required_size(C_SLOTS, C_RETIRED);
+    auto* node_a = a->at<Node>(offset);
+    auto* node_b = b->at<Node>(offset);
+    EXPECT_NE(static_cast<void*>(node_a), static_cast<void*>(node_b));
+    node_a->value = 7;
+
+    auto guard = b->protect(node_b);
+    ASSERT_TRUE(guard);
+    EXPECT_EQ(guard->value, 7);
+    EXPECT_EQ(a->hazard_size(), 1u);
+
+    ASSERT_TRUE(a->retire(node_a));
+    EXPECT_EQ(a->reclaim(), 0u);
+    guard.reset();
+    EXPECT_EQ(a->reclaim(), 1u);
+    EXPECT_EQ(reclaimed, 1);
+
+    a.reset();
+    b.reset();
+    ::munmap(first, C_REGION);
+    ::munmap(second, C_REGION);
+}
+#endif
+
+TEST_F(SharedHazardDomainTest, LiveChildHoldsReclaimUntilRelease) {
+    const Offset offset = publish(1, 5);
+
+    const pid_t child = ::fork();
+    ASSERT_GE(child, 0);
+    if (child == 0) {
+        auto view = SharedHazardDomain::attach(m_region, C_REGION, [](Offset) {});
+        if (!view) {
+            ::_exit(2);
+        }
+        auto guard = view->protect<Node>(m_shared->head);
+        m_shared->child_ready.store(guard ? 1 : -1);
+        while (m_shared->child_release.load() == 0) {
+            ::usleep(1000);
+        }
+        guard.reset();
+        ::_exit(0);
+    }
+
+    while (m_shared->child_ready.load() == 0) {
+        ::usleep(1000);
+    }
+    ASSERT_EQ(m_shared->child_ready.load(), 1);
+
+    m_shared->head.store(SharedHazardDomain::C_NULL_OFFSET);
+    ASSERT_TRUE(m_domain->retire(offset));
+    EXPECT_EQ(m_domain->reclaim(), 0u);
+    EXPECT_EQ(m_domain->recover(), 0u);
+
+    m_shared->child_release.store(1);
+    int status = 0;
+    ASSERT_EQ(::waitpid(child, &status, 0), child);
+    EXPECT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(WEXITSTATUS(status), 0);
+
+    EXPECT_EQ(m_domain->reclaim(), 1u);
+}
+
+TEST_F(SharedHazardDomainTest, CrashedChildSlotIsRecovered) {
+    const Offset offset = publish(2, 9);
+
+    const pid_t child = ::fork();
+    ASSERT_GE(child, 0);
+    if (child == 0) {
+        auto view = SharedHazardDomain::attach(m_region, C_REGION, [](Offset) {});
+        if (!view) {
+            ::_exit(2);
+        }
+        auto guard = view->protect<Node>(m_shared->head);
+        // Exit with the hazard still published, as a crash would.
+        ::_exit(guard ? 0 : 1);
+    }
+
+    int status = 0;
+    ASSERT_EQ(::waitpid(child, &status, 0), child);
+    ASSERT_TRUE(WIFEXITED(status));
+    ASSERT_EQ(WEXITSTATUS(status), 0);
+    EXPECT_EQ(m_domain->hazard_size(), 1u);
+
+    m_shared->head.store(SharedHazardDomain::C_NULL_OFFSET);
+    ASSERT_TRUE(m_domain->retire(offset));
+    EXPECT_EQ(m_domain->reclaim(), 0u);
+
+    EXPECT_EQ(m_domain->recover(), 1u);
+    EXPECT_EQ(m_domain->hazard_size(), 0u);
+    EXPECT_EQ(m_domain->reclaim(), 1u);
+}
+
+TEST_F(SharedHazardDomainTest, FullTableRecoversDeadOwners) {
+    publish(3, 11);
+
+    const pid_t child = ::fork();
+    ASSERT_GE(child, 0);
+    if (child == 0) {
+        auto view = SharedHazardDomain::attach(m_region, C_REGION, [](Offset) {});
+        std::vector<HazardSystem::ProtectedPointer<Node>> guards;
+        for (size_t i = 0; view and i < C_SLOTS; ++i) {
+            guards.push_back(view->protect<Node>(m_shared->head));
+        }
+        ::_exit(view and guards.back() ? 0 : 1);
+    }
+
+    int status = 0;
+    ASSERT_EQ(::waitpid(child, &status, 0), child);
+    ASSERT_EQ(WEXITSTATUS(status), 0);
+    EXPECT_EQ(m_domain->hazard_size(), C_SLOTS);
+
+    // Every slot belongs to the dead child; acquiring one recovers them all.
+    auto guard = m_domain->protect<Node>(m_shared->head);
+    ASSERT_TRUE(guard);
+    EXPECT_EQ(guard->value, 11);
+    EXPECT_EQ(m_domain->hazard_size(), 1u);
+}
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include "SnapshotMap.hpp"
+
+using HazardSystem::SnapshotMap;
+
+TEST(SnapshotMapTest, InitialEntriesAreSortedLastWins) {
+    SnapshotMap<int, std::string> map({{3, "c"}, {1, "a"}, {2, "b"}, {1, "A"}});
+    EXPECT_EQ(map.size(), 3u);
+    EXPECT_EQ(map.get(1).value_or(""), "A");
+    EXPECT_FALSE(map.get(4).has_value());
+
+    auto snapshot = map.snapshot();
+    ASSERT_TRUE(snapshot);
+    std::vector<int> keys;
+    for (const auto& [key, value] : *snapshot) {
+        keys.push_back(key);
+    }
+    EXPECT_EQ(keys, (std::vector<int>{1, 2, 3}));
+}
+
+TEST(SnapshotMapTest, SingleUpdatesBumpVersion) {
+    SnapshotMap<int, int> map;
+    EXPECT_EQ(map.version(), 0u);
+    EXPECT_EQ(map.insert_or_assign(5, 50), 1u);
+    EXPECT_EQ(map.insert_or_assign(5, 55), 2u);
+    EXPECT_EQ(map.get(5).value_or(-1), 55);
+    EXPECT_EQ(map.erase(5), 3u);
+    EXPECT_FALSE(map.contains(5));
+    EXPECT_EQ(map.size(), 0u);
+}
+
+TEST(SnapshotMapTest, BatchPublishesOneVersion) {
+    SnapshotMap<int, int> map({{1, 1}, {2, 2}, {3, 3}});
+    SnapshotMap<int, int>::Batch batch;
+    batch.insert_or_assign(4, 4);
+    batch.erase(2);
+    batch.insert_or_assign(1, 10);
+    batch.insert_or_assign(4, 40);
+    batch.erase(9);
+    EXPECT_EQ(map.commit(batch), 1u);
+
+    EXPECT_EQ(map.size(), 3u);
+    EXPECT_EQ(map.get(1).value_or(-1), 10);
+    EXPECT_FALSE(map.contains(2));
+    EXPECT_EQ(map.get(3).value_or(-1), 3);
+    EXPECT_EQ(map.get(4).value_or(-1), 40);
+}
+
+TEST(SnapshotMapTest, HeldSnapshotOutlivesUpdates) {
+    SnapshotMap<int, std::string> map({{1, "old"}});
+    auto before = map.snapshot();
+    ASSERT_TRUE(before);
+
+    for (int i = 0; i < 50; ++i) {
+        map.insert_or_assign(1, "new" + std::to_string(i));
+    }
+    ASSERT_NE(before->find(1), nullptr);
+    EXPECT_EQ(*before->find(1), "old");
+    EXPECT_EQ(before->version(), 0u);
+    EXPECT_EQ(map.get(1).value_or(""), "new49");
+}
+
+TEST(SnapshotMapTest, ConcurrentWritersLoseNoUpdates) {
+    constexpr int C_WRITERS = 4;
+    constexpr int C_PER     = 200;
+    SnapshotMap<int, int> map;
+    std::atomic<bool> done{false};
+    std::atomic<int> torn{0};
+
+    std::thread reader([&] {
+        while (!done.load(std::memory_order_acquire)) {
+            auto snapshot = map.snapshot();
+            if (!snapshot) {
+                continue;
+            }
+            // Every writer stores key -> key, so any value that differs is torn.
+            for (const auto& [key, value] : *snapshot) {
+                torn += (key != value);
+            }
+        }
+    });
+
+    std::vector<std::thread> writers;
+    for (int w = 0; w < C_WRITERS; ++w) {
+        writers.emplace_back([&, w] {
+            for (int i = 0; i < C_PER; ++i) {
+                const int key = w * C_PER + i;
+                map.insert_or_assign(key, key);
+            }
+        });
+    }
+    for (auto& writer : writers) {
+        writer.join();
+    }
+    done.store(true, std::memory_order_release);
+    reader.join();
+
+    EXPECT_EQ(torn.load(), 0);
+    EXPECT_EQ(map.size(), static_cast<size_t>(C_WRITERS * C_PER));
+    EXPECT_EQ(map.version(), static_cast<uint64_t>(C_WRITERS * C_PER));
+}
+
+TEST(SnapshotMapTest, PresentKeyNeverMissesUnderCommits) {
+    SnapshotMap<int, int> map({{0, 0}});
+    std::atomic<bool> done{false};
+    std::atomic<int> missed{0};
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 2; ++r) {
+        readers.emplace_back([&] {
+            while (!done.load(std::memory_order_acquire)) {
+                missed += !map.get(0).has_value();
+            }
+        });
+    }
+
+    // Key 0 is never erased, so every get() above must find it.
+    std::vector<std::thread> writers;
+    for (int w = 0; w < 2; ++w) {
+        writers.emplace_back([&, w] {
+            for (int i = 1; i <= 500; ++i) {
+                map.insert_or_assign(w * 1000 + i, i);
+            }
+        });
+    }
+    for (auto& writer : writers) {
+        writer.join();
+    }
+    done.store(true, std::memory_order_release);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_EQ(missed.load(), 0);
+}
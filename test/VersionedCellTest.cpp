@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "VersionedCell.hpp"
+
+using HazardSystem::VersionedCell;
+
+// 40 bytes, not a multiple of the word size in its last field.
+struct Quote {
+    uint64_t bid;
+    uint64_t ask;
+    uint64_t bid_size;
+    uint64_t ask_size;
+    uint32_t venue;
+};
+
+TEST(VersionedCellTest, StoreLoadProtect) {
+    VersionedCell<Quote> cell;
+    EXPECT_EQ(cell.version(), 0u);
+    EXPECT_EQ(cell.load().bid, 0u);
+
+    EXPECT_TRUE(cell.store(Quote{100, 101, 5, 7, 3}));
+    EXPECT_EQ(cell.version(), 2u);
+    auto view = cell.protect();
+    ASSERT_TRUE(view);
+    EXPECT_EQ(view->ask, 101u);
+    EXPECT_EQ((*view).venue, 3u);
+
+    cell = Quote{200, 201, 1, 1, 4};
+    EXPECT_EQ(cell.version(), 4u);
+    // The snapshot is a copy and keeps the old value.
+    EXPECT_EQ(view->bid, 100u);
+
+    Quote out{};
+    EXPECT_TRUE(cell.try_load(out));
+    EXPECT_EQ(out.bid, 200u);
+    EXPECT_EQ(out.venue, 4u);
+}
+
+TEST(VersionedCellTest, UpdateReadsModifiesPublishes) {
+    VersionedCell<Quote> cell(Quote{1, 2, 0, 0, 0});
+    const Quote updated = cell.update([](Quote& q) {
+        q.bid += 10;
+        q.venue = 9;
+    });
+    EXPECT_EQ(updated.bid, 11u);
+    EXPECT_EQ(cell.load().bid, 11u);
+    EXPECT_EQ(cell.load().ask, 2u);
+    EXPECT_EQ(cell.load().venue, 9u);
+    EXPECT_EQ(cell.version(), 2u);
+}
+
+TEST(VersionedCellTest, ThrowingUpdateLeavesCellUsable) {
+    VersionedCell<Quote> cell(Quote{5, 6, 0, 0, 0});
+    EXPECT_THROW(cell.update([](Quote& q) {
+        q.bid = 99;
+        throw std::runtime_error("rejected");
+    }), std::runtime_error);
+    // Not left locked, and the half-edited copy was never published.
+    EXPECT_EQ(cell.version() % 2, 0u);
+    EXPECT_EQ(cell.load().bid, 5u);
+    EXPECT_TRUE(cell.store(Quote{7, 8, 0, 0, 0}));
+    EXPECT_EQ(cell.load().bid, 7u);
+}
+
+TEST(VersionedCellTest, ReadersNeverSeeTornValues) {
+    // Every field of a stored quote derives from one counter; a torn copy would
+    // mix two of them. Readers start first, and writers keep going until every
+    // reader has read C_READS times, so the check holds on a single core too.
+    VersionedCell<Quote> cell(Quote{0, 1, 2, 3, 4});
+    constexpr uint64_t C_WRITES = 20000;
+    constexpr uint64_t C_READS  = 1000;
+    constexpr int C_READERS     = 3;
+    std::atomic<bool> start{false};
+    std::atomic<bool> done{false};
+    std::atomic<uint64_t> torn{0};
+    std::atomic<uint64_t> writes{0};
+    std::atomic<uint64_t> reads[C_READERS] = {};
+
+    const auto readers_done = [&] {
+        for (const auto& count : reads) {
+            if (count.load() < C_READS) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    std::vector<std::thread> threads;
+    for (int r = 0; r < C_READERS; ++r) {
+        threads.emplace_back([&, r] {
+            while (!start.load()) {
+                std::this_thread::yield();
+            }
+            while (!done.load()) {
+                const Quote q = cell.load();
+                if (q.ask != q.bid + 1 or q.bid_size != q.bid + 2 or q.ask_size != q.bid + 3 or
+                    q.venue != static_cast<uint32_t>(q.bid + 4)) {
+                    torn.fetch_add(1);
+                }
+                reads[r].fetch_add(1);
+            }
+        });
+    }
+    for (int w = 0; w < 2; ++w) {
+        threads.emplace_back([&] {
+            while (!start.load()) {
+                std::this_thread::yield();
+            }
+            for (uint64_t i = 1; i <= C_WRITES or !readers_done(); ++i) {
+                if (i % 2) {
+                    cell.store(Quote{i, i + 1, i + 2, i + 3, static_cast<uint32_t>(i + 4)});
+                } else {
+                    cell.update([](Quote& q) {
+                        const uint64_t n = q.bid + 1;
+                        q = Quote{n, n + 1, n + 2, n + 3, static_cast<uint32_t>(n + 4)};
+                    });
+                }
+                writes.fetch_add(1);
+                if (i % 256 == 0) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    start.store(true);
+    threads[C_READERS].join();
+    threads[C_READERS + 1].join();
+    done.store(true);
+    for (int r = 0; r < C_READERS; ++r) {
+        threads[r].join();
+    }
+
+    EXPECT_EQ(torn.load(), 0u);
+    EXPECT_TRUE(readers_done());
+    EXPECT_EQ(cell.version(), 2 * writes.load());
+}
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "WorkStealingDeque.hpp"
+
+using HazardSystem::WorkStealingDeque;
+
+TEST(WorkStealingDequeTest, OwnerPopsNewestFirst) {
+    WorkStealingDeque<int> deque(4);
+    for (int i = 0; i < 3; ++i) {
+        deque.push(i);
+    }
+    EXPECT_EQ(deque.size(), 3u);
+    EXPECT_EQ(deque.pop().value_or(-1), 2);
+    EXPECT_EQ(deque.pop().value_or(-1), 1);
+    EXPECT_EQ(deque.pop().value_or(-1), 0);
+    EXPECT_FALSE(deque.pop().has_value());
+    EXPECT_TRUE(deque.empty());
+}
+
+TEST(WorkStealingDequeTest, ThievesTakeOldestFirst) {
+    WorkStealingDeque<int> deque(4);
+    for (int i = 0; i < 3; ++i) {
+        deque.push(i);
+    }
+    EXPECT_EQ(deque.steal().value_or(-1), 0);
+    EXPECT_EQ(deque.steal().value_or(-1), 1);
+    EXPECT_EQ(deque.pop().value_or(-1), 2);
+    EXPECT_FALSE(deque.steal().has_value());
+}
+
+TEST(WorkStealingDequeTest, GrowthKeepsItems) {
+    WorkStealingDeque<int> deque(2);
+    for (int i = 0; i < 10000; ++i) {
+        deque.push(i);
+    }
+    EXPECT_GE(deque.capacity(), 10000u);
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(deque.steal().value_or(-1), i);
+    }
+    for (int i = 9999; i >= 100; --i) {
+        ASSERT_EQ(deque.pop().value_or(-1), i);
+    }
+    EXPECT_TRUE(deque.empty());
+}
+
+TEST(WorkStealingDequeTest, EveryItemTakenExactlyOnce) {
+    constexpr int C_ITEMS   = 200000;
+    constexpr int C_THIEVES = 4;
+    WorkStealingDeque<int> deque(8, C_THIEVES + 1);
+    std::vector<std::atomic<int>> taken(C_ITEMS);
+    std::atomic<bool> done{false};
+
+    std::vector<std::thread> thieves;
+    for (int t = 0; t < C_THIEVES; ++t) {
+        thieves.emplace_back([&] {
+            while (!done.load(std::memory_order_acquire) or !deque.empty()) {
+                if (auto item = deque.steal()) {
+                    taken[*item].fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // Owner: push in bursts so the buffer grows while thieves are reading it.
+    for (int i = 0; i < C_ITEMS; ++i) {
+        deque.push(i);
+        if (i % 7 == 0) {
+            if (auto item = deque.pop()) {
+                taken[*item].fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+    while (auto item = deque.pop()) {
+        taken[*item].fetch_add(1, std::memory_order_relaxed);
+    }
+    done.store(true, std::memory_order_release);
+    for (auto& thief : thieves) {
+        thief.join();
+    }
+
+    int missing = 0, duplicated = 0;
+    for (auto& count : taken) {
+        missing    += count.load() == 0;
+        duplicated += count.load() > 1;
+    }
+    EXPECT_EQ(missing, 0);
+    EXPECT_EQ(duplicated, 0);
+}
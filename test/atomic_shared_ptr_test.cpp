@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "atomic_shared_ptr.hpp"
+
+using HazardSystem::atomic_shared_ptr;
+using HazardSystem::HazardPointerManager;
+
+struct Tracked {
+    explicit Tracked(int value_) : value(value_), check(value_ * 7) {}
+    ~Tracked() {
+        check = -1;
+        destroyed.fetch_add(1);
+    }
+
+    int value;
+    int check;
+    static inline std::atomic<int> destroyed{0};
+};
+
+TEST(AtomicSharedPtrTest, StoreLoadProtect) {
+    atomic_shared_ptr<int> source;
+    EXPECT_FALSE(source);
+    EXPECT_FALSE(source.protect());
+    EXPECT_EQ(source.load(), nullptr);
+
+    EXPECT_FALSE(source.store(std::make_shared<int>(1)));
+    EXPECT_TRUE(source.store(std::make_shared<int>(2)));
+    ASSERT_TRUE(source);
+    EXPECT_EQ(*source.load(), 2);
+
+    auto view = source.protect();
+    ASSERT_TRUE(view);
+    EXPECT_EQ(view.get(), source.get());
+    EXPECT_EQ(*view, 2);
+
+    // Storing the same object again keeps it published and alive.
+    auto same = source.load();
+    EXPECT_TRUE(source.store(same));
+    EXPECT_EQ(source.get(), same.get());
+    EXPECT_TRUE(source.reset());
+    EXPECT_FALSE(source);
+    EXPECT_FALSE(source.reset());
+}
+
+TEST(AtomicSharedPtrTest, BorrowedViewOutlivesLastOwner) {
+    auto& manager = HazardPointerManager<Tracked>::instance(8);
+    manager.reclaim_all();
+    Tracked::destroyed.store(0);
+
+    auto first = std::make_shared<Tracked>(1);
+    atomic_shared_ptr<Tracked> source(first);
+    EXPECT_EQ(first.use_count(), 2);
+
+    auto view = source.protect();
+    ASSERT_TRUE(view);
+    // Borrowing does not touch the refcount.
+    EXPECT_EQ(first.use_count(), 2);
+
+    first.reset();
+    source.store(std::make_shared<Tracked>(2));
+    // The retired owner now holds the only reference; the hazard keeps it.
+    manager.reclaim();
+    EXPECT_EQ(Tracked::destroyed.load(), 0);
+    EXPECT_EQ(view->value, 1);
+    EXPECT_EQ(view->check, 7);
+
+    view.reset();
+    manager.reclaim();
+    EXPECT_EQ(Tracked::destroyed.load(), 1);
+    EXPECT_EQ(source.protect()->value, 2);
+}
+
+TEST(AtomicSharedPtrTest, ReadersBorrowWhileWriterReplaces) {
+    HazardPointerManager<Tracked>::instance(8);
+    atomic_shared_ptr<Tracked> source(std::make_shared<Tracked>(0));
+    std::atomic<bool> stop{false};
+    std::atomic<int> errors{0};
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 3; ++r) {
+        readers.emplace_back([&] {
+            int last = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                auto view = source.protect();
+                if (!view) {
+                    continue;
+                }
+                if (view->check != view->value * 7 or view->value < last) {
+                    errors.fetch_add(1);
+                    continue;
+                }
+                last = view->value;
+            }
+        });
+    }
+
+    std::thread writer([&] {
+        for (int i = 1; i <= 20000; ++i) {
+            source.store(std::make_shared<Tracked>(i));
+            if (i % 64 == 0) {
+                // Some readers keep an owning copy past the view.
+                auto owned = source.load();
+                if (!owned or owned->value != i) {
+                    errors.fetch_add(1);
+                }
+            }
+        }
+        stop.store(true);
+    });
+
+    writer.join();
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(errors.load(), 0);
+    EXPECT_EQ(source.protect()->value, 20000);
+    HazardPointerManager<Tracked>::instance().reclaim_all();
+}